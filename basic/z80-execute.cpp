@@ -6,6 +6,7 @@
 #include <termios.h>
 
 #include "z80.hpp"
+#include "z80tracefile.hpp"
 
 #include "file.h"
 #include "kk_ihex_read.h"
@@ -42,7 +43,7 @@ void usage(const char* fullpath)
             progname = fullpath;
     printf(
         "Usage:\n"
-        "  %s [-aXXXX] [-b] [-x] [-fXX] [-c] [-oXXXX] [-sXXXX] <infile>\n"
+        "  %s [-aXXXX] [-b] [-x] [-fXX] [-c] [-oXXXX] [-sXXXX] [-t tracefile] [-l] <infile>\n"
         "    -aDDSS  ACIA 6850 data / status register hex address\n"
         "    -b      treat infile as binary\n"
         "    -x      treat infile as hex\n"
@@ -50,6 +51,8 @@ void usage(const char* fullpath)
         "    -oXXXX  offset = 0x0000 .. 0xFFFF\n"
         "    -sXXXX  start  = 0x0000 .. 0xFFFF\n"
         "    -fXX    fill = 0x00 .. 0xFF\n"
+        "    -t FILE write the binary trace of the instructions to FILE\n"
+        "    -l      with -t: never drop the trace records (the CPU waits for the writer)\n"
         "    -u      make KBD input char upper case\n"
         "    -v      increase verbosity (to stderr)\n",
         progname);
@@ -85,6 +88,8 @@ int main(int argc, char* argv[]) {
     const unsigned short IO_MASK = 0xFF;
 
     char* inPath = NULL;
+    char* tracePath = NULL;
+    bool traceLossless = false;
     unsigned int offset = 0x0000;
     unsigned int start = 0x0000;
     int fill = 0x00;
@@ -150,6 +155,20 @@ int main(int argc, char* argv[]) {
                     }
                     j = 0; // end of this arg group
                     break;
+                case 't':             // binary trace
+                    if (argv[i][++j]) // "-tFILE"
+                        tracePath = argv[i] + j;
+                    else if (i < argc - 1) // "-t FILE"
+                        tracePath = argv[++i];
+                    else {
+                        fprintf(stderr, "Error: option -t needs a file name\n");
+                        return 1;
+                    }
+                    j = 0; // end of this arg group
+                    break;
+                case 'l':
+                    traceLossless = true;
+                    break;
                 case 'u':
                     kbdUpperCase = true;
                     break;
@@ -253,6 +272,16 @@ int main(int argc, char* argv[]) {
     if ( verboseMode )
         z80.setDebugMessage([](void* arg, const char* msg) { fprintf(stderr, "%s\n", msg); });
 
+    // the trace is written on the background thread (much faster than -vv for the long runs)
+    Z80TraceWriter* traceWriter = NULL;
+    if ( tracePath ) {
+        traceWriter = new Z80TraceWriter(z80, tracePath, 0x100000, traceLossless);
+        if ( !traceWriter->isOpen() ) {
+            fprintf(stderr, "Cannot open %s\n", tracePath);
+            return -1;
+        }
+    }
+
     MSG(1, "Offset: $%04X, start: $%04X\n", offset, start);
 
     z80.reg.PC = start;
@@ -277,6 +306,14 @@ int main(int argc, char* argv[]) {
 
     MSG(1, "Execution took %d ticks\n", ticks);
 
+    if ( traceWriter ) {
+        traceWriter->close();
+        MSG(1, "Trace: %llu records written, %llu dropped\n", traceWriter->getWritten(), traceWriter->getDropped());
+        if ( traceWriter->getDropped() )
+            fprintf(stderr, "Warning: %llu trace records dropped (use -l to keep all of them)\n", traceWriter->getDropped());
+        delete traceWriter;
+    }
+
 #endif
 
     return 0;
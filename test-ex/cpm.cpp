@@ -94,6 +94,7 @@ int main(int argc, char* argv[])
     bool verboseMode = false;
 #endif
     bool noAnimation = false;
+    bool mapped = false;
     for (int i = 1; i < argc; i++) {
         if ('-' == argv[i][0]) {
             switch (argv[i][1]) {
@@ -108,6 +109,9 @@ int main(int argc, char* argv[])
                 case 'n':
                     noAnimation = true;
                     break;
+                case 'm':
+                    mapped = true;
+                    break;
                 default:
                     printf("unsupported option: %s\n", argv[i]);
                     return 1;
@@ -128,6 +132,9 @@ int main(int argc, char* argv[])
         return -1;
     }
     cpm.checkError = checkError;
+    if (mapped) {
+        z80.mapMemory(0x0000, sizeof(cpm.memory), cpm.memory); // access the memory directly instead of the callbacks
+    }
     z80.reg.PC = 0x0100;
     z80.addBreakOperand(0x76, [](void* arg, unsigned char* opcode, int opcodeLength) {
         ((CPM*)arg)->halted = true;
@@ -0,0 +1,44 @@
+#include "z80.hpp"
+
+// Bus that is known at compile time (read/write/in/out are inlined into each instruction)
+class MyBus
+{
+  public:
+    unsigned char* ram;
+    inline unsigned char read(void* arg, unsigned short addr) { return ram[addr]; }
+    inline void write(void* arg, unsigned short addr, unsigned char value) { ram[addr] = value; }
+    inline unsigned char in(void* arg, unsigned short port)
+    {
+        printf("IN port $%02X\n", port);
+        return 0x12;
+    }
+    inline void out(void* arg, unsigned short port, unsigned char value)
+    {
+        printf("OUT port $%02X <- $%02X\n", port, value);
+        ((Z80Core<MyBus>*)arg)->requestBreak();
+    }
+};
+
+int main()
+{
+    unsigned char ram[0x10000];
+    memset(ram, 0, sizeof(ram));
+    const unsigned char prg[] = {
+        0x21, 0x00, 0x80, // LD HL, $8000
+        0x3E, 0x34,       // LD A, $34
+        0x77,             // LD (HL), A
+        0x23,             // INC HL
+        0xDB, 0x56,       // IN A, ($56)
+        0x77,             // LD (HL), A
+        0xD3, 0x78,       // OUT ($78), A
+        0xC3, 0x0C, 0x00, // JP $000C
+    };
+    memcpy(ram, prg, sizeof(prg));
+    MyBus bus;
+    bus.ram = ram;
+    Z80Core<MyBus> z80(bus, &z80);
+    z80.setDebugMessage([](void* arg, const char* msg) { puts(msg); });
+    printf("actualExecuteClocks = %dHz\n", z80.execute(0x7FFFFFFF));
+    printf("($8000) = $%02X, ($8001) = $%02X\n", ram[0x8000], ram[0x8001]);
+    return ram[0x8000] == 0x34 && ram[0x8001] == 0x12 ? 0 : -1;
+}
@@ -0,0 +1,107 @@
+#include "z80.hpp"
+
+int main()
+{
+    unsigned char ram[0x100];
+    memset(ram, 0, sizeof(ram));
+    const unsigned char prg[] = {
+        0x06, 0x03,             // LD B, 3
+        0xDD, 0x21, 0x80, 0x00, // LD IX, $0080
+        0x3E, 0x00,             // LD A, 0
+        0xDD, 0xCB, 0x01, 0xC6, // SET 0, (IX+1)
+        0xDD, 0x34, 0x00,       // INC (IX+0)
+        0x00,                   // NOP ... rewrite to INC A by the next instruction
+        0x21, 0x0F, 0x00,       // LD HL, $000F
+        0x36, 0x3C,             // LD (HL), $3C
+        0x10, 0xF1,             // DJNZ $0008
+        0x76,                   // HALT
+    };
+    memcpy(ram, prg, sizeof(prg));
+    Z80 z80([](void* arg, unsigned short addr) {
+        printf("callback: read ($%04X)\n", addr);
+        return 0x00;
+    }, [](void* arg, unsigned short addr, unsigned char value) {
+        printf("callback: write ($%04X) <- $%02X\n", addr, value);
+    }, [](void* arg, unsigned short port) {
+        return 0x00;
+    }, [](void* arg, unsigned short port, unsigned char value) {
+    }, &z80);
+    z80.mapMemory(0x0000, sizeof(ram), ram);
+    z80.addBreakPoint(0x000C, [](void* arg) { puts("break point: $000C"); });
+    z80.addBreakPoint(0x0017, [](void* arg) { ((Z80*)arg)->requestBreak(); });
+    z80.addBreakOperand(0xDD, 0xCB, 0xC6, [](void* arg, unsigned char* opcode, int opcodeLength) {
+        printf("break operand: %02X %02X %02X %02X\n", opcode[0], opcode[1], opcode[2], opcode[3]);
+    });
+    z80.setDebugMessage([](void* arg, const char* msg) { puts(msg); });
+    int clocks = z80.execute(0x7FFFFFFF);
+    printf("clocks = %d, A = $%02X, ($0080) = $%02X, ($0081) = $%02X, R = $%02X\n", clocks, z80.reg.pair.A, ram[0x80], ram[0x81], z80.reg.R);
+    if (z80.reg.pair.A != 2 || ram[0x80] != 3 || ram[0x81] != 1) return -1;
+
+    // execute again with consumeClock callback (consume the clocks at each memory access)
+    static int callbackClocks = 0;
+    memcpy(ram, prg, sizeof(prg));
+    memset(&ram[0x80], 0, 2);
+    z80.clearDecodeCache();
+    z80.reg.PC = 0;
+    z80.reg.R = 0;
+    z80.reg.IFF = 0;
+    z80.resetDebugMessage();
+    z80.setConsumeClockCallback([](void* arg, int clock) { callbackClocks += clock; });
+    static Z80::TraceRecord ring[64];
+    z80.setTraceBuffer(ring, 64);
+    clocks = z80.execute(0x7FFFFFFF);
+    printf("clocks = %d, callback = %d, A = $%02X, ($0080) = $%02X, ($0081) = $%02X, R = $%02X\n", clocks, callbackClocks, z80.reg.pair.A, ram[0x80], ram[0x81], z80.reg.R);
+    if (clocks != callbackClocks || z80.reg.pair.A != 2 || ram[0x80] != 3 || ram[0x81] != 1) return -1;
+
+    // the trace records the opcode bytes of the decoded operands (NOP at $000F is rewritten to INC A)
+    bool traced = 0 < z80.getTraceCount();
+    for (unsigned long long i = 0; i < z80.getTraceCount(); i++) {
+        const Z80::TraceRecord& r = ring[i];
+        size_t length = (size_t)Z80::decode(&ram[r.PC], 4, r.PC).length;
+        traced &= 0x000F == r.PC ? 0x00 == r.opcode[0] || 0x3C == r.opcode[0] : 0 == memcmp(r.opcode, &ram[r.PC], length);
+    }
+    printf("trace: %s (%d records)\n", traced ? "OK" : "NG", (int)z80.getTraceCount());
+    z80.removeTraceBuffer();
+    if (!traced) return -1;
+
+    // the code via the read callback is not decoded: OUT switches the bank of the next instructions
+    static unsigned char bank;
+    static int busReads;
+    static const unsigned char banks[2][6] = {
+        {0x3E, 0x01, 0xD3, 0x00, 0x00, 0x76}, // LD A, 1; OUT ($00), A; NOP; HALT
+        {0x3E, 0x01, 0xD3, 0x00, 0x3C, 0x76}, // LD A, 1; OUT ($00), A; INC A; HALT
+    };
+    Z80 bus([](void* arg, unsigned short addr) {
+        busReads++;
+        return banks[bank][addr & 0xFF];
+    }, [](void* arg, unsigned short addr, unsigned char value) {
+    }, [](void* arg, unsigned short port) {
+        return (unsigned char)0x00;
+    }, [](void* arg, unsigned short port, unsigned char value) {
+        bank = value & 1;
+    }, nullptr);
+    bank = 0;
+    busReads = 0;
+    for (int i = 0; i < 2; i++) {
+        bank = 0;
+        bus.reg.PC = 0x0100;
+        bus.reg.IFF = 0;
+        bus.execute(7 + 11 + 4 + 4);
+    }
+    printf("bus: A = $%02X, reads = %d\n", bus.reg.pair.A, busReads);
+    if (bus.reg.pair.A != 2 || busReads != 12) return -1;
+
+    // execute again without break points and callbacks (in the same clocks)
+    memcpy(ram, prg, sizeof(prg));
+    memset(&ram[0x80], 0, 2);
+    z80.clearDecodeCache();
+    z80.reg.PC = 0;
+    z80.reg.R = 0;
+    z80.reg.IFF = 0;
+    z80.removeAllBreakPoints();
+    z80.removeAllBreakOperands();
+    z80.resetConsumeClockCallback();
+    clocks = z80.execute(276);
+    printf("clocks = %d, A = $%02X, ($0080) = $%02X, ($0081) = $%02X, R = $%02X, PC = $%04X\n", clocks, z80.reg.pair.A, ram[0x80], ram[0x81], z80.reg.R, z80.reg.PC);
+    return clocks == 276 && z80.reg.pair.A == 2 && ram[0x80] == 3 && ram[0x81] == 1 ? 0 : -1;
+}
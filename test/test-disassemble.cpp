@@ -0,0 +1,154 @@
+#include "z80.hpp"
+#include <set>
+
+// decode every operation code without executing it, and check the length and the clocks by executing it
+struct Machine {
+    unsigned char ram[0x10000];
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        z80.mapMemory(0x0000, 0x10000, ram);
+    }
+};
+
+static Machine machine;
+
+// execute the opcode at addr (the operand word and the return address point to the next instruction)
+static bool check(const unsigned char* opcode, size_t opcodeLength)
+{
+    unsigned short addr = 0x8000;
+    if (1 == opcodeLength && 0xC7 == (opcode[0] & 0xC7)) addr = (unsigned short)((opcode[0] & 0x38) - 1); // RST p
+    memset(machine.ram, 0, sizeof(machine.ram));
+    memcpy(&machine.ram[addr], opcode, opcodeLength);
+    Z80::Instruction ins = machine.z80.decode(addr);
+    char text[80];
+    Z80::disassemble(ins, text, sizeof(text));
+    unsigned short next = (unsigned short)(addr + ins.length);
+    if (Z80::OPERAND_WORD == ins.operand) {
+        machine.ram[(unsigned short)(addr + ins.length - 2)] = next & 0xFF;
+        machine.ram[(unsigned short)(addr + ins.length - 1)] = next >> 8;
+    }
+    std::set<int> expected = {ins.clocks};
+    if (ins.branchClocks) expected.insert(ins.branchClocks);
+    std::set<int> actual;
+    bool known = true;
+    bool sizeOK = true;
+    const unsigned short counters[] = {0x0001, 0x0100, 0x0202}; // BC: the end of LDIR (B: INIR), or the repeat
+    for (int flags = 0; flags < 2; flags++) {
+        for (unsigned short counter : counters) {
+            unsigned char image[8];
+            memcpy(image, &machine.ram[addr], sizeof(image));
+            memset(&machine.z80.reg, 0, sizeof(machine.z80.reg));
+            memcpy(&machine.ram[addr], image, sizeof(image));
+            machine.z80.reg.pair.F = flags ? 0xFF : 0x00;
+            machine.z80.reg.pair.A = 0x55;
+            machine.z80.reg.pair.B = counter >> 8;
+            machine.z80.reg.pair.C = counter & 0xFF;
+            machine.z80.reg.pair.DE = 0x4000;
+            machine.z80.reg.pair.HL = next;
+            machine.z80.reg.IX = next;
+            machine.z80.reg.IY = next;
+            machine.z80.reg.SP = 0xF000;
+            machine.ram[0xF000] = next & 0xFF;
+            machine.ram[0xF001] = next >> 8;
+            machine.z80.reg.PC = addr;
+            int clocks;
+            try {
+                clocks = machine.z80.execute(1);
+            } catch (std::runtime_error& error) {
+                known = false;
+                break;
+            }
+            actual.insert(clocks);
+            // the block instruction stays at addr while repeating
+            sizeOK &= machine.z80.reg.PC == next || (machine.z80.reg.PC == addr && clocks == ins.branchClocks);
+        }
+    }
+    if (!known) {
+        if (!ins.mnemonic && 1 == ins.length) return true;
+        printf("unknown: %02X %02X %02X %02X ... %s\n", opcode[0], opcode[1], opcode[2], opcode[3], text);
+        return false;
+    }
+    if (ins.mnemonic && sizeOK && actual == expected) return true;
+    printf("NG: %02X %02X %02X %02X ... %s (length=%d, clocks=%d/%d, actual=%d/%d)\n", opcode[0], opcode[1], opcode[2], opcode[3], text,
+           ins.length, ins.clocks, ins.branchClocks, *actual.begin(), *actual.rbegin());
+    return false;
+}
+
+int main()
+{
+    const struct {
+        const char* name;
+        unsigned char prefix[2];
+        size_t prefixLength;
+    } tables[] = {
+        {"unprefixed", {}, 0},
+        {"CB", {0xCB}, 1},
+        {"ED", {0xED}, 1},
+        {"DD", {0xDD}, 1},
+        {"FD", {0xFD}, 1},
+        {"DD CB", {0xDD, 0xCB}, 2},
+        {"FD CB", {0xFD, 0xCB}, 2},
+    };
+    for (auto& table : tables) {
+        int known = 0;
+        bool ok = true;
+        for (int op = 0; op < 256; op++) {
+            unsigned char opcode[4] = {0, 0, 0, 0};
+            memcpy(opcode, table.prefix, table.prefixLength);
+            if (2 == table.prefixLength) {
+                opcode[3] = (unsigned char)op; // DD CB d op
+            } else {
+                opcode[table.prefixLength] = (unsigned char)op;
+            }
+            bool prefix = 0 == table.prefixLength && (0xCB == op || 0xDD == op || 0xED == op || 0xFD == op);
+            bool indexCB = 1 == table.prefixLength && 0xCB == op && (0xDD == table.prefix[0] || 0xFD == table.prefix[0]);
+            if (prefix || indexCB) continue; // decoded by the other table
+            ok &= check(opcode, 2 == table.prefixLength ? 4 : table.prefixLength + 1);
+            Z80::Instruction ins = Z80::decode(opcode, sizeof(opcode), 0x8000);
+            if (ins.mnemonic) known++;
+        }
+        printf("%-10s: %3d instructions ... %s\n", table.name, known, ok ? "OK" : "NG");
+        if (!ok) return -1;
+    }
+
+    // disassemble the buffer (without the memory of the CPU)
+    const unsigned char prg[] = {
+        0x21, 0x00, 0x80,       // LD HL, $8000
+        0xDD, 0x21, 0x00, 0x90, // LD IX, $9000
+        0xDB, 0x10,             // IN A, ($10)
+        0x86,                   // ADD A, (HL)
+        0xDD, 0x77, 0xFB,       // LD (IX-$05), A
+        0xFD, 0x36, 0x05, 0x12, // LD (IY+$05), $12
+        0xDD, 0xCB, 0x05, 0xC6, // SET 0, (IX+$05)
+        0xFD, 0xCB, 0x7F, 0x16, // RL (IY+$7F)
+        0xDD, 0x7C,             // LD A, IXH
+        0xED, 0xB0,             // LDIR
+        0x10, 0xE9,             // DJNZ $0108
+        0xC4, 0x34, 0x12,       // CALL NZ, $1234
+        0xED, 0x00,             // DB $ED (unknown), NOP
+        0x01, 0x34,             // DB $01 (truncated), INC (HL)
+    };
+    char text[80];
+    char memoryText[80];
+    memset(machine.ram, 0, sizeof(machine.ram));
+    memcpy(&machine.ram[0x100], prg, sizeof(prg));
+    for (size_t offset = 0; offset < sizeof(prg);) {
+        Z80::Instruction ins = Z80::decode(&prg[offset], sizeof(prg) - offset, (unsigned short)(0x100 + offset));
+        Z80::disassemble(ins, text, sizeof(text));
+        printf("%04X %-16s (%d bytes, %d/%d clocks)\n", ins.addr, text, ins.length, ins.clocks, ins.branchClocks);
+        // the same text from the memory (except the truncated one)
+        int length = machine.z80.disassemble(ins.addr, memoryText, sizeof(memoryText));
+        if (ins.length == length && strcmp(text, memoryText) && offset + 4 <= sizeof(prg)) return -1;
+        offset += ins.length;
+    }
+
+    // the text is truncated to the buffer
+    size_t length = Z80::disassemble(Z80::decode(prg, sizeof(prg), 0x100), text, 4);
+    printf("truncated: \"%s\" (%d)\n", text, (int)length);
+    return 0;
+}
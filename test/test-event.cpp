@@ -0,0 +1,89 @@
+#include "z80.hpp"
+
+// the timer interrupts every 1000Hz by the event (fast: HALT and idle loops are skipped, slow: every NOP and iteration is executed)
+struct Machine {
+    unsigned char ram[0x10000];
+    int count;
+    unsigned long long sum;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0xED, 0x56, // IM 1
+            0xFB,       // EI
+            0x06, 0x00, // LD B, $00
+            0x10, 0xFE, // DJNZ $
+            0x76,       // HALT
+            0x18, 0xFE, // JR $
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        ram[0x38] = 0x3C; // INC A
+        ram[0x39] = 0xFB; // EI
+        ram[0x3A] = 0xC9; // RET
+        count = 0;
+        sum = 0;
+        z80.scheduleEvent(1000, timer);
+    }
+
+    static void timer(void* arg, unsigned long long clocks)
+    {
+        Machine* m = (Machine*)arg;
+        m->count++;
+        m->sum += m->z80.getTotalClocks();
+        m->z80.generateIRQ(0);
+        if (m->count < 30) {
+            m->z80.scheduleEvent(clocks + 1000, timer);
+        } else {
+            m->z80.requestBreak();
+        }
+    }
+
+    void print(const char* name)
+    {
+        printf("%s: count=%d, sum=%llu, total=%llu, A=$%02X, B=$%02X, PC=$%04X, R=$%02X\n",
+               name, count, sum, z80.getTotalClocks(), z80.reg.pair.A, z80.reg.pair.B, z80.reg.PC, z80.reg.R);
+    }
+};
+
+static Machine fast;
+static Machine slow;
+static Machine budget;
+
+int main()
+{
+    fast.z80.mapMemory(0x0000, 0x10000, fast.ram);
+    fast.z80.execute();
+    fast.print("fast");
+
+    slow.z80.setConsumeClockCallback([](void* arg, int clocks) {});
+    slow.z80.execute();
+    slow.print("slow");
+
+    budget.z80.mapMemory(0x0000, 0x10000, budget.ram);
+    int calls = 0;
+    while (budget.count < 30) {
+        budget.z80.execute(777);
+        calls++;
+    }
+    budget.print("budget");
+
+    // cancel the event
+    unsigned long long id = budget.z80.scheduleEvent(budget.z80.getTotalClocks() + 10, [](void* arg, unsigned long long clocks) {
+        ((Machine*)arg)->count = -1;
+    });
+    bool canceled = budget.z80.cancelEvent(id) && !budget.z80.cancelEvent(id);
+    budget.z80.execute(100);
+    printf("cancel: %s\n", canceled && 30 == budget.count ? "OK" : "NG");
+
+    // NOTE: consumeClockCounter is the work area of execute() (not the state of the CPU)
+    fast.z80.reg.consumeClockCounter = 0;
+    slow.z80.reg.consumeClockCounter = 0;
+    bool same = fast.sum == slow.sum && fast.z80.getTotalClocks() == slow.z80.getTotalClocks();
+    same &= 0 == memcmp(&fast.z80.reg, &slow.z80.reg, sizeof(fast.z80.reg));
+    return same && canceled ? 0 : -1;
+}
@@ -0,0 +1,54 @@
+#include "z80farm.hpp"
+
+// sum 1..N (N = 100 + index * 37) on each instance and compare with the sequential execution of the same jobs
+static const unsigned char prg[] = {
+    0x21, 0x00, 0x00, // LD HL, $0000
+    0xED, 0x4B, 0x00, 0x80, // LD BC, ($8000)
+    0x09,             // loop: ADD HL, BC
+    0x0B,             // DEC BC
+    0x78,             // LD A, B
+    0xB1,             // OR C
+    0x20, 0xFA,       // JR NZ, loop
+    0x22, 0x02, 0x80, // LD ($8002), HL
+    0x7D,             // LD A, L
+    0xD3, 0x01,       // OUT ($01), A (break)
+    0x76,             // HALT
+};
+
+static void load(Z80Farm::Instance& instance)
+{
+    instance.reset(prg, sizeof(prg));
+    unsigned short n = (unsigned short)(100 + instance.index * 37);
+    instance.ram[0x8000] = n & 0xFF;
+    instance.ram[0x8001] = n >> 8;
+    instance.out = [](Z80Farm::Instance& i, unsigned short port, unsigned char value) { i.z80.requestBreak(); };
+}
+
+int main()
+{
+    const size_t count = 64;
+    Z80Farm farm(count, 4);
+    Z80Farm expect(count, 1);
+    unsigned short results[count];
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < count; i++) {
+            load(farm[i]);
+            load(expect[i]);
+            farm.submit(i, 0x7FFFFFFF, [&results](Z80Farm::Instance& instance) {
+                results[instance.index] = (unsigned short)(instance.ram[0x8002] | instance.ram[0x8003] << 8);
+            });
+            expect.submit(i, 0x7FFFFFFF);
+        }
+        farm.run();
+        expect.run();
+        bool same = true;
+        for (size_t i = 0; i < count; i++) {
+            same &= farm[i].executed == expect[i].executed && 0 == memcmp(&farm[i].z80.reg, &expect[i].z80.reg, sizeof(farm[i].z80.reg));
+            same &= results[i] == (unsigned short)(expect[i].ram[0x8002] | expect[i].ram[0x8003] << 8);
+        }
+        printf("round %d: %s (#0: sum=%d, %llu clocks / #63: sum=%d, %llu clocks)\n", round, same ? "OK" : "NG",
+               results[0], farm[0].executed, results[count - 1], farm[count - 1].executed);
+        if (!same) return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include "z80.hpp"
+
+struct Machine {
+    unsigned char ram[0x10000];
+    int callbackCount;
+    int callbackClocks;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0xED, 0x56, // IM 1
+            0xFB,       // EI
+            0x76,       // HALT
+            0x18, 0xFC, // JR -4
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        ram[0x38] = 0x3C; // INC A
+        ram[0x39] = 0xFB; // EI
+        ram[0x3A] = 0xC9; // RET
+        callbackCount = 0;
+        callbackClocks = 0;
+    }
+
+    void run(const char* name)
+    {
+        int clocks = z80.execute(1000);
+        clocks += z80.execute(1001);
+        z80.generateIRQ(0);
+        clocks += z80.execute(100);
+        printf("%s: clocks=%d, A=$%02X, PC=$%04X, R=$%02X, SP=$%04X, callback=%d times (%d clocks)\n",
+               name, clocks, z80.reg.pair.A, z80.reg.PC, z80.reg.R, z80.reg.SP, callbackCount, callbackClocks);
+    }
+};
+
+int main()
+{
+    // skip HALT (no consumeClock callback)
+    Machine skip;
+    skip.run("skip");
+
+    // execute each NOP in HALT (consumeClock callback)
+    Machine step;
+    step.z80.setConsumeClockCallback([](void* arg, int clocks) {
+        ((Machine*)arg)->callbackCount++;
+        ((Machine*)arg)->callbackClocks += clocks;
+    });
+    step.run("step");
+
+    // skip HALT and notify the skipped clocks to the consumeClock callback at once
+    Machine aggregate;
+    aggregate.z80.setConsumeClockCallback([](void* arg, int clocks) {
+        ((Machine*)arg)->callbackCount++;
+        ((Machine*)arg)->callbackClocks += clocks;
+    });
+    aggregate.z80.setAggregateHaltClocks(true);
+    aggregate.run("aggregate");
+
+    // execute() returns when nothing can release HALT
+    Machine halt;
+    halt.ram[2] = 0xF3; // DI
+    halt.z80.execute();
+    printf("execute: PC=$%04X, R=$%02X, HALT=%s\n", halt.z80.reg.PC, halt.z80.reg.R, halt.z80.reg.IFF & 0x80 ? "YES" : "NO");
+
+    bool same = skip.z80.reg.R == step.z80.reg.R && skip.z80.reg.PC == step.z80.reg.PC && aggregate.z80.reg.R == step.z80.reg.R;
+    return same && step.callbackClocks == aggregate.callbackClocks ? 0 : -1;
+}
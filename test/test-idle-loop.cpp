@@ -0,0 +1,90 @@
+#include "z80.hpp"
+
+// run the same program on the mapped memory (idle loops are skipped) and via the callbacks (every iteration is executed)
+struct Machine {
+    unsigned char ram[0x10000];
+    unsigned char input;
+    bool halt;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return ((Machine*)arg)->input; },
+                    [](void* arg, unsigned short port, unsigned char value) {
+                        ((Machine*)arg)->halt = true;
+                        ((Machine*)arg)->z80.requestBreak();
+                    },
+                    this)
+    {
+        halt = false;
+    }
+};
+
+static Machine fast;
+static Machine slow;
+
+static bool test(const char* name, const unsigned char* prg, size_t size, int budget)
+{
+    memset(fast.ram, 0, sizeof(fast.ram));
+    memcpy(fast.ram, prg, size);
+    fast.ram[0x38] = 0xD3; // OUT ($00), A
+    memcpy(slow.ram, fast.ram, sizeof(fast.ram));
+    fast.z80.initialize();
+    slow.z80.initialize();
+    fast.z80.mapMemory(0x0000, 0x10000, fast.ram);
+    // the port keeps the value while executing (it is changed only between the executions)
+    fast.z80.setPortStableCallback([](void* arg, unsigned short port) { return 0x7FFFFFFF; });
+    fast.halt = false;
+    slow.halt = false;
+    fast.input = 0;
+    slow.input = 0;
+    int clocks = 0;
+    int calls = 0;
+    bool same = true;
+    while ((!fast.halt || !slow.halt) && calls < 1000) {
+        int f = fast.z80.execute(budget);
+        int s = slow.z80.execute(budget);
+        same &= f == s && 0 == memcmp(&fast.z80.reg, &slow.z80.reg, sizeof(fast.z80.reg));
+        clocks += f;
+        calls++;
+        if (5 == calls) {
+            fast.input = 0x01;
+            slow.input = 0x01;
+            fast.z80.generateIRQ(0);
+            slow.z80.generateIRQ(0);
+        }
+    }
+    printf("%s (budget=%d): %s ... clocks=%d, calls=%d, AF=$%04X, BC=$%04X, PC=$%04X, R=$%02X\n",
+           name, budget, same ? "OK" : "NG", clocks, calls,
+           fast.z80.reg.pair.AF, fast.z80.reg.pair.BC, fast.z80.reg.PC, fast.z80.reg.R);
+    return same;
+}
+
+int main()
+{
+    const unsigned char jr[] = {
+        0xED, 0x56, // IM 1
+        0xFB,       // EI
+        0x18, 0xFE, // JR $ (until the interrupt)
+    };
+    const unsigned char djnz[] = {
+        0x06, 0x00, // LD B, $00
+        0x10, 0xFE, // DJNZ $ (256 times)
+        0x06, 0x07, // LD B, $07
+        0x10, 0xFE, // DJNZ $ (7 times)
+        0xD3, 0x00, // OUT ($00), A
+    };
+    const unsigned char polling[] = {
+        0xDB, 0x10, // IN A, ($10)
+        0xE6, 0x01, // AND $01
+        0x28, 0xFA, // JR Z, $-4 (until the port is changed)
+        0xD3, 0x00, // OUT ($00), A
+    };
+    const int budgets[] = {1, 12, 100, 1000, 0x7FFFFFFF};
+    bool result = true;
+    for (auto budget : budgets) {
+        if (0x7FFFFFFF != budget) result &= test("JR $", jr, sizeof(jr), budget);
+        result &= test("DJNZ $", djnz, sizeof(djnz), budget);
+        if (0x7FFFFFFF != budget) result &= test("polling", polling, sizeof(polling), budget);
+    }
+    return result ? 0 : -1;
+}
@@ -0,0 +1,42 @@
+#include "z80.hpp"
+
+// attach and detach the break point and the debug message while executing (execute switches the loop)
+int main()
+{
+    unsigned char ram[0x100];
+    memset(ram, 0, sizeof(ram));
+    const unsigned char prg[] = {
+        0x3C,       // INC A
+        0xD3, 0x00, // OUT ($00), A
+        0x18, 0xFB, // JR $0000
+    };
+    memcpy(ram, prg, sizeof(prg));
+    Z80 z80([](void* arg, unsigned short addr) {
+        return (unsigned char)0x00;
+    }, [](void* arg, unsigned short addr, unsigned char value) {
+    }, [](void* arg, unsigned short port) {
+        return (unsigned char)0x00;
+    }, [](void* arg, unsigned short port, unsigned char value) {
+        Z80* z = (Z80*)arg;
+        printf("OUT: %d\n", value);
+        switch (value) {
+            case 3:
+                z->addBreakPoint(0x0003, [](void* a) { printf("break point: A=%d\n", ((Z80*)a)->reg.pair.A); });
+                break;
+            case 5:
+                z->removeAllBreakPoints();
+                z->setDebugMessage([](void* a, const char* msg) { puts(msg); });
+                break;
+            case 6:
+                z->resetDebugMessage();
+                break;
+            case 8:
+                z->requestBreak();
+                break;
+        }
+    }, &z80);
+    z80.mapMemory(0x0000, sizeof(ram), ram);
+    z80.reg.pair.A = 0;
+    z80.execute();
+    return 8 == z80.reg.pair.A ? 0 : -1;
+}
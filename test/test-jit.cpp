@@ -0,0 +1,95 @@
+#include "z80.hpp"
+
+// the output must be same with and without Z80_JIT (test-jit.txt is written by the interpreter)
+static unsigned char ram[0x10000];
+
+static void dump(const char* title, Z80& z80)
+{
+    printf("%s: %llu clocks, PC=$%04X, AF=$%04X, BC=$%04X, DE=$%04X, HL=$%04X, SP=$%04X, BC'=$%04X, DE'=$%04X, HL'=$%04X, R=$%02X\n",
+           title, z80.getTotalClocks(), z80.reg.PC, z80.reg.pair.AF, z80.reg.pair.BC, z80.reg.pair.DE, z80.reg.pair.HL, z80.reg.SP,
+           z80.reg.back.BC, z80.reg.back.DE, z80.reg.back.HL, z80.reg.R);
+}
+
+int main()
+{
+    const unsigned char handler[] = {
+        0xD9,             // EXX
+        0x21, 0x00, 0x81, // LD HL, $8100
+        0x34,             // INC (HL)
+        0xD9,             // EXX
+        0xFB,             // EI
+        0xC9,             // RET
+    };
+    const unsigned char prg[] = {
+        0x31, 0x00, 0xF0,                         // LD SP, $F000
+        0xED, 0x56,                               // IM 1
+        0xFB,                                     // EI
+        0x01, 0x34, 0x12,                         // loop: LD BC, $1234
+        0x11, 0x78, 0x56,                         // LD DE, $5678
+        0x21, 0xBC, 0x9A,                         // LD HL, $9ABC
+        0x03,                                     // INC BC
+        0x1B,                                     // DEC DE
+        0x23,                                     // INC HL
+        0x33,                                     // INC SP
+        0x3B,                                     // DEC SP
+        0x06, 0x11,                               // LD B, $11
+        0x0E, 0x22,                               // LD C, $22
+        0x16, 0x33,                               // LD D, $33
+        0x1E, 0x44,                               // LD E, $44
+        0x26, 0x55,                               // LD H, $55
+        0x2E, 0x66,                               // LD L, $66
+        0x3E, 0x77,                               // LD A, $77 (the immediate value is rewritten below)
+        0x41, 0x4A, 0x53, 0x5C, 0x65, 0x6F, 0x78, // LD B, C / LD C, D / LD D, E / LD E, H / LD H, L / LD L, A / LD A, B
+        0xEB,                                     // EX DE, HL
+        0xD9,                                     // EXX
+        0x00,                                     // NOP (rewritten to NOP below: invalidates the page)
+        0xF9,                                     // LD SP, HL
+        0x31, 0x00, 0xF0,                         // LD SP, $F000
+        0x80,                                     // ADD A, B
+        0x32, 0x21, 0x01,                         // LD ($0121), A
+        0x2A, 0x02, 0x80,                         // LD HL, ($8002)
+        0x23,                                     // INC HL
+        0x22, 0x02, 0x80,                         // LD ($8002), HL
+        0xAF,                                     // XOR A
+        0x32, 0x2B, 0x01,                         // LD ($012B), A
+        0xC3, 0xFE, 0x01,                         // JP $01FE
+    };
+    const unsigned char cross[] = {
+        0x01, 0xAA, 0xBB, // $01FE: LD BC, $BBAA (the immediate value crosses the page)
+        0x06, 0x5A,       // LD B, $5A
+        0xC3, 0x06, 0x01, // JP loop
+    };
+    memcpy(&ram[0x0038], handler, sizeof(handler));
+    memcpy(&ram[0x0100], prg, sizeof(prg));
+    memcpy(&ram[0x01FE], cross, sizeof(cross));
+    Z80 z80([](void* arg, unsigned short addr) { return (unsigned char)0x00; },
+            [](void* arg, unsigned short addr, unsigned char value) {},
+            [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+            [](void* arg, unsigned short port, unsigned char value) {},
+            &z80);
+    z80.mapMemory(0x0000, sizeof(ram), ram);
+    z80.reg.PC = 0x0100;
+    static int events = 0;
+    static void (*timer)(void*, unsigned long long) = [](void* arg, unsigned long long clocks) {
+        Z80* cpu = (Z80*)arg;
+        if (0 == events++ % 8) dump("event", *cpu);
+        cpu->generateIRQ(0);
+        cpu->scheduleEvent(clocks + 997, timer);
+    };
+    z80.scheduleEvent(500, timer);
+
+    // the pure operands run at once only while nobody can observe each of them
+    int executed = 0;
+    for (int i = 0; i < 300; i++) executed += z80.execute(37 + i * 7 % 211);
+    dump("no wait", z80);
+
+    // with the wait clocks
+    z80.wtc.fetch = 1;
+    z80.wtc.fetchM = 1;
+    z80.wtc.read = 2;
+    z80.wtc.write = 1;
+    for (int i = 0; i < 300; i++) executed += z80.execute(41 + i * 13 % 227);
+    dump("wait", z80);
+    printf("executed = %d, ($0121) = $%02X, ($8002) = $%02X%02X, ($8100) = $%02X, events = %d\n", executed, ram[0x0121], ram[0x8003], ram[0x8002], ram[0x8100], events);
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "z80.hpp"
+
+// the break points and the break operands removed by their own callbacks (one-shot)
+int main()
+{
+    static unsigned char ram[0x10000];
+    Z80 z80([](void* arg, unsigned short addr) { return ram[addr]; },
+            [](void* arg, unsigned short addr, unsigned char value) { ram[addr] = value; },
+            [](void* arg, unsigned short port) { return (unsigned char)0xFF; },
+            [](void* arg, unsigned short port, unsigned char value) {},
+            &z80);
+    const unsigned char prg[] = {
+        0x00,             // $0000: NOP
+        0x00,             // $0001: NOP
+        0xC3, 0x00, 0x00, // $0002: JP $0000
+    };
+    memcpy(ram, prg, sizeof(prg));
+    int hits[3] = {0, 0, 0};
+
+    // removes itself and the next one at the same address (the next one is not called)
+    z80.addBreakPoint(0x0000, [&](void* arg) {
+        hits[0]++;
+        ((Z80*)arg)->removeBreakPoint(0x0000);
+    });
+    z80.addBreakPoint(0x0000, [&](void* arg) { hits[1]++; });
+
+    // re-adds itself at the other address
+    z80.addBreakPoint(0x0001, [&](void* arg) {
+        hits[2]++;
+        ((Z80*)arg)->removeAllBreakPoints();
+        ((Z80*)arg)->addBreakPoint(0x0002, [&](void* arg2) { hits[2] += 10; });
+    });
+    z80.execute(100);
+    printf("hits: %d, %d, %d\n", hits[0], hits[1], hits[2]);
+    if (1 != hits[0] || 0 != hits[1] || hits[2] < 2 || 1 != hits[2] % 10) return -1;
+
+    // the break operand of JP removes all of them (the second one is not called)
+    int operandHits[2] = {0, 0};
+    z80.addBreakOperand(0xC3, [&](void* arg, unsigned char* opcode, int opcodeLength) {
+        operandHits[0]++;
+        ((Z80*)arg)->removeAllBreakOperands();
+    });
+    z80.addBreakOperand(0xC3, [&](void* arg, unsigned char* opcode, int opcodeLength) { operandHits[1]++; });
+    z80.execute(100);
+    printf("operand hits: %d, %d\n", operandHits[0], operandHits[1]);
+    return 1 == operandHits[0] && 0 == operandHits[1] ? 0 : -1;
+}
@@ -0,0 +1,33 @@
+#include "z80.hpp"
+
+int main()
+{
+    unsigned char ram[0x100];
+    unsigned char rom[0x100];
+    memset(ram, 0, sizeof(ram));
+    memset(rom, 0xEE, sizeof(rom));
+    const unsigned char prg[] = {
+        0x3A, 0x00, 0x90, // LD A, ($9000) ... MMIO (via callback)
+        0x32, 0x80, 0x00, // LD ($0080), A ... RAM (direct)
+        0x32, 0x00, 0x80, // LD ($8000), A ... ROM (write via callback)
+        0x3A, 0x01, 0x80, // LD A, ($8001) ... ROM (direct)
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    memcpy(ram, prg, sizeof(prg));
+    Z80 z80([](void* arg, unsigned short addr) {
+        printf("callback: read ($%04X)\n", addr);
+        return 0x55;
+    }, [](void* arg, unsigned short addr, unsigned char value) {
+        printf("callback: write ($%04X) <- $%02X\n", addr, value);
+    }, [](void* arg, unsigned short port) {
+        return 0x00;
+    }, [](void* arg, unsigned short port, unsigned char value) {
+        ((Z80*)arg)->requestBreak();
+    }, &z80);
+    z80.mapMemory(0x0000, sizeof(ram), ram);
+    z80.mapMemory(0x8000, sizeof(rom), rom, true, false);
+    z80.setDebugMessage([](void* arg, const char* msg) { puts(msg); });
+    z80.execute(0x7FFFFFFF);
+    printf("RAM($0080) = $%02X, A = $%02X\n", ram[0x80], z80.reg.pair.A);
+    return ram[0x80] == 0x55 && z80.reg.pair.A == 0xEE ? 0 : -1;
+}
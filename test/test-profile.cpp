@@ -0,0 +1,82 @@
+#include "z80profile.hpp"
+
+// profile the program, and check the counters with the instruction table
+int main()
+{
+    static unsigned char ram[0x10000];
+    Z80 z80([](void* arg, unsigned short addr) { return ram[addr]; },
+            [](void* arg, unsigned short addr, unsigned char value) { ram[addr] = value; },
+            [](void* arg, unsigned short port) { return (unsigned char)0xFF; },
+            [](void* arg, unsigned short port, unsigned char value) {},
+            nullptr);
+    const unsigned char prg[] = {
+        0x31, 0x00, 0xF0, // LD SP, $F000
+        0x06, 0x0A,       // LD B, 10
+        0xC5,             // loop: PUSH BC
+        0x21, 0x00, 0x80, // LD HL, $8000
+        0x11, 0x00, 0x90, // LD DE, $9000
+        0x01, 0x04, 0x00, // LD BC, 4
+        0xED, 0xB0,       // LDIR
+        0xC1,             // POP BC
+        0x78,             // LD A, B
+        0xFE, 0x05,       // CP 5
+        0xCC, 0x1B, 0x00, // CALL Z, sub
+        0x10, 0xEB,       // DJNZ loop
+        0x76,             // HALT
+        0xC9,             // sub: RET
+    };
+    memcpy(ram, prg, sizeof(prg));
+    z80.mapMemory(0x0000, 0x10000, ram);
+
+    Z80Profiler profiler(z80);
+    z80.execute(10000);
+    const Z80::Profile& profile = profiler.get();
+
+    // the clocks of each address are the clocks of the instruction table
+    bool ok = true;
+    for (int addr = 0; addr < 0x10000; addr++) {
+        if (!profile.count[addr]) continue;
+        Z80::Instruction ins = z80.decode((unsigned short)addr);
+        unsigned long long expected = (profile.count[addr] - profile.taken[addr]) * ins.clocks + profile.taken[addr] * ins.branchClocks;
+        ok &= expected == profile.clocks[addr] && profile.count[addr] == profile.taken[addr] + profile.notTaken[addr] + (ins.branchClocks ? 0 : profile.count[addr]);
+    }
+    ok &= 40 == profile.count[0x000F] && 30 == profile.taken[0x000F] && 10 == profile.notTaken[0x000F]; // LDIR
+    ok &= 10 == profile.count[0x0015] && 1 == profile.taken[0x0015] && 9 == profile.notTaken[0x0015];    // CALL Z
+    ok &= 10 == profile.count[0x0018] && 9 == profile.taken[0x0018] && 1 == profile.notTaken[0x0018];    // DJNZ
+    ok &= 1 == profile.count[0x001A] && 1 == profile.count[0x001B];                                       // HALT (not the waiting), RET
+    printf("counters: %s\n", ok ? "OK" : "NG");
+    if (!ok) return -1;
+
+    profiler.report(stdout, 5);
+    profiler.dump(stdout);
+
+    // the counters stop after the profiler
+    unsigned long long total = profiler.getTotalClocks();
+    z80.removeProfile();
+    z80.reg.PC = 0;
+    z80.reg.IFF = 0;
+    z80.execute(10000);
+    bool removed = total == profiler.getTotalClocks();
+    printf("remove: %s\n", removed ? "OK" : "NG");
+    if (!removed) return -1;
+
+    // the memory via the bus: the profiler never reads it (same counters, same reads, and no disassembly)
+    static int reads;
+    Z80 bus([](void* arg, unsigned short addr) { reads++; return ram[addr]; },
+            [](void* arg, unsigned short addr, unsigned char value) { ram[addr] = value; },
+            [](void* arg, unsigned short port) { return (unsigned char)0xFF; },
+            [](void* arg, unsigned short port, unsigned char value) {},
+            nullptr);
+    reads = 0;
+    bus.execute(10000);
+    int expected = reads;
+    bus.reg.PC = 0;
+    bus.reg.IFF = 0;
+    reads = 0;
+    Z80Profiler busProfiler(bus);
+    bus.execute(10000);
+    bool same = expected == reads && 0 == memcmp(&busProfiler.get(), &profile, sizeof(profile));
+    printf("bus: %s (%d reads)\n", same ? "OK" : "NG", reads);
+    busProfiler.report(stdout, 3);
+    return same ? 0 : -1;
+}
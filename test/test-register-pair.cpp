@@ -0,0 +1,46 @@
+#include "z80.hpp"
+
+int main()
+{
+    unsigned char ram[0x100];
+    memset(ram, 0, sizeof(ram));
+    const unsigned char prg[] = {
+        0x01, 0x34, 0x12,       // LD BC, $1234
+        0x11, 0x78, 0x56,       // LD DE, $5678
+        0x21, 0xBC, 0x9A,       // LD HL, $9ABC
+        0xDD, 0x21, 0x22, 0x11, // LD IX, $1122
+        0xFD, 0x21, 0x44, 0x33, // LD IY, $3344
+        0xDD, 0x2C,             // INC IXL
+        0xFD, 0x24,             // INC IYH
+        0x0C,                   // INC C
+        0x14,                   // INC D
+        0xD3, 0x00,             // OUT ($00), A
+    };
+    memcpy(ram, prg, sizeof(prg));
+    Z80 z80([](void* arg, unsigned short addr) {
+        return (unsigned char)0x00;
+    }, [](void* arg, unsigned short addr, unsigned char value) {
+    }, [](void* arg, unsigned short port) {
+        return (unsigned char)0x00;
+    }, [](void* arg, unsigned short port, unsigned char value) {
+        ((Z80*)arg)->requestBreak();
+    }, &z80);
+    z80.mapMemory(0x0000, sizeof(ram), ram);
+    z80.execute(0x7FFFFFFF);
+    printf("BC = $%04X (B = $%02X, C = $%02X)\n", z80.reg.pair.BC, z80.reg.pair.B, z80.reg.pair.C);
+    printf("DE = $%04X (D = $%02X, E = $%02X)\n", z80.reg.pair.DE, z80.reg.pair.D, z80.reg.pair.E);
+    printf("HL = $%04X (H = $%02X, L = $%02X)\n", z80.reg.pair.HL, z80.reg.pair.H, z80.reg.pair.L);
+    printf("IX = $%04X (IXH = $%02X, IXL = $%02X)\n", z80.reg.IX, z80.reg.IXH, z80.reg.IXL);
+    printf("IY = $%04X (IYH = $%02X, IYL = $%02X)\n", z80.reg.IY, z80.reg.IYH, z80.reg.IYL);
+    if (z80.reg.pair.BC != 0x1235 || z80.reg.pair.DE != 0x5778 || z80.reg.IX != 0x1123 || z80.reg.IY != 0x3444) return -1;
+
+    // quick save data of the older versions: A, F, B, C, D, E, H, L
+    const unsigned char legacy[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    memcpy(&z80.reg.pair, legacy, sizeof(legacy));
+    Z80::convertLegacyRegister(&z80.reg);
+    printf("legacy: A = $%02X, F = $%02X, B = $%02X, C = $%02X, D = $%02X, E = $%02X, H = $%02X, L = $%02X\n",
+           z80.reg.pair.A, z80.reg.pair.F, z80.reg.pair.B, z80.reg.pair.C, z80.reg.pair.D, z80.reg.pair.E, z80.reg.pair.H, z80.reg.pair.L);
+    if (z80.reg.pair.AF != 0x0102 || z80.reg.pair.BC != 0x0304 || z80.reg.pair.HL != 0x0708) return -1;
+    Z80::convertLegacyRegister(&z80.reg);
+    return memcmp(&z80.reg.pair, legacy, sizeof(legacy)) == 0 ? 0 : -1;
+}
@@ -0,0 +1,115 @@
+#include "z80.hpp"
+
+// run the same program on the mapped memory (fast path) and via the callbacks (one iteration per dispatch)
+struct Machine {
+    unsigned char ram[0x10000];
+    bool halt;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {
+                        ((Machine*)arg)->halt = true;
+                        ((Machine*)arg)->z80.requestBreak();
+                    },
+                    this)
+    {
+        halt = false;
+    }
+};
+
+static Machine fast;
+static Machine slow;
+
+static bool test(const char* name, const unsigned char* prg, size_t size, int budget)
+{
+    for (int i = 0; i < 0x10000; i++) fast.ram[i] = (unsigned char)(i * 7 + (i >> 8));
+    fast.ram[0x5000] = 0x99;
+    memcpy(fast.ram, prg, size);
+    memcpy(slow.ram, fast.ram, sizeof(fast.ram));
+    fast.z80.initialize();
+    slow.z80.initialize();
+    fast.z80.mapMemory(0x0000, 0x10000, fast.ram);
+    fast.halt = false;
+    slow.halt = false;
+    int fastClocks = 0;
+    int slowClocks = 0;
+    int calls = 0;
+    bool same = true;
+    while (!fast.halt || !slow.halt) {
+        int f = fast.z80.execute(budget);
+        int s = slow.z80.execute(budget);
+        same &= f == s && fast.z80.reg.PC == slow.z80.reg.PC && fast.z80.reg.pair.BC == slow.z80.reg.pair.BC;
+        fastClocks += f;
+        slowClocks += s;
+        calls++;
+    }
+    same &= fastClocks == slowClocks;
+    same &= 0 == memcmp(&fast.z80.reg, &slow.z80.reg, sizeof(fast.z80.reg));
+    same &= 0 == memcmp(fast.ram, slow.ram, sizeof(fast.ram));
+    printf("%s (budget=%d): %s ... clocks=%d, calls=%d, AF=$%04X, BC=$%04X, DE=$%04X, HL=$%04X, WZ=$%04X, R=$%02X\n",
+           name, budget, same ? "OK" : "NG", fastClocks, calls,
+           fast.z80.reg.pair.AF, fast.z80.reg.pair.BC, fast.z80.reg.pair.DE, fast.z80.reg.pair.HL, fast.z80.reg.WZ, fast.z80.reg.R);
+    return same;
+}
+
+int main()
+{
+    const unsigned char ldir[] = {
+        0x21, 0x80, 0x10, // LD HL, $1080
+        0x11, 0x40, 0x20, // LD DE, $2040
+        0x01, 0x00, 0x03, // LD BC, $0300
+        0xED, 0xB0,       // LDIR
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const unsigned char fill[] = {
+        0x21, 0x00, 0x30, // LD HL, $3000
+        0x11, 0x01, 0x30, // LD DE, $3001
+        0x01, 0x00, 0x02, // LD BC, $0200
+        0x36, 0xAA,       // LD (HL), $AA
+        0xED, 0xB0,       // LDIR
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const unsigned char lddr[] = {
+        0x21, 0xFF, 0x40, // LD HL, $40FF
+        0x11, 0x7F, 0x41, // LD DE, $417F
+        0x01, 0x80, 0x01, // LD BC, $0180
+        0xED, 0xB8,       // LDDR
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const unsigned char overwrite[] = {
+        0x21, 0x00, 0x60, // LD HL, $6000 (zero)
+        0x11, 0x00, 0x00, // LD DE, $0000
+        0x01, 0x20, 0x00, // LD BC, $0020
+        0x36, 0x00,       // LD (HL), $00
+        0xED, 0xB0,       // LDIR (overwrites itself with NOP)
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const unsigned char cpir[] = {
+        0x3E, 0x99,       // LD A, $99
+        0x21, 0x00, 0x48, // LD HL, $4800
+        0x01, 0x00, 0x10, // LD BC, $1000
+        0xED, 0xB1,       // CPIR (found at $5000)
+        0xED, 0xB1,       // CPIR (not found until BC = 0)
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const unsigned char cpdr[] = {
+        0x3E, 0x99,       // LD A, $99
+        0x21, 0x80, 0x50, // LD HL, $5080
+        0x01, 0x00, 0x01, // LD BC, $0100
+        0xED, 0xB9,       // CPDR (found at $5000)
+        0xED, 0xB9,       // CPDR (not found until BC = 0)
+        0xD3, 0x00,       // OUT ($00), A
+    };
+    const int budgets[] = {1, 21, 100, 1000, 0x7FFFFFFF};
+    bool result = true;
+    for (auto budget : budgets) {
+        result &= test("LDIR", ldir, sizeof(ldir), budget);
+        result &= test("LDIR (fill)", fill, sizeof(fill), budget);
+        result &= test("LDDR", lddr, sizeof(lddr), budget);
+        result &= test("LDIR (overwrite)", overwrite, sizeof(overwrite), budget);
+        result &= test("CPIR", cpir, sizeof(cpir), budget);
+        result &= test("CPDR", cpdr, sizeof(cpdr), budget);
+    }
+    return result ? 0 : -1;
+}
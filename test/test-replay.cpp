@@ -0,0 +1,100 @@
+#include "z80.hpp"
+
+// record the inputs of the machine with the devices, and replay them on the machine without any device
+struct Machine {
+    unsigned char ram[0x10000];
+    unsigned int seed;
+    int inCount;
+    bool devices;
+    Z80 z80;
+    Machine(bool devices_) : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                                 [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                                 [](void* arg, unsigned short port) { return ((Machine*)arg)->in(port); },
+                                 [](void* arg, unsigned short port, unsigned char value) { ((Machine*)arg)->out(port, value); },
+                                 this)
+    {
+        const unsigned char prg[] = {
+            0xED, 0x56,       // IM 1
+            0xFB,             // EI
+            0xDB, 0x10,       // loop: IN A, ($10)
+            0x86,             // ADD A, (HL)
+            0x77,             // LD (HL), A
+            0x23,             // INC HL
+            0xCB, 0xFC,       // SET 7, H
+            0xD3, 0x20,       // OUT ($20), A
+            0x76,             // HALT
+            0x18, 0xF4,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        ram[0x38] = 0x34; // INC (HL)
+        ram[0x39] = 0xFB; // EI
+        ram[0x3A] = 0xC9; // RET
+        ram[0x66] = 0x2C; // INC L
+        ram[0x67] = 0xED; // RETN
+        ram[0x68] = 0x45;
+        z80.reg.pair.HL = 0x8000;
+        seed = 1;
+        inCount = 0;
+        devices = devices_;
+        z80.mapMemory(0x0000, sizeof(ram), ram); // the reads via the read callback are also inputs (see test-reverse.cpp)
+        z80.addStateMemory(ram, sizeof(ram));
+        if (devices) z80.scheduleEvent(700, timer);
+    }
+
+    unsigned char in(unsigned short port)
+    {
+        inCount++;
+        seed = seed * 1103515245 + 12345;
+        return (unsigned char)(seed >> 16);
+    }
+
+    void out(unsigned short port, unsigned char value)
+    {
+        if (devices && 0x80 <= value) z80.generateIRQ(0); // the device interrupts immediately
+    }
+
+    static void timer(void* arg, unsigned long long clocks)
+    {
+        Machine* m = (Machine*)arg;
+        m->z80.generateIRQ(0);
+        m->z80.scheduleEvent(clocks + 700 + (m->seed & 0xFF), timer);
+    }
+
+    // the host writes the RAM between the execute calls
+    void dma(unsigned short addr, unsigned char value)
+    {
+        z80.recordHostEvent(addr, value);
+        ram[addr] = value;
+    }
+};
+
+int main()
+{
+    static Machine a(true), b(false);
+    static unsigned char state[0x10100];
+    std::vector<unsigned char> log;
+    a.z80.execute(1000);
+    size_t stateSize = a.z80.saveState(state, sizeof(state));
+    a.z80.startRecording(&log);
+    for (int i = 0; i < 200; i++) {
+        a.z80.execute(100 + i * 13 % 500);
+        if (i % 7 == 0) a.dma((unsigned short)(0x8000 + i), (unsigned char)i);
+        if (i % 50 == 10) a.z80.generateNMI(0x0066);
+        if (i % 30 == 20) a.z80.generateIRQ(0);
+        if (i % 30 == 21) a.z80.cancelIRQ();
+    }
+    a.z80.stopRecording();
+    printf("recorded: %d inputs, %llu clocks, %d bytes log\n", a.inCount, a.z80.getTotalClocks(), (int)log.size());
+
+    b.z80.loadState(state, stateSize);
+    b.z80.startReplay(log.data(), log.size(), [](void* arg, unsigned short id, unsigned int value) { ((Machine*)arg)->ram[id] = (unsigned char)value; });
+    while (b.z80.getTotalClocks() < a.z80.getTotalClocks()) {
+        b.z80.execute((int)(a.z80.getTotalClocks() - b.z80.getTotalClocks()) < 3000 ? (int)(a.z80.getTotalClocks() - b.z80.getTotalClocks()) : 3000);
+    }
+    b.z80.stopReplay();
+    bool same = 0 == memcmp(&a.z80.reg, &b.z80.reg, offsetof(Z80::Register, consumeClockCounter)) && 0 == memcmp(a.ram, b.ram, sizeof(a.ram));
+    printf("replayed: %s (in=%d, diverged=%s, total=%llu, HL=$%04X, PC=$%04X)\n", same ? "OK" : "NG", b.inCount,
+           b.z80.isReplayDiverged() ? "true" : "false", b.z80.getTotalClocks(), b.z80.reg.pair.HL, b.z80.reg.PC);
+    return same && 0 == b.inCount && !b.z80.isReplayDiverged() && b.z80.getTotalClocks() == a.z80.getTotalClocks() ? 0 : -1;
+}
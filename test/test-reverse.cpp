@@ -0,0 +1,232 @@
+#include "z80reverse.hpp"
+#include "z80rewind.hpp"
+
+// step back, reverse continue and find the last write on the machine with the devices,
+// and compare with the reference machine executed instruction by instruction
+struct Machine {
+    unsigned char ram[0x10000];
+    unsigned int seed;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return ((Machine*)arg)->in(port); },
+                    [](void* arg, unsigned short port, unsigned char value) { ((Machine*)arg)->out(port, value); },
+                    this)
+    {
+        const unsigned char prg[] = {
+            0xED, 0x56,       // IM 1
+            0xFB,             // EI
+            0xDB, 0x10,       // loop: IN A, ($10)
+            0x86,             // ADD A, (HL)
+            0x77,             // LD (HL), A
+            0x23,             // INC HL
+            0xCB, 0xFC,       // SET 7, H
+            0xE6, 0x1F,       // AND $1F
+            0x20, 0x03,       // JR NZ, skip
+            0x22, 0x00, 0xA0, // LD ($A000), HL (the rare corruption)
+            0xD3, 0x20,       // skip: OUT ($20), A
+            0x18, 0xEE,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        ram[0x38] = 0x34; // INC (HL)
+        ram[0x39] = 0xFB; // EI
+        ram[0x3A] = 0xC9; // RET
+        z80.reg.pair.HL = 0x8000;
+        z80.mapMemory(0x0000, 0x10000, ram);
+        seed = 1;
+        z80.scheduleEvent(700, timer);
+    }
+
+    unsigned char in(unsigned short port)
+    {
+        seed = seed * 1103515245 + 12345;
+        return (unsigned char)(seed >> 16);
+    }
+
+    void out(unsigned short port, unsigned char value)
+    {
+        if (0xF0 <= value) z80.generateIRQ(0);
+    }
+
+    static void timer(void* arg, unsigned long long clocks)
+    {
+        Machine* m = (Machine*)arg;
+        m->z80.generateIRQ(0);
+        m->z80.scheduleEvent(clocks + 700 + (m->seed & 0xFF), timer);
+    }
+};
+
+// the devices via the bus: the counter on the page not mapped (counts up at each read), the write register and the port
+struct Device {
+    unsigned char ram[0x10000];
+    unsigned char counter;
+    int reads;
+    int writes;
+    int outs;
+    Z80 z80;
+    Device() : z80([](void* arg, unsigned short addr) { return ((Device*)arg)->read(addr); },
+                   [](void* arg, unsigned short addr, unsigned char value) { ((Device*)arg)->writes++; },
+                   [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                   [](void* arg, unsigned short port, unsigned char value) { ((Device*)arg)->outs++; },
+                   this)
+    {
+        const unsigned char prg[] = {
+            0x3A, 0x00, 0xF0, // loop: LD A, ($F000)
+            0x77,             // LD (HL), A
+            0x23,             // INC HL
+            0xCB, 0xFC,       // SET 7, H
+            0x32, 0x01, 0xF0, // LD ($F001), A
+            0xD3, 0x20,       // OUT ($20), A
+            0x18, 0xF2,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        counter = 0;
+        reads = 0;
+        writes = 0;
+        outs = 0;
+        z80.reg.pair.HL = 0x8000;
+        z80.mapMemory(0x0000, 0x10000, ram);
+        z80.unmapMemory(0xF000, 0x100);
+    }
+
+    unsigned char read(unsigned short addr)
+    {
+        reads++;
+        return counter++;
+    }
+};
+
+struct Position {
+    unsigned long long clocks;
+    Z80::Register reg;
+    unsigned char a000;
+};
+
+static std::vector<Position> trace;
+
+// execute the reference machine instruction by instruction until the clocks
+static void reference(Machine& m, unsigned long long clocks)
+{
+    while (m.z80.getTotalClocks() < clocks) {
+        m.z80.execute(1);
+        Position p;
+        p.clocks = m.z80.getTotalClocks();
+        memcpy(&p.reg, &m.z80.reg, sizeof(p.reg));
+        p.a000 = m.ram[0xA000];
+        trace.push_back(p);
+    }
+}
+
+static bool at(Machine& m, size_t index)
+{
+    Position& p = trace[index];
+    return p.clocks == m.z80.getTotalClocks() && 0 == memcmp(&p.reg, &m.z80.reg, offsetof(Z80::Register, consumeClockCounter));
+}
+
+int main()
+{
+    static Machine a, b;
+    Z80Reverse debugger(a.z80, 5000);
+    Position start;
+    start.clocks = 0;
+    memcpy(&start.reg, &b.z80.reg, sizeof(start.reg));
+    trace.push_back(start);
+    for (int i = 0; i < 50; i++) debugger.execute(1000 + i * 17);
+    reference(b, a.z80.getTotalClocks());
+    size_t current = trace.size() - 1;
+    bool ok = at(a, current) && 0 == memcmp(a.ram, b.ram, sizeof(a.ram));
+    printf("forward: %s (%llu clocks, %d instructions)\n", ok ? "OK" : "NG", a.z80.getTotalClocks(), (int)current);
+    if (!ok) return -1;
+
+    // step back
+    const size_t backs[] = {1, 37, 5000, 1};
+    for (size_t back : backs) {
+        ok = debugger.stepBack(back);
+        current -= back;
+        ok = ok && at(a, current) && debugger.isReplaying();
+        printf("stepBack(%d): %s (PC=$%04X, %llu clocks)\n", (int)back, ok ? "OK" : "NG", a.z80.reg.PC, a.z80.getTotalClocks());
+        if (!ok) return -1;
+    }
+
+    // reverse continue to the interrupt routine
+    debugger.addBreakPoint(0x0038);
+    size_t hit = current - 1;
+    while (0x0038 != trace[hit].reg.PC) hit--;
+    ok = debugger.reverseContinue() && at(a, hit);
+    current = hit;
+    printf("reverseContinue: %s (PC=$%04X, %llu clocks)\n", ok ? "OK" : "NG", a.z80.reg.PC, a.z80.getTotalClocks());
+    if (!ok) return -1;
+    debugger.step();
+    ok = debugger.reverseContinue() && at(a, hit);
+    debugger.removeAllBreakPoints();
+    if (!ok) return -1;
+
+    // the last write to $A000
+    size_t write = current;
+    while (trace[write - 1].a000 == trace[current].a000) write--;
+    unsigned long long clocks = 0;
+    unsigned short pc = 0;
+    ok = debugger.findLastWrite(0xA000, &clocks, &pc) && clocks == trace[write - 1].clocks && pc == trace[write - 1].reg.PC && at(a, current);
+    printf("findLastWrite($A000): %s (PC=$%04X, %llu clocks, value=$%02X)\n", ok ? "OK" : "NG", pc, clocks, trace[write].a000);
+    if (!ok) return -1;
+
+    // forward by the replay to the frontier, and then with the devices
+    unsigned long long frontier = debugger.getFrontier();
+    debugger.execute((int)(frontier - a.z80.getTotalClocks()));
+    ok = !debugger.isReplaying() && at(a, trace.size() - 1);
+    for (int i = 0; i < 10; i++) debugger.execute(3000);
+    reference(b, a.z80.getTotalClocks());
+    ok = ok && at(a, trace.size() - 1) && 0 == memcmp(a.ram, b.ram, sizeof(a.ram));
+    printf("continue: %s (%llu clocks)\n", ok ? "OK" : "NG", a.z80.getTotalClocks());
+    if (!ok) return -1;
+
+    // Z80Rewind on the same instance (the snapshots of the debugger keep the written pages for the deltas)
+    static Machine c;
+    static unsigned char frames[10][0x10000];
+    static Z80::Register regs[10];
+    Z80Reverse debugger2(c.z80, 3000);
+    Z80Rewind rewind(c.z80, 0x100000, 100);
+    for (int i = 0; i < 10; i++) {
+        debugger2.execute(5000);
+        if (5 == i) debugger2.stepBack(50);
+        rewind.checkpoint();
+        memcpy(frames[i], c.ram, sizeof(c.ram));
+        memcpy(&regs[i], &c.z80.reg, sizeof(regs[i]));
+    }
+    for (int frame : {6, 2}) {
+        ok = ok && rewind.rewind(rewind.size() - 1 - (size_t)frame);
+        ok = ok && 0 == memcmp(frames[frame], c.ram, sizeof(c.ram)) && 0 == memcmp(&regs[frame], &c.z80.reg, offsetof(Z80::Register, consumeClockCounter));
+    }
+    printf("with Z80Rewind: %s\n", ok ? "OK" : "NG");
+    if (!ok) return -1;
+
+    // the devices are never called while going back (the reads of the counter are replayed from the log)
+    static Device d, e;
+    std::vector<Position> positions;
+    Z80Reverse debugger3(d.z80, 2000);
+    debugger3.execute(10000);
+    int reads = d.reads;
+    int writes = d.writes;
+    int outs = d.outs;
+    while (e.z80.getTotalClocks() < d.z80.getTotalClocks()) {
+        e.z80.execute(1);
+        Position p;
+        p.clocks = e.z80.getTotalClocks();
+        memcpy(&p.reg, &e.z80.reg, sizeof(p.reg));
+        positions.push_back(p);
+    }
+    ok = debugger3.stepBack(300);
+    Position& back = positions[positions.size() - 301];
+    ok = ok && back.clocks == d.z80.getTotalClocks() && 0 == memcmp(&back.reg, &d.z80.reg, offsetof(Z80::Register, consumeClockCounter));
+    ok = ok && debugger3.findLastWrite(0x8010, nullptr, &pc) && 0x0003 == pc;
+    debugger3.execute((int)(debugger3.getFrontier() - d.z80.getTotalClocks()));
+    ok = ok && !debugger3.isReplaying() && reads == d.reads && writes == d.writes && outs == d.outs;
+    for (int i = 0; i < 5; i++) debugger3.execute(2000);
+    while (e.z80.getTotalClocks() < d.z80.getTotalClocks()) e.z80.execute(1);
+    ok = ok && e.z80.getTotalClocks() == d.z80.getTotalClocks() && 0 == memcmp(&e.z80.reg, &d.z80.reg, offsetof(Z80::Register, consumeClockCounter));
+    ok = ok && 0 == memcmp(d.ram, e.ram, sizeof(d.ram)) && e.reads == d.reads && e.writes == d.writes && e.outs == d.outs;
+    printf("devices: %s (%d reads, %d writes, %d outs)\n", ok ? "OK" : "NG", d.reads, d.writes, d.outs);
+    return ok ? 0 : -1;
+}
@@ -0,0 +1,179 @@
+#include "z80rewind.hpp"
+
+// checkpoint every frame into the small ring, and rewind to the frames compared with the full copies
+struct Machine {
+    unsigned char ram[0x10000];
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0x21, 0x00, 0x80, // LD HL, $8000
+            0x11, 0x00, 0x90, // LD DE, $9000
+            0x86,             // loop: ADD A, (HL)
+            0x77,             // LD (HL), A
+            0x2C,             // INC L
+            0x12,             // LD (DE), A
+            0x13,             // INC DE
+            0xCB, 0xE2,       // SET 4, D
+            0xCB, 0xAA,       // RES 5, D
+            0x18, 0xF5,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        z80.mapMemory(0x0000, 0x10000, ram);
+    }
+};
+
+struct Frame {
+    Z80::Register reg;
+    unsigned char ram[0x10000];
+};
+
+// bank switched by OUT ($00): the regions of the memory are saved by addStateMemory (the host restores the bank register)
+struct BankMachine {
+    unsigned char ram[0x8000];
+    unsigned char banks[2][0x8000];
+    int bank;
+    Z80 z80;
+    BankMachine() : z80([](void* arg, unsigned short addr) { return (unsigned char)0xFF; },
+                        [](void* arg, unsigned short addr, unsigned char value) {},
+                        [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                        [](void* arg, unsigned short port, unsigned char value) { ((BankMachine*)arg)->switchBank(value & 1); },
+                        this)
+    {
+        const unsigned char prg[] = {
+            0x21, 0x00, 0x80, // LD HL, $8000
+            0x06, 0x00,       // LD B, 0
+            0x34,             // loop: INC (HL)
+            0x2C,             // INC L
+            0x20, 0xFC,       // JR NZ, loop
+            0x04,             // INC B
+            0x78,             // LD A, B
+            0xD3, 0x00,       // OUT ($00), A
+            0x18, 0xF6,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memset(banks, 0, sizeof(banks));
+        memcpy(ram, prg, sizeof(prg));
+        z80.mapMemory(0x0000, 0x8000, ram);
+        switchBank(0);
+        z80.addStateMemory(ram, sizeof(ram));
+        z80.addStateMemory(banks[0], sizeof(banks[0]));
+        z80.addStateMemory(banks[1], sizeof(banks[1]));
+    }
+
+    void switchBank(int n)
+    {
+        bank = n;
+        z80.mapMemory(0x8000, 0x8000, banks[n]);
+    }
+};
+
+struct BankFrame {
+    Z80::Register reg;
+    unsigned char ram[0x8000];
+    unsigned char banks[2][0x8000];
+    int bank;
+
+    void save(BankMachine& m)
+    {
+        memcpy(&reg, &m.z80.reg, sizeof(reg));
+        memcpy(ram, m.ram, sizeof(ram));
+        memcpy(banks, m.banks, sizeof(banks));
+        bank = m.bank;
+    }
+
+    bool equals(BankMachine& m)
+    {
+        bool same = 0 == memcmp(&m.z80.reg, &reg, offsetof(Z80::Register, consumeClockCounter));
+        return same && 0 == memcmp(m.ram, ram, sizeof(ram)) && 0 == memcmp(m.banks, banks, sizeof(banks));
+    }
+};
+
+static bool equals(Machine& m, Frame& f)
+{
+    return 0 == memcmp(&m.z80.reg, &f.reg, offsetof(Z80::Register, consumeClockCounter)) && 0 == memcmp(m.ram, f.ram, sizeof(f.ram));
+}
+
+int main()
+{
+    static Machine m;
+    static Frame frames[100];
+    Z80Rewind rewind(m.z80, 0x30000, 10); // about 3 keyframes of 64KB
+    size_t keySize = m.z80.getSnapshotSize(true);
+    size_t deltaSize = 0;
+    for (int i = 0; i < 100; i++) {
+        m.z80.execute(1000 + i * 7);
+        deltaSize += m.z80.getSnapshotSize(false);
+        if (!rewind.checkpoint()) return -1;
+        memcpy(&frames[i].reg, &m.z80.reg, sizeof(m.z80.reg));
+        memcpy(frames[i].ram, m.ram, sizeof(m.ram));
+    }
+    printf("keyframe: %d bytes, delta: %d bytes (average), checkpoints: %d\n", (int)keySize, (int)(deltaSize / 100), (int)rewind.size());
+    size_t count = rewind.size();
+    if (count < 10 || 30 < count) return -1;
+
+    // step back frame by frame (rewind drops the newer checkpoints)
+    bool same = true;
+    for (int back = 0; back < 5; back++) {
+        same &= rewind.rewind(1);
+        same &= equals(m, frames[98 - back]);
+    }
+    printf("rewind 5 frames: %s (checkpoints: %d, PC=$%04X)\n", same ? "OK" : "NG", (int)rewind.size(), m.z80.reg.PC);
+    if (!same) return -1;
+
+    // execute again from the restored frame (deterministic), and rewind to the oldest one
+    for (int i = 95; i < 100; i++) {
+        m.z80.execute(1000 + i * 7);
+        rewind.checkpoint();
+        same &= equals(m, frames[i]);
+    }
+    size_t oldest = rewind.size() - 1;
+    same &= rewind.rewind(oldest);
+    same &= equals(m, frames[99 - oldest]);
+    same &= !rewind.rewind(1);
+    printf("replay & rewind to the oldest: %s (back=%d, checkpoints: %d)\n", same ? "OK" : "NG", (int)oldest, (int)rewind.size());
+    if (!same) return -1;
+
+    // the banks switched between the keyframe and the deltas are restored to their own memory
+    static BankMachine b;
+    static BankFrame bankFrames[40];
+    Z80Rewind bankRewind(b.z80, 0x100000, 10);
+    for (int i = 0; i < 40; i++) {
+        b.z80.execute(3000 + i * 11);
+        bankRewind.checkpoint();
+        bankFrames[i].save(b);
+    }
+    int frame = 39;
+    for (int back : {3, 7, 12}) {
+        frame -= back;
+        same &= bankRewind.rewind((size_t)back);
+        b.switchBank(bankFrames[frame].bank); // the host restores the mapping
+        same &= bankFrames[frame].equals(b);
+    }
+    printf("rewind the switched banks: %s (checkpoints: %d)\n", same ? "OK" : "NG", (int)bankRewind.size());
+    if (!same) return -1;
+
+    // the memory written by the host (markDirty) and by loadState is in the next delta
+    static BankFrame expected;
+    static unsigned char state[0x20000];
+    size_t stateSize = b.z80.saveState(state, sizeof(state));
+    b.z80.execute(5000);
+    b.z80.loadState(state, stateSize);
+    memset(&b.ram[0x4000], 0x55, 0x100); // ex: a program loader
+    b.z80.markDirty(0x4000, 0x100);
+    bankRewind.checkpoint();
+    expected.save(b);
+    b.z80.execute(5000);
+    bankRewind.checkpoint();
+    memset(&b.ram[0x4000], 0xAA, 0x100);
+    b.z80.markDirty(0x4000, 0x100);
+    same &= bankRewind.rewind(1);
+    same &= expected.equals(b);
+    printf("rewind the host writes: %s\n", same ? "OK" : "NG");
+    return same ? 0 : -1;
+}
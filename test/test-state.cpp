@@ -0,0 +1,93 @@
+#include "z80.hpp"
+
+// save the state in the middle of the execution, and compare the continuation with the loaded instance
+struct Machine {
+    unsigned char ram[0x10000];
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return (unsigned char)0x00; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0xED, 0x56,       // IM 1
+            0xFB,             // EI
+            0x21, 0x00, 0x80, // LD HL, $8000
+            0x86,             // loop: ADD A, (HL)
+            0x77,             // LD (HL), A
+            0x23,             // INC HL
+            0xCB, 0xBC,       // RES 7, H
+            0xCB, 0xFC,       // SET 7, H
+            0x18, 0xF7,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        ram[0x38] = 0x04; // INC B
+        ram[0x39] = 0xFB; // EI
+        ram[0x3A] = 0xC9; // RET
+        z80.wtc.fetch = 1;
+        z80.wtc.read = 2;
+        z80.addStateMemory(ram, sizeof(ram));
+    }
+
+    bool equals(Machine& m)
+    {
+        return 0 == memcmp(&z80.reg, &m.z80.reg, sizeof(z80.reg)) && 0 == memcmp(ram, m.ram, sizeof(ram)) &&
+               z80.getTotalClocks() == m.z80.getTotalClocks();
+    }
+};
+
+int main()
+{
+    static Machine a, b;
+    static unsigned char state[0x10100];
+    printf("state size: %d bytes\n", (int)a.z80.getStateSize());
+    a.z80.execute(12345);
+    a.z80.generateIRQ(0); // save with the pending interrupt
+    size_t size = a.z80.saveState(state, sizeof(state));
+    printf("saved: %d bytes, version=%d, PC=$%04X\n", (int)size, state[4] | state[5] << 8, a.z80.reg.PC);
+    if (0 != a.z80.saveState(state, size - 1) || size != a.z80.getStateSize()) return -1;
+
+    // the loaded instance continues the same as the saved instance
+    bool result = b.z80.loadState(state, size);
+    b.z80.reg.consumeClockCounter = a.z80.reg.consumeClockCounter;
+    printf("loaded: %s, same=%s, wtc.read=%d\n", result ? "true" : "false", a.equals(b) ? "true" : "false", b.z80.wtc.read);
+    if (!result || !a.equals(b)) return -1;
+    for (int i = 0; i < 10; i++) {
+        a.z80.execute(1000 + i * 77);
+        b.z80.execute(1000 + i * 77);
+        if (i == 5) {
+            a.z80.generateIRQ(0);
+            b.z80.generateIRQ(0);
+        }
+    }
+    printf("continued: same=%s, B=%d, total=%llu\n", a.equals(b) ? "true" : "false", a.z80.reg.pair.B, a.z80.getTotalClocks());
+    if (!a.equals(b)) return -1;
+
+    // reload the saved state to the executed instance
+    b.z80.loadState(state, size);
+    a.z80.loadState(state, size);
+    a.z80.execute(5000);
+    b.z80.execute(5000);
+    printf("reloaded: same=%s, total=%llu\n", a.equals(b) ? "true" : "false", a.z80.getTotalClocks());
+    if (!a.equals(b)) return -1;
+
+    // the memory in the state can be used directly (zero-copy)
+    size_t memorySize = 0;
+    const unsigned char* memory = Z80::getStateMemory(state, size, 0, &memorySize);
+    printf("memory: size=$%X, offset=%d, program=%s\n", (int)memorySize, (int)(memory - state), 0 == memcmp(memory, b.ram, 0x10) ? "OK" : "NG");
+    if (!memory || memorySize != sizeof(b.ram) || Z80::getStateMemory(state, size, 1)) return -1;
+
+    // invalid states are rejected without any change
+    unsigned short pc = b.z80.reg.PC;
+    state[4]++;
+    bool version = b.z80.loadState(state, size);
+    state[4]--;
+    b.z80.removeAllStateMemory();
+    bool region = b.z80.loadState(state, size);
+    bool truncated = a.z80.loadState(state, size - 16);
+    printf("rejected: version=%s, region=%s, truncated=%s, PC=%s\n", version ? "NG" : "OK", region ? "NG" : "OK", truncated ? "NG" : "OK",
+           pc == b.z80.reg.PC ? "OK" : "NG");
+    return version || region || truncated || pc != b.z80.reg.PC ? -1 : 0;
+}
@@ -0,0 +1,126 @@
+#include "z80trace.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+
+// trace the program into the ring, and compare the decoded records with the debug messages of the same program
+struct Machine {
+    unsigned char ram[0x10000];
+    unsigned char input;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return ((Machine*)arg)->input++; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0x21, 0x00, 0x80,       // LD HL, $8000
+            0xDD, 0x21, 0x00, 0x90, // LD IX, $9000
+            0xDB, 0x10,             // loop: IN A, ($10)
+            0x86,                   // ADD A, (HL)
+            0x77,                   // LD (HL), A
+            0xDD, 0x77, 0x05,       // LD (IX+5), A
+            0xDD, 0xCB, 0x05, 0xC6, // SET 0, (IX+5)
+            0xD3, 0x20,             // OUT ($20), A
+            0xE5,                   // PUSH HL
+            0xE1,                   // POP HL
+            0x2C,                   // INC L
+            0x18, 0xEE,             // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        input = 0;
+        z80.mapMemory(0x0000, 0x10000, ram);
+    }
+};
+
+int main()
+{
+    static Machine traced;
+    static Machine debugged;
+    static Z80::TraceRecord ring[64];
+    static Z80::TraceRecord records[64];
+
+    // the first instructions: the records in the ring and the debug messages
+    std::vector<std::string> messages;
+    debugged.z80.setDebugMessage([&messages](void* arg, const char* message) { messages.push_back(message); });
+    traced.z80.setTraceBuffer(ring, 64);
+    for (int i = 0; i < 40; i++) {
+        messages.clear();
+        debugged.z80.execute(1);
+        traced.z80.execute(1);
+        unsigned long long index = traced.z80.getTraceCount() - 1;
+        if (1 != traced.z80.readTrace(index, records, 1)) return -1;
+        Z80TraceDecoder decoder;
+        const char* text = decoder.decode(records[0]);
+        bool same = !messages.empty() && messages[0] == text && records[0].clocks < traced.z80.getTotalClocks();
+        printf("%6llu %s%s\n", records[0].clocks, text, same ? "" : " ... NG");
+        if (!same) {
+            printf("expected: %s\n", messages.empty() ? "" : messages[0].c_str());
+            return -1;
+        }
+    }
+
+    // the oldest records are overwritten by the newer ones
+    traced.z80.execute(10000);
+    unsigned long long count = traced.z80.getTraceCount();
+    unsigned long long index = 0;
+    size_t n = traced.z80.readTrace(index, records, 64);
+    bool wrapped = 63 == n && count - 63 == index;
+    for (size_t i = 1; i < n; i++) wrapped &= records[i - 1].clocks < records[i].clocks;
+    printf("wrap: %s (count=%llu, index=%llu)\n", wrapped ? "OK" : "NG", count, index);
+    if (!wrapped) return -1;
+
+    // read the ring from the other thread while executing
+    std::atomic<bool> done(false);
+    bool consistent = true;
+    unsigned long long received = 0;
+    std::thread reader([&]() {
+        Z80::TraceRecord buffer[16];
+        unsigned long long next = traced.z80.getTraceCount();
+        unsigned long long lastClocks = 0;
+        while (!done) {
+            unsigned long long at = next;
+            size_t got = traced.z80.readTrace(at, buffer, 16);
+            for (size_t i = 0; i < got; i++) {
+                consistent &= lastClocks < buffer[i].clocks;
+                size_t length = Z80::decode(&traced.ram[buffer[i].PC], 4, buffer[i].PC).length;
+                consistent &= 0 == memcmp(buffer[i].opcode, &traced.ram[buffer[i].PC], length);
+                lastClocks = buffer[i].clocks;
+            }
+            received += got;
+            next = at + got;
+        }
+    });
+    for (int i = 0; i < 1000; i++) traced.z80.execute(1000);
+    done = true;
+    reader.join();
+    printf("concurrent read: %s\n", consistent ? "OK" : "NG");
+    if (!consistent || !received) return -1;
+
+    traced.z80.removeTraceBuffer();
+    count = traced.z80.getTraceCount();
+    traced.z80.execute(1000);
+    bool removed = 0 == count && 0 == traced.z80.getTraceCount();
+    printf("remove: %s\n", removed ? "OK" : "NG");
+    if (!removed) return -1;
+
+    // the memory via the bus (ex: memory mapped I/O) is read only by the instructions while tracing
+    static Machine plain;
+    static Machine bus;
+    static int reads[2];
+    plain.z80.unmapAllMemory();
+    bus.z80.unmapAllMemory();
+    plain.z80.setupMemoryCallback([](void* arg, unsigned short addr) { reads[0]++; return plain.ram[addr]; }, [](void* arg, unsigned short addr, unsigned char value) { plain.ram[addr] = value; });
+    bus.z80.setupMemoryCallback([](void* arg, unsigned short addr) { reads[1]++; return bus.ram[addr]; }, [](void* arg, unsigned short addr, unsigned char value) { bus.ram[addr] = value; });
+    bus.z80.setTraceBuffer(ring, 64);
+    plain.z80.execute(10000);
+    bus.z80.execute(10000);
+    Z80::TraceRecord& last = ring[(bus.z80.getTraceCount() - 1) & 63];
+    unsigned char opcode[4] = {0, 0, 0, 0};
+    memcpy(opcode, &bus.ram[last.PC], Z80::decode(&bus.ram[last.PC], 4, last.PC).length);
+    bool same = reads[0] == reads[1] && 0 == memcmp(last.opcode, opcode, 4);
+    printf("bus reads: %s\n", same ? "OK" : "NG");
+    return same ? 0 : -1;
+}
@@ -0,0 +1,131 @@
+#include "z80tracefile.hpp"
+
+// stream the trace to the file, and compare the records read from the file with the records of the ring
+struct Machine {
+    unsigned char ram[0x10000];
+    unsigned char input;
+    Z80 z80;
+    Machine() : z80([](void* arg, unsigned short addr) { return ((Machine*)arg)->ram[addr]; },
+                    [](void* arg, unsigned short addr, unsigned char value) { ((Machine*)arg)->ram[addr] = value; },
+                    [](void* arg, unsigned short port) { return ((Machine*)arg)->input++; },
+                    [](void* arg, unsigned short port, unsigned char value) {},
+                    this)
+    {
+        const unsigned char prg[] = {
+            0x21, 0x00, 0x80, // LD HL, $8000
+            0x11, 0x00, 0x90, // LD DE, $9000
+            0xDB, 0x10,       // loop: IN A, ($10)
+            0x86,             // ADD A, (HL)
+            0x77,             // LD (HL), A
+            0x2C,             // INC L
+            0x12,             // LD (DE), A
+            0x13,             // INC DE
+            0xCB, 0xE2,       // SET 4, D
+            0xCB, 0xAA,       // RES 5, D
+            0x10, 0xF2,       // DJNZ loop
+            0xE5,             // PUSH HL
+            0xE1,             // POP HL
+            0x18, 0xEE,       // JR loop
+        };
+        memset(ram, 0, sizeof(ram));
+        memcpy(ram, prg, sizeof(prg));
+        input = 0;
+        z80.mapMemory(0x0000, 0x10000, ram);
+    }
+};
+
+int main()
+{
+    // LZ77: the repeated data and the random data
+    static unsigned char data[100000];
+    static unsigned char packed[100000 + 100000 / 255 + 16];
+    static unsigned char unpacked[100000];
+    unsigned int seed = 1;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = i < 50000 ? (unsigned char)"0123456789"[i % 7] : (unsigned char)(seed >> 16);
+    }
+    size_t packedSize = Z80TraceCodec::compress(data, sizeof(data), packed);
+    bool same = Z80TraceCodec::decompress(packed, packedSize, unpacked, sizeof(unpacked)) && 0 == memcmp(data, unpacked, sizeof(data));
+    same &= !Z80TraceCodec::decompress(packed, packedSize - 1, unpacked, sizeof(unpacked));
+    printf("LZ77: %s (%d -> %d bytes)\n", same ? "OK" : "NG", (int)sizeof(data), (int)packedSize);
+    if (!same) return -1;
+
+    // the reference records in the ring (large enough for all)
+    static Machine reference;
+    static Z80::TraceRecord ring[0x40000];
+    reference.z80.setTraceBuffer(ring, 0x40000);
+    for (int i = 0; i < 100; i++) reference.z80.execute(10000);
+    unsigned long long count = reference.z80.getTraceCount();
+
+    // the records written by the writer
+    static Machine traced;
+    {
+        Z80TraceWriter writer(traced.z80, "test-tracefile.bin");
+        for (int i = 0; i < 100; i++) traced.z80.execute(10000);
+        same = writer.close() && 0 == writer.getDropped() && count == writer.getWritten();
+    }
+    FILE* fp = fopen("test-tracefile.bin", "rb");
+    fseek(fp, 0, SEEK_END);
+    long fileSize = ftell(fp);
+    fclose(fp);
+    printf("write: %s (%llu records, %ld bytes)\n", same ? "OK" : "NG", count, fileSize);
+    if (!same) return -1;
+
+    // read all of the records
+    Z80TraceReader reader;
+    if (!reader.open("test-tracefile.bin")) return -1;
+    Z80::TraceRecord record;
+    unsigned long long n = 0;
+    while (reader.next(record)) {
+        same &= n < count && 0 == memcmp(&record, &ring[n], sizeof(record)) && n == reader.getIndex();
+        n++;
+    }
+    same &= n == count;
+    printf("read: %s (%llu records, %d blocks)\n", same ? "OK" : "NG", n, (int)reader.getBlockCount());
+    if (!same) return -1;
+
+    // seek by the clocks
+    const unsigned long long targets[] = {0, 1, 5000, 123456, 500000, 999990};
+    for (auto target : targets) {
+        size_t expect = 0;
+        while (ring[expect].clocks < target) expect++;
+        bool found = reader.seek(target) && reader.next(record) && 0 == memcmp(&record, &ring[expect], sizeof(record)) && expect == reader.getIndex();
+        if (found && reader.next(record)) found &= 0 == memcmp(&record, &ring[expect + 1], sizeof(record));
+        printf("seek(%llu): %s (index=%d, clocks=%llu, PC=$%04X)\n", target, found ? "OK" : "NG", (int)expect, ring[expect].clocks, ring[expect].PC);
+        same &= found;
+    }
+    same &= !reader.seek(ring[count - 1].clocks + 1);
+    reader.close();
+    if (!same) return -1;
+
+    // the file without the index (ex: the writer crashed)
+    fp = fopen("test-tracefile.bin", "r+b");
+    fseek(fp, -4, SEEK_END);
+    fputc('?', fp);
+    fclose(fp);
+    same = reader.open("test-tracefile.bin") && reader.seek(500000) && reader.next(record) && 500000 <= record.clocks;
+    printf("scan the blocks: %s (%d blocks)\n", same ? "OK" : "NG", (int)reader.getBlockCount());
+    reader.close();
+    if (!same) return -1;
+
+    // lossless: the CPU waits for the thread instead of overwriting the small ring
+    static Machine waited;
+    {
+        Z80TraceWriter writer(waited.z80, "test-tracefile.bin", 64, true);
+        for (int i = 0; i < 100; i++) waited.z80.execute(10000);
+        same = writer.close() && 0 == writer.getDropped() && count == writer.getWritten();
+    }
+    n = 0;
+    if (same && reader.open("test-tracefile.bin")) {
+        while (reader.next(record)) {
+            same &= n < count && 0 == memcmp(&record, &ring[n], sizeof(record));
+            n++;
+        }
+        reader.close();
+    }
+    same &= n == count;
+    printf("lossless: %s (%llu records, ring=64)\n", same ? "OK" : "NG", n);
+    remove("test-tracefile.bin");
+    return same ? 0 : -1;
+}
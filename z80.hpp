@@ -32,9 +32,58 @@
 #include <stdlib.h>
 #include <string.h>
 
-#if !defined(Z80_DISABLE_BREAKPOINT) || !defined(Z80_DISABLE_NESTCHECK)
-#include <map>
+#if !defined(Z80_BIG_ENDIAN_HOST) && defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define Z80_BIG_ENDIAN_HOST
+#endif
+
+#if defined(Z80_JIT) && !defined(Z80_HOT_BLOCK)
+#define Z80_HOT_BLOCK
+#endif
+
+#if defined(Z80_HOT_BLOCK) && !defined(Z80_DECODE_CACHE)
+#define Z80_DECODE_CACHE
+#endif
+
+// the native code of Z80_JIT is x86-64 only (the other hosts execute the hot blocks by Z80_HOT_BLOCK)
+#if defined(Z80_JIT) && defined(__x86_64__) && !defined(Z80_BIG_ENDIAN_HOST) && (defined(__unix__) || defined(__APPLE__))
+#define Z80_JIT_X86_64
+#include <sys/mman.h>
+#endif
+
+#if defined(Z80_JIT_X86_64) && !defined(Z80_JIT_MIN_RUN)
+#define Z80_JIT_MIN_RUN 2
+#endif
+
+#if defined(Z80_HOT_BLOCK) && !defined(Z80_HOT_BLOCK_THRESHOLD)
+#define Z80_HOT_BLOCK_THRESHOLD 64
+#endif
+
+#include <algorithm>
 #include <vector>
+
+#ifdef Z80_SWITCH_DISPATCH
+// the operand numbers $00 ~ $FF (h: upper digit, l: lower digit) to generate the dispatchers from the opSet tables
+#define Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, h) M(TABLE, ARGS, h, 0) M(TABLE, ARGS, h, 1) M(TABLE, ARGS, h, 2) M(TABLE, ARGS, h, 3) M(TABLE, ARGS, h, 4) M(TABLE, ARGS, h, 5) M(TABLE, ARGS, h, 6) M(TABLE, ARGS, h, 7) M(TABLE, ARGS, h, 8) M(TABLE, ARGS, h, 9) M(TABLE, ARGS, h, A) M(TABLE, ARGS, h, B) M(TABLE, ARGS, h, C) M(TABLE, ARGS, h, D) M(TABLE, ARGS, h, E) M(TABLE, ARGS, h, F)
+#define Z80_OPERAND_NUMBERS(M, TABLE, ARGS) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 0) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 1) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 2) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 3) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 4) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 5) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 6) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 7) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 8) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, 9) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, A) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, B) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, C) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, D) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, E) Z80_OPERAND_NUMBERS_OF(M, TABLE, ARGS, F)
+#ifdef __GNUC__
+// computed goto: jump to the label of the operand number from the table of the label addresses
+#define Z80_DISPATCH_LABEL(TABLE, ARGS, h, l) &&op##h##l,
+#define Z80_DISPATCH_GOTO(TABLE, ARGS, h, l) \
+    op##h##l : if (TABLE[0x##h##l]) TABLE[0x##h##l] ARGS;      \
+    return;
+#define Z80_DISPATCH(TABLE, ARGS)                                                                    \
+    static const void* const labels[256] = {Z80_OPERAND_NUMBERS(Z80_DISPATCH_LABEL, TABLE, ARGS)}; \
+    goto* labels[operandNumber];                                                                     \
+    Z80_OPERAND_NUMBERS(Z80_DISPATCH_GOTO, TABLE, ARGS)
+#else
+// switch statement (MSVC)
+#define Z80_DISPATCH_CASE(TABLE, ARGS, h, l) \
+    case 0x##h##l:                           \
+        if (TABLE[0x##h##l]) TABLE[0x##h##l] ARGS; \
+        break;
+#define Z80_DISPATCH(TABLE, ARGS) \
+    switch (operandNumber) { Z80_OPERAND_NUMBERS(Z80_DISPATCH_CASE, TABLE, ARGS) }
+#endif
 #endif
 
 #ifndef Z80_NO_FUNCTIONAL
@@ -45,7 +94,12 @@
 #include <stdexcept>
 #endif
 
-class Z80
+#ifndef Z80_DISABLE_TRACE
+#include <atomic>
+#endif
+
+template <class Bus>
+class Z80Core
 {
   public: // Interface data types
     struct WaitClocks {
@@ -55,15 +109,67 @@ class Z80
         int write;  // Wait T-cycle (Hz) before to write memory (default is 0 = no wait)
     } wtc;
 
+    // each pair can be accessed as the 8-bit registers and as the 16-bit value in the host byte order
     struct RegisterPair {
-        unsigned char A;
-        unsigned char F;
-        unsigned char B;
-        unsigned char C;
-        unsigned char D;
-        unsigned char E;
-        unsigned char H;
-        unsigned char L;
+#ifdef Z80_BIG_ENDIAN_HOST
+        union {
+            struct {
+                unsigned char A;
+                unsigned char F;
+            };
+            unsigned short AF;
+        };
+        union {
+            struct {
+                unsigned char B;
+                unsigned char C;
+            };
+            unsigned short BC;
+        };
+        union {
+            struct {
+                unsigned char D;
+                unsigned char E;
+            };
+            unsigned short DE;
+        };
+        union {
+            struct {
+                unsigned char H;
+                unsigned char L;
+            };
+            unsigned short HL;
+        };
+#else
+        union {
+            struct {
+                unsigned char F;
+                unsigned char A;
+            };
+            unsigned short AF;
+        };
+        union {
+            struct {
+                unsigned char C;
+                unsigned char B;
+            };
+            unsigned short BC;
+        };
+        union {
+            struct {
+                unsigned char E;
+                unsigned char D;
+            };
+            unsigned short DE;
+        };
+        union {
+            struct {
+                unsigned char L;
+                unsigned char H;
+            };
+            unsigned short HL;
+        };
+#endif
     };
 
     struct Register {
@@ -71,8 +177,37 @@ class Z80
         struct RegisterPair back;
         unsigned short PC;
         unsigned short SP;
-        unsigned short IX;
-        unsigned short IY;
+#ifdef Z80_BIG_ENDIAN_HOST
+        union {
+            struct {
+                unsigned char IXH;
+                unsigned char IXL;
+            };
+            unsigned short IX;
+        };
+        union {
+            struct {
+                unsigned char IYH;
+                unsigned char IYL;
+            };
+            unsigned short IY;
+        };
+#else
+        union {
+            struct {
+                unsigned char IXL;
+                unsigned char IXH;
+            };
+            unsigned short IX;
+        };
+        union {
+            struct {
+                unsigned char IYL;
+                unsigned char IYH;
+            };
+            unsigned short IY;
+        };
+#endif
         unsigned short interruptVector; // interrupt vector for IRQ
         unsigned short interruptAddrN;  // interrupt address for NMI
         unsigned short WZ;
@@ -86,6 +221,76 @@ class Z80
         unsigned char reserved8[2];
     } reg;
 
+#ifndef Z80_DISABLE_TRACE
+    // bits of the memory effect of the traced instruction (the first read or input, and the first write or output)
+    enum TraceEffect {
+        TRACE_READ = 0x01,   // readValue[0]: the memory at readAddr
+        TRACE_READ16 = 0x02, // readValue[1]: the memory at readAddr + 1 (read after readAddr)
+        TRACE_IN = 0x04,     // readValue[0]: the input from the port readAddr
+        TRACE_WRITE = 0x08,  // writeValue: written to the memory at writeAddr
+        TRACE_OUT = 0x10,    // writeValue: the output to the port writeAddr
+        TRACE_WRITES = 0x20, // written or output again after the first one
+    };
+
+    // fixed-size record of the binary trace (see setTraceBuffer): the state before an instruction and its memory effect
+    struct TraceRecord {
+        unsigned long long clocks; // total clocks at the start of the instruction
+        unsigned short PC;
+        unsigned short SP;
+        unsigned short AF;
+        unsigned short BC;
+        unsigned short DE;
+        unsigned short HL;
+        unsigned short IX;
+        unsigned short IY;
+        unsigned short AF2;
+        unsigned char I;
+        unsigned char R;
+        unsigned char opcode[4]; // the bytes fetched from PC (the instruction, and 0 after it)
+        unsigned short readAddr;
+        unsigned char readValue[2];
+        unsigned short writeAddr;
+        unsigned char writeValue;
+        unsigned char effect; // bits of TraceEffect
+    };
+#endif
+
+    // kind of the operand of the decoded instruction (see decode)
+    enum OperandKind {
+        OPERAND_NONE = 0,
+        OPERAND_BYTE,       // n: value is the immediate byte
+        OPERAND_WORD,       // nn: value is the immediate word (or the address)
+        OPERAND_RELATIVE,   // e: value is the destination address of the relative jump
+        OPERAND_INDEX,      // d: displacement of (IX+d) or (IY+d)
+        OPERAND_INDEX_BYTE, // d, n: displacement of (IX+d) or (IY+d), and value is the immediate byte
+    };
+
+    // instruction decoded from the memory without executing it (see decode)
+    struct Instruction {
+        const char* mnemonic;       // lower case letters are the operands (n, nn, e, d, and i: IX or IY), nullptr: unknown instruction
+        unsigned short addr;        // address of the instruction
+        unsigned char opcode[4];    // bytes of the instruction
+        unsigned char length;       // size of the instruction (1 if unknown)
+        unsigned char operand;      // OperandKind
+        unsigned char clocks;       // clocks without the wait states (the condition is not met, or the block instruction ends)
+        unsigned char branchClocks; // clocks if the condition is met or the block instruction repeats (0: not conditional)
+        signed char displacement;   // d of (IX+d) or (IY+d)
+        unsigned short value;       // n, nn or the destination of e
+    };
+
+#ifndef Z80_DISABLE_PROFILE
+    // counters of the instructions at each address (see setProfile)
+    struct Profile {
+        unsigned long long count[0x10000];    // instructions executed
+        unsigned long long clocks[0x10000];   // clocks of the instructions (including the wait states)
+        unsigned long long taken[0x10000];    // conditional instructions: the condition is met (or the block instruction repeats)
+        unsigned long long notTaken[0x10000]; // conditional instructions: the condition is not met (or the block instruction ends)
+    };
+#endif
+
+    // memory & device bus (read/write/in/out are called directly from each instruction)
+    Bus bus;
+
     inline unsigned char flagS() { return 0b10000000; }
     inline unsigned char flagZ() { return 0b01000000; }
     inline unsigned char flagY() { return 0b00100000; }
@@ -95,16 +300,30 @@ class Z80
     inline unsigned char flagN() { return 0b00000010; }
     inline unsigned char flagC() { return 0b00000001; }
 
+    // opcode = true: read the opcode bytes (not traced as the memory effect)
+    template <bool opcode = false>
     inline unsigned char readByte(unsigned short addr, int clock = 4)
     {
 #ifndef Z80_DISABLE_BREAKPOINT
         if (clock && wtc.read) consumeClock(wtc.read);
-        unsigned char byte = CB.read(CB.arg, addr);
+        unsigned char byte = readMemory(addr);
         if (clock) consumeClock(clock);
 #else
         consumeClock(wtc.read);
-        unsigned char byte = CB.read(CB.arg, addr);
+        unsigned char byte = readMemory(addr);
         consumeClock(clock);
+#endif
+#ifndef Z80_DISABLE_PROFILE
+        if (opcode && profile.data) profileFetch(addr, byte);
+#endif
+#ifndef Z80_DISABLE_TRACE
+        if (trace.current) {
+            if (opcode) {
+                traceFetch(addr, byte);
+            } else {
+                traceRead(TRACE_READ, addr, byte);
+            }
+        }
 #endif
         return byte;
     }
@@ -112,30 +331,110 @@ class Z80
     inline void writeByte(unsigned short addr, unsigned char value, int clock = 4)
     {
         consumeClock(wtc.write);
-        CB.write(CB.arg, addr, value);
+        writeMemory(addr, value);
         consumeClock(clock);
     }
 
-  private: // Internal functions & variables
+  protected: // Internal functions & variables
+    // page map (256 bytes per page): host memory of each page, or nullptr if access via the bus
+    struct MemoryPage {
+        unsigned char* read;
+        unsigned char* write;
+    } pageMap[256];
+
+    inline unsigned char readMemory(unsigned short addr)
+    {
+        unsigned char* page = pageMap[addr >> 8].read;
+        return page ? page[addr & 0xFF] : readBus(addr);
+    }
+
+    // the memory via the read callback is an input same as the in callback (recorded, and replayed without the devices)
+    inline unsigned char readBus(unsigned short addr)
+    {
+        if (replaying) return replayInput(INPUT_READ);
+        unsigned char byte = bus.read(CB.arg, addr);
+        if (recordLog) recordInput(INPUT_READ, byte);
+        return byte;
+    }
+
+    inline void writeMemory(unsigned short addr, unsigned char value)
+    {
+        markDirtyPage(addr);
+#ifndef Z80_DISABLE_TRACE
+        if (trace.current) traceWrite(TRACE_WRITE, addr, value);
+#endif
+#ifdef Z80_DECODE_CACHE
+        if (decodedBytes[addr >> 3] & bits[addr & 7]) invalidateDecodedPage(addr >> 8);
+#endif
+        unsigned char* page = pageMap[addr >> 8].write;
+        if (page) {
+            page[addr & 0xFF] = value;
+        } else if (!replaying) {
+            bus.write(CB.arg, addr, value);
+        }
+    }
+
+#ifdef Z80_LAZY_FLAGS
+    // the last 8-bit ALU operation that has not been reflected to F yet
+    struct LazyFlags {
+        int kind;            // 0: F is up to date, 1: arithmetic, 2: logical
+        int result;          // 8-bit result (S, Z and P of logical)
+        int xy;              // source of the undocumented X/Y flags
+        int carryX;          // arithmetic: before ^ operand ^ result (H, P/V and C)
+        unsigned char fixed; // arithmetic: N, logical: H
+    } lazy;
+
+    inline void evaluateLazyFlags()
+    {
+        unsigned char f = (lazy.result & flagS()) | (lazy.result ? 0 : flagZ()) | (lazy.xy & (flagX() | flagY())) | lazy.fixed;
+        if (1 == lazy.kind) {
+            f |= lazy.carryX & flagH();
+            if (((lazy.carryX << 1) ^ lazy.carryX) & 0x100) f |= flagPV();
+            if (lazy.carryX & 0x100) f |= flagC();
+        } else if (isEvenNumberBits((unsigned char)lazy.result)) {
+            f |= flagPV();
+        }
+        reg.pair.F = f;
+        lazy.kind = 0;
+    }
+#endif
+
+    // F register (evaluates the pending lazy flags before access)
+    inline unsigned char& regF()
+    {
+#ifdef Z80_LAZY_FLAGS
+        if (lazy.kind) evaluateLazyFlags();
+#endif
+        return reg.pair.F;
+    }
+
+    // reflect the pending lazy flags to reg before the host can observe it
+    inline void flushFlags()
+    {
+#ifdef Z80_LAZY_FLAGS
+        if (lazy.kind) evaluateLazyFlags();
+#endif
+    }
+
     // bit table
     const unsigned char bits[8] = {0b00000001, 0b00000010, 0b00000100, 0b00001000, 0b00010000, 0b00100000, 0b01000000, 0b10000000};
     // flag setter
-    inline void setFlagS() { reg.pair.F |= flagS(); }
-    inline void setFlagZ() { reg.pair.F |= flagZ(); }
-    inline void setFlagY() { reg.pair.F |= flagY(); }
-    inline void setFlagH() { reg.pair.F |= flagH(); }
-    inline void setFlagX() { reg.pair.F |= flagX(); }
-    inline void setFlagPV() { reg.pair.F |= flagPV(); }
-    inline void setFlagN() { reg.pair.F |= flagN(); }
-    inline void setFlagC() { reg.pair.F |= flagC(); }
-    inline void resetFlagS() { reg.pair.F &= ~flagS(); }
-    inline void resetFlagZ() { reg.pair.F &= ~flagZ(); }
-    inline void resetFlagY() { reg.pair.F &= ~flagY(); }
-    inline void resetFlagH() { reg.pair.F &= ~flagH(); }
-    inline void resetFlagX() { reg.pair.F &= ~flagX(); }
-    inline void resetFlagPV() { reg.pair.F &= ~flagPV(); }
-    inline void resetFlagN() { reg.pair.F &= ~flagN(); }
-    inline void resetFlagC() { reg.pair.F &= ~flagC(); }
+    inline void setFlagS() { regF() |= flagS(); }
+    inline void setFlagZ() { regF() |= flagZ(); }
+    inline void setFlagY() { regF() |= flagY(); }
+    inline void setFlagH() { regF() |= flagH(); }
+    inline void setFlagX() { regF() |= flagX(); }
+    inline void setFlagPV() { regF() |= flagPV(); }
+    inline void setFlagN() { regF() |= flagN(); }
+    inline void setFlagC() { regF() |= flagC(); }
+    inline void resetFlagS() { regF() &= ~flagS(); }
+    inline void resetFlagZ() { regF() &= ~flagZ(); }
+    inline void resetFlagY() { regF() &= ~flagY(); }
+    inline void resetFlagH() { regF() &= ~flagH(); }
+    inline void resetFlagX() { regF() &= ~flagX(); }
+    inline void resetFlagPV() { regF() &= ~flagPV(); }
+    inline void resetFlagN() { regF() &= ~flagN(); }
+    inline void resetFlagC() { regF() &= ~flagC(); }
     inline void setFlagS(bool on) { on ? setFlagS() : resetFlagS(); }
     inline void setFlagZ(bool on) { on ? setFlagZ() : resetFlagZ(); }
     inline void setFlagY(bool on) { on ? setFlagY() : resetFlagY(); }
@@ -152,12 +451,12 @@ class Z80
     }
 
     // flag checker
-    inline bool isFlagS() { return reg.pair.F & flagS(); }
-    inline bool isFlagZ() { return reg.pair.F & flagZ(); }
-    inline bool isFlagH() { return reg.pair.F & flagH(); }
-    inline bool isFlagPV() { return reg.pair.F & flagPV(); }
-    inline bool isFlagN() { return reg.pair.F & flagN(); }
-    inline bool isFlagC() { return reg.pair.F & flagC(); }
+    inline bool isFlagS() { return regF() & flagS(); }
+    inline bool isFlagZ() { return regF() & flagZ(); }
+    inline bool isFlagH() { return regF() & flagH(); }
+    inline bool isFlagPV() { return regF() & flagPV(); }
+    inline bool isFlagN() { return regF() & flagN(); }
+    inline bool isFlagC() { return regF() & flagC(); }
 
     enum class Condition {
         Z = 0x40,
@@ -173,7 +472,7 @@ class Z80
     inline bool checkConditionFlag(Condition c)
     {
         int ic = (int)c;
-        return (ic & reg.pair.F) ^ ((ic & 0xFF00) >> 8);
+        return (ic & regF()) ^ ((ic & 0xFF00) >> 8);
     }
 
     inline unsigned char IFF1() { return 0b00000001; }
@@ -203,20 +502,23 @@ class Z80
     class BreakOperand
     {
       public:
+        int number; // prefixNumber << 8 | operandNumber
         int prefixNumber;
         unsigned char operandNumber;
 #ifdef Z80_NO_FUNCTIONAL
         void (*callback)(void*, unsigned char*, int);
-        BreakOperand(int prefixNumber_, unsigned char operandNumber_, void (*callback_)(void*, unsigned char*, int))
+        BreakOperand(int number_, int prefixNumber_, unsigned char operandNumber_, void (*callback_)(void*, unsigned char*, int))
         {
+            this->number = number_;
             this->prefixNumber = prefixNumber_;
             this->operandNumber = operandNumber_;
             this->callback = callback_;
         }
 #else
         std::function<void(void*, unsigned char*, int)> callback;
-        BreakOperand(int prefixNumber_, unsigned char operandNumber_, const std::function<void(void*, unsigned char*, int)>& callback_)
+        BreakOperand(int number_, int prefixNumber_, unsigned char operandNumber_, const std::function<void(void*, unsigned char*, int)>& callback_)
         {
+            this->number = number_;
             this->prefixNumber = prefixNumber_;
             this->operandNumber = operandNumber_;
             this->callback = callback_;
@@ -243,6 +545,7 @@ class Z80
 
     inline void invokeReturnHandlers()
     {
+        flushFlags();
         for (auto handler : this->CB.returnHandlers) {
             handler->callback(this->CB.arg);
         }
@@ -250,6 +553,7 @@ class Z80
 
     inline void invokeCallHandlers()
     {
+        flushFlags();
         for (auto handler : this->CB.callHandlers) {
             handler->callback(this->CB.arg);
         }
@@ -258,17 +562,13 @@ class Z80
 
     struct Callback {
 #ifdef Z80_NO_FUNCTIONAL
-        unsigned char (*read)(void*, unsigned short);
-        void (*write)(void*, unsigned short, unsigned char);
-        unsigned char (*in)(void*, unsigned short);
-        void (*out)(void*, unsigned short, unsigned char);
         void (*consumeClock)(void*, int);
+        int (*portStable)(void*, unsigned short);
+        void (*replayHostEvent)(void*, unsigned short, unsigned int);
 #else
-        std::function<unsigned char(void*, unsigned short)> read;
-        std::function<void(void*, unsigned short, unsigned char)> write;
-        std::function<unsigned char(void*, unsigned short)> in;
-        std::function<void(void*, unsigned short, unsigned char)> out;
         std::function<void(void*, int)> consumeClock;
+        std::function<int(void*, unsigned short)> portStable;
+        std::function<void(void*, unsigned short, unsigned int)> replayHostEvent;
 #endif
 
 #ifndef Z80_UNSUPPORT_16BIT_PORT
@@ -285,26 +585,581 @@ class Z80
 #endif
 
 #ifndef Z80_DISABLE_BREAKPOINT
-        std::map<int, std::vector<BreakPoint*>*> breakPoints;
-        std::map<int, std::vector<BreakOperand*>*> breakOperands;
+        std::vector<BreakPoint*> breakPoints;       // sorted by the address (in the added order at the same address)
+        unsigned char breakPointBits[0x10000 / 8]; // true if any break point is added to the address
+        bool checkingBreakPoints;                  // true while calling the callbacks of the break points
+        std::vector<BreakPoint*> removedBreakPoints; // removed while checkingBreakPoints (deleted after the callbacks)
+        std::vector<BreakOperand*> breakOperands;   // sorted by the number (in the added order at the same number)
+        unsigned char breakOperandBits[7][256 / 8]; // true if any break operand is added to the operand of the prefix (see breakOperandSlot)
+        bool checkingBreakOperands;                  // true while calling the callbacks of the break operands
+        std::vector<BreakOperand*> removedBreakOperands; // removed while checkingBreakOperands (deleted after the callbacks)
 #endif
 #ifndef Z80_DISABLE_NESTCHECK
         std::vector<SimpleHandler*> returnHandlers;
         std::vector<SimpleHandler*> callHandlers;
 #endif
         bool consumeClockEnabled;
+        bool portStableEnabled;
+        bool replayHostEventEnabled;
         void* arg;
     } CB;
 
     bool requestBreakFlag;
+    bool instrumented; // true if the debug message, the trace, break points or break operands are used (see updateInstrumented)
+    unsigned long long totalClocks; // clocks consumed since the initialize
+    int clockLeft;     // remaining clocks of execute before the current instruction (up to the next event)
+    int skippedClocks; // clocks consumed by the native fast paths in the current instruction
+    bool aggregateHaltClocks;
+
+    struct Event {
+        unsigned long long clocks; // total clocks to call the callback
+        unsigned long long id;     // also the order of the events at the same clocks
+#ifdef Z80_NO_FUNCTIONAL
+        void (*callback)(void*, unsigned long long);
+#else
+        std::function<void(void*, unsigned long long)> callback;
+#endif
+    };
+    std::vector<Event> events;          // min-heap of the scheduled events
+    unsigned long long nextEventClocks; // clocks of the first event (ULLONG_MAX: no event)
+    unsigned long long lastEventId;
+
+    // input record/replay (see startRecording and startReplay)
+    enum InputKind {
+        INPUT_IN = 0,         // value: the result of the in callback
+        INPUT_IRQ = 1,        // value: the vector of generateIRQ
+        INPUT_NMI = 2,        // value: the address of generateNMI
+        INPUT_CANCEL_IRQ = 3, // cancelIRQ
+        INPUT_HOST = 4,       // id & value of recordHostEvent
+        INPUT_READ = 5,       // value: the result of the read callback (the memory not mapped by mapMemory)
+    };
+    struct InputRecord {
+        int kind;
+        bool outside; // recorded outside of execute (ex: between the execute calls)
+        unsigned long long clocks;
+        unsigned int id;
+        unsigned int value;
+    };
+    struct InputCursor {
+        const unsigned char* ptr;  // next record to read
+        unsigned long long clocks; // clocks of the last read record
+        int mask;                  // bits of the kinds read by the cursor
+        InputRecord record;        // the next record of the kinds
+        unsigned long long due;    // total clocks to replay the record (ULLONG_MAX: end of the log)
+    };
+    std::vector<unsigned char>* recordLog; // nullptr: not recording
+    unsigned long long recordClocks;       // clocks of the last record
+    bool replaying;
+    bool replayDiverged;
+    bool executing;
+    const unsigned char* replayEnd;
+    InputCursor replayIn;
+    InputCursor replayHost;
+    InputCursor replayInterrupt;
+    unsigned long long replayNextClocks; // due of the next host event or interrupt (ULLONG_MAX: none)
+
+    // host memory saved with the CPU state (see saveState)
+    struct StateMemory {
+        unsigned char* ptr;
+        size_t size;
+        std::vector<unsigned char> dirty; // chunks (256 bytes from ptr) written since the last snapshot (see saveSnapshot)
+    };
+    std::vector<StateMemory> stateMemories;
+
+    // layout of the state: header (16 bytes), CPU (64 bytes), and the memory regions (16 bytes header + data, aligned by 16)
+    enum StateLayout {
+        STATE_VERSION = 1,
+        STATE_CPU = 16,
+        STATE_MEMORY = 80,
+        SNAPSHOT_VERSION = 2,
+        SNAPSHOT_CHUNK = 8 + 256, // memory region (or SNAPSHOT_CPU_PAGE), chunk number in the region (or the page), and the data
+    };
+    static const unsigned int SNAPSHOT_CPU_PAGE = 0xFFFFFFFF;
+
+    static inline void putState16(unsigned char* p, unsigned int v)
+    {
+        p[0] = (unsigned char)v;
+        p[1] = (unsigned char)(v >> 8);
+    }
+    static inline void putState32(unsigned char* p, unsigned int v)
+    {
+        putState16(p, v & 0xFFFF);
+        putState16(p + 2, v >> 16);
+    }
+    static inline void putState64(unsigned char* p, unsigned long long v)
+    {
+        putState32(p, (unsigned int)(v & 0xFFFFFFFF));
+        putState32(p + 4, (unsigned int)(v >> 32));
+    }
+    static inline unsigned short getState16(const unsigned char* p) { return (unsigned short)(p[0] | p[1] << 8); }
+    static inline unsigned int getState32(const unsigned char* p) { return getState16(p) | (unsigned int)getState16(p + 2) << 16; }
+    static inline unsigned long long getState64(const unsigned char* p) { return getState32(p) | (unsigned long long)getState32(p + 4) << 32; }
+    static inline size_t alignState(size_t size) { return (size + 15) & ~(size_t)15; }
+
+    // the CPU block of the state (64 bytes)
+    inline void putStateCPU(unsigned char* c)
+    {
+        const RegisterPair* pairs[2] = {&reg.pair, &reg.back};
+        for (int i = 0; i < 2; i++) {
+            putState16(c + i * 8, pairs[i]->AF);
+            putState16(c + i * 8 + 2, pairs[i]->BC);
+            putState16(c + i * 8 + 4, pairs[i]->DE);
+            putState16(c + i * 8 + 6, pairs[i]->HL);
+        }
+        putState16(c + 16, reg.PC);
+        putState16(c + 18, reg.SP);
+        putState16(c + 20, reg.IX);
+        putState16(c + 22, reg.IY);
+        putState16(c + 24, reg.interruptVector);
+        putState16(c + 26, reg.interruptAddrN);
+        putState16(c + 28, reg.WZ);
+        c[30] = reg.R;
+        c[31] = reg.I;
+        c[32] = reg.IFF;
+        c[33] = reg.interrupt;
+        c[34] = reg.execEI;
+        c[35] = 0;
+        putState32(c + 36, (unsigned int)wtc.fetch);
+        putState32(c + 40, (unsigned int)wtc.fetchM);
+        putState32(c + 44, (unsigned int)wtc.read);
+        putState32(c + 48, (unsigned int)wtc.write);
+        putState64(c + 52, totalClocks);
+        ::memset(c + 60, 0, 4);
+    }
+
+    inline void getStateCPU(const unsigned char* c)
+    {
+        RegisterPair* pairs[2] = {&reg.pair, &reg.back};
+        for (int i = 0; i < 2; i++) {
+            pairs[i]->AF = getState16(c + i * 8);
+            pairs[i]->BC = getState16(c + i * 8 + 2);
+            pairs[i]->DE = getState16(c + i * 8 + 4);
+            pairs[i]->HL = getState16(c + i * 8 + 6);
+        }
+        reg.PC = getState16(c + 16);
+        reg.SP = getState16(c + 18);
+        reg.IX = getState16(c + 20);
+        reg.IY = getState16(c + 22);
+        reg.interruptVector = getState16(c + 24);
+        reg.interruptAddrN = getState16(c + 26);
+        reg.WZ = getState16(c + 28);
+        reg.R = c[30];
+        reg.I = c[31];
+        reg.IFF = c[32];
+        reg.interrupt = c[33];
+        reg.execEI = c[34];
+        wtc.fetch = (int)getState32(c + 36);
+        wtc.fetchM = (int)getState32(c + 40);
+        wtc.read = (int)getState32(c + 44);
+        wtc.write = (int)getState32(c + 48);
+        totalClocks = getState64(c + 52);
+#ifdef Z80_LAZY_FLAGS
+        lazy.kind = 0;
+#endif
+    }
+
+    // pages written since the last snapshot (see saveSnapshot)
+    unsigned char dirtyPages[256 / 8];
+    inline void markDirtyPage(unsigned short addr) { dirtyPages[addr >> 11] |= bits[(addr >> 8) & 7]; }
+
+    // index of the memory region added by addStateMemory that has ptr (or stateMemories.size())
+    size_t findStateMemory(const unsigned char* ptr)
+    {
+        size_t i = 0;
+        for (; i < stateMemories.size(); i++) {
+            if (stateMemories[i].ptr <= ptr && ptr < stateMemories[i].ptr + stateMemories[i].size) break;
+        }
+        return i;
+    }
+
+    // mark the chunks of the memory regions mapped to the dirty pages (the bits of the pages are kept)
+    void moveDirtyPages(int page, int count)
+    {
+        if (stateMemories.empty()) return;
+        for (; 0 < count && page < 256; count--, page++) {
+            if (!(dirtyPages[page >> 3] & bits[page & 7]) || !pageMap[page].write) continue;
+            size_t index = findStateMemory(pageMap[page].write);
+            if (stateMemories.size() <= index) continue;
+            StateMemory& memory = stateMemories[index];
+            size_t offset = (size_t)(pageMap[page].write - memory.ptr);
+            size_t last = offset + 255 < memory.size ? offset + 255 : memory.size - 1;
+            for (size_t chunk = offset >> 8; chunk <= last >> 8; chunk++) memory.dirty[chunk >> 3] |= bits[chunk & 7];
+        }
+    }
+
+    static inline size_t getStateChunks(const StateMemory& memory) { return (memory.size + 255) >> 8; }
+    inline bool isDirtyChunk(const StateMemory& memory, size_t chunk) { return memory.dirty[chunk >> 3] & bits[chunk & 7]; }
+
+    void clearDirtyChunks()
+    {
+        ::memset(&dirtyPages, 0, sizeof(dirtyPages));
+        for (auto& memory : stateMemories) std::fill(memory.dirty.begin(), memory.dirty.end(), 0);
+    }
+
+#ifndef Z80_DISABLE_PROFILE
+    // the instruction being profiled (see setProfile)
+    struct Profiling {
+        Profile* data;             // nullptr: not profiling
+        unsigned long long clocks; // total clocks at the start of the instruction
+        unsigned short pc;
+        unsigned char opcode[2]; // the first opcode bytes fetched by the instruction
+    } profile;
+
+    // start the instruction at PC (the opcode bytes are recorded when the instruction fetches them)
+    inline void beginProfile()
+    {
+        profile.pc = reg.PC;
+        profile.clocks = totalClocks;
+        profile.opcode[0] = 0;
+        profile.opcode[1] = 0;
+    }
+
+    inline void profileFetch(unsigned short addr, unsigned char value)
+    {
+        unsigned short offset = (unsigned short)(addr - profile.pc);
+        if (offset < 2) profile.opcode[offset] = value;
+    }
+
+    // the conditional branch is taken if PC is not the next instruction, and the block instruction is taken if it repeats
+    inline void endProfile()
+    {
+        Profile* p = profile.data;
+        unsigned short pc = profile.pc;
+        p->count[pc]++;
+        p->clocks[pc] += totalClocks - profile.clocks;
+        const InstructionInfo* info = &instructionTable1[profile.opcode[0]];
+        bool block = 0xED == profile.opcode[0] && instructionTableED[profile.opcode[1]].branchClocks;
+        if (block || info->branchClocks) {
+            bool taken = block ? pc == reg.PC : (unsigned short)(pc + info->length) != reg.PC;
+            if (taken) {
+                p->taken[pc]++;
+            } else {
+                p->notTaken[pc]++;
+            }
+        }
+    }
+#endif
+
+#ifndef Z80_DISABLE_TRACE
+    // ring buffer of the binary trace (see setTraceBuffer)
+    struct Trace {
+        TraceRecord* buffer;                   // nullptr: not tracing
+        size_t mask;                           // capacity - 1
+        unsigned long long written;            // records written (only the executing thread)
+        std::atomic<unsigned long long> count; // records published to the readers
+        TraceRecord* current;                  // record of the executing instruction (nullptr: outside of the instruction)
+        const std::atomic<unsigned long long>* consumed; // records read by the reader (nullptr: overwrite the oldest records)
+        unsigned long long writable;                     // records that can be written without waiting for the reader
+    } trace;
+
+    // spin until the reader consumes the oldest record (the ring keeps a free record for the reader, see readTrace)
+    inline void waitTrace()
+    {
+        while (true) {
+            trace.writable = trace.consumed->load(std::memory_order_acquire) + trace.mask;
+            if (trace.written < trace.writable) return;
+        }
+    }
+
+    // start the record of the instruction at PC (the opcode bytes are recorded when the instruction fetches them)
+    inline void beginTrace()
+    {
+        if (trace.consumed && trace.writable <= trace.written) waitTrace();
+        TraceRecord* r = &trace.buffer[trace.written & trace.mask];
+        r->clocks = totalClocks;
+        r->PC = reg.PC;
+        r->SP = reg.SP;
+        r->AF = getAF();
+        r->BC = reg.pair.BC;
+        r->DE = reg.pair.DE;
+        r->HL = reg.pair.HL;
+        r->IX = reg.IX;
+        r->IY = reg.IY;
+        r->AF2 = reg.back.AF;
+        r->I = reg.I;
+        r->R = reg.R;
+        r->opcode[0] = 0;
+        r->opcode[1] = 0;
+        r->opcode[2] = 0;
+        r->opcode[3] = 0;
+        r->readAddr = 0;
+        r->readValue[0] = 0;
+        r->readValue[1] = 0;
+        r->writeAddr = 0;
+        r->writeValue = 0;
+        r->effect = 0;
+        trace.current = r;
+    }
+
+    // publish the record to the readers
+    inline void endTrace()
+    {
+        trace.current = nullptr;
+        trace.count.store(++trace.written, std::memory_order_release);
+    }
+
+    // the byte of the instruction fetched from the memory (the opcode, the displacement or the immediate value)
+    inline void traceFetch(unsigned short addr, unsigned char value)
+    {
+        unsigned short offset = (unsigned short)(addr - trace.current->PC);
+        if (offset < 4) trace.current->opcode[offset] = value;
+    }
+
+    inline void traceRead(TraceEffect effect, unsigned short addr, unsigned char value)
+    {
+        TraceRecord* r = trace.current;
+        if (!(r->effect & (TRACE_READ | TRACE_IN))) {
+            r->readAddr = addr;
+            r->readValue[0] = value;
+            r->effect |= effect;
+        } else if (TRACE_READ == effect && TRACE_READ == (r->effect & (TRACE_READ | TRACE_READ16)) && (unsigned short)(r->readAddr + 1) == addr) {
+            r->readValue[1] = value;
+            r->effect |= TRACE_READ16;
+        }
+    }
+
+    inline void traceWrite(TraceEffect effect, unsigned short addr, unsigned char value)
+    {
+        TraceRecord* r = trace.current;
+        if (r->effect & (TRACE_WRITE | TRACE_OUT)) {
+            r->effect |= TRACE_WRITES;
+        } else {
+            r->writeAddr = addr;
+            r->writeValue = value;
+            r->effect |= effect;
+        }
+    }
+#endif
+
+    static bool isLaterEvent(const Event& a, const Event& b) { return a.clocks != b.clocks ? b.clocks < a.clocks : b.id < a.id; }
+
+    inline void updateNextEvent()
+    {
+        nextEventClocks = events.empty() ? ULLONG_MAX : events.front().clocks;
+        if (replayNextClocks < nextEventClocks) nextEventClocks = replayNextClocks;
+    }
+
+    // call the events reached to their clocks (at the boundary of the instructions)
+    inline void dispatchEvents()
+    {
+        flushFlags();
+        if (replayNextClocks <= totalClocks) replayEvents();
+        while (!events.empty() && events.front().clocks <= totalClocks) {
+            std::pop_heap(events.begin(), events.end(), isLaterEvent);
+            Event event = events.back();
+            events.pop_back();
+            updateNextEvent();
+            event.callback(CB.arg, event.clocks);
+        }
+    }
+
+    // remaining clocks until the next event (up to clock)
+    inline int eventHorizon(int clock)
+    {
+        if (nextEventClocks <= totalClocks) return 1;
+        unsigned long long left = nextEventClocks - totalClocks;
+        return left < (unsigned long long)clock ? (int)left : clock;
+    }
+
+    static inline void putVarint(std::vector<unsigned char>& log, unsigned long long value)
+    {
+        for (; 0x80 <= value; value >>= 7) log.push_back((unsigned char)(value | 0x80));
+        log.push_back((unsigned char)value);
+    }
+
+    inline bool getVarint(const unsigned char*& p, unsigned long long& value)
+    {
+        value = 0;
+        for (int shift = 0; p < replayEnd && shift < 64; shift += 7) {
+            unsigned char byte = *p++;
+            value |= (unsigned long long)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    // append the record: varint(delta clocks << 4 | outside << 3 | kind) and the payload of the kind
+    inline void recordInput(int kind, unsigned int value, unsigned int id = 0)
+    {
+        std::vector<unsigned char>& log = *recordLog;
+        putVarint(log, (totalClocks - recordClocks) << 4 | (executing ? 0 : 8) | (unsigned int)kind);
+        recordClocks = totalClocks;
+        switch (kind) {
+            case INPUT_IN:
+            case INPUT_READ:
+            case INPUT_IRQ: log.push_back((unsigned char)value); break;
+            case INPUT_NMI:
+                log.push_back((unsigned char)value);
+                log.push_back((unsigned char)(value >> 8));
+                break;
+            case INPUT_HOST:
+                putVarint(log, id);
+                putVarint(log, value);
+                break;
+        }
+    }
+
+    // read the next record of the cursor's kinds (due = ULLONG_MAX at the end of the log)
+    inline void advanceInput(InputCursor& cursor)
+    {
+        InputRecord& record = cursor.record;
+        unsigned long long header, id, value;
+        cursor.due = ULLONG_MAX;
+        while (getVarint(cursor.ptr, header)) {
+            cursor.clocks += header >> 4;
+            record.kind = (int)(header & 7);
+            record.outside = header & 8;
+            record.clocks = cursor.clocks;
+            record.id = 0;
+            record.value = 0;
+            if (INPUT_IN == record.kind || INPUT_READ == record.kind || INPUT_IRQ == record.kind) {
+                if (replayEnd - cursor.ptr < 1) break;
+                record.value = *cursor.ptr++;
+            } else if (INPUT_NMI == record.kind) {
+                if (replayEnd - cursor.ptr < 2) break;
+                record.value = (unsigned int)(cursor.ptr[0] | cursor.ptr[1] << 8);
+                cursor.ptr += 2;
+            } else if (INPUT_HOST == record.kind) {
+                if (!getVarint(cursor.ptr, id) || !getVarint(cursor.ptr, value)) break;
+                record.id = (unsigned int)id;
+                record.value = (unsigned int)value;
+            }
+            if (cursor.mask & (1 << record.kind)) {
+                // NOTE: the interrupts requested outside of execute are accepted after the next instruction
+                cursor.due = record.outside && INPUT_HOST != record.kind ? record.clocks + 1 : record.clocks;
+                return;
+            }
+        }
+        cursor.ptr = replayEnd;
+    }
+
+    inline void startInput(InputCursor& cursor, const unsigned char* log, int mask)
+    {
+        cursor.ptr = log;
+        cursor.clocks = totalClocks;
+        cursor.mask = mask;
+        advanceInput(cursor);
+    }
+
+    // the result of the in or read callback from the log
+    inline unsigned char replayInput(int kind)
+    {
+        if (ULLONG_MAX == replayIn.due) {
+            replayDiverged = true;
+            return 0xFF;
+        }
+        if (replayIn.record.clocks != totalClocks || replayIn.record.kind != kind) replayDiverged = true;
+        unsigned char value = (unsigned char)replayIn.record.value;
+        advanceInput(replayIn);
+        return value;
+    }
+
+    // request or cancel the interrupt (the replay uses it while generateIRQ, generateNMI and cancelIRQ of the host are ignored)
+    inline void applyInterrupt(int kind, unsigned short value)
+    {
+        if (recordLog) recordInput(kind, value);
+        switch (kind) {
+            case INPUT_IRQ:
+                reg.interrupt |= 0b01000000;
+                reg.interruptVector = value;
+                break;
+            case INPUT_NMI:
+                reg.interrupt |= 0b10000000;
+                reg.interruptAddrN = value;
+                break;
+            case INPUT_CANCEL_IRQ: reg.interrupt &= 0b10111111; break;
+        }
+    }
+
+    inline bool isReplayDue(InputCursor& cursor, bool all) { return cursor.due <= totalClocks || (all && ULLONG_MAX != cursor.due && cursor.record.clocks <= totalClocks); }
+
+    // the host events and the interrupts reached to their clocks (all: including the interrupts deferred to the next instruction)
+    inline void replayEvents(bool all = false)
+    {
+        while (isReplayDue(replayHost, all)) {
+            if (CB.replayHostEventEnabled) CB.replayHostEvent(CB.arg, (unsigned short)replayHost.record.id, replayHost.record.value);
+            advanceInput(replayHost);
+        }
+        while (isReplayDue(replayInterrupt, all)) {
+            applyInterrupt(replayInterrupt.record.kind, (unsigned short)replayInterrupt.record.value);
+            advanceInput(replayInterrupt);
+        }
+        replayNextClocks = replayHost.due < replayInterrupt.due ? replayHost.due : replayInterrupt.due;
+        updateNextEvent();
+    }
+
+    inline unsigned char inPort(unsigned short port)
+    {
+        unsigned char byte;
+        if (replaying) {
+            byte = replayInput(INPUT_IN);
+        } else {
+            byte = bus.in(CB.arg, port);
+            if (recordLog) recordInput(INPUT_IN, byte);
+        }
+#ifndef Z80_DISABLE_TRACE
+        if (trace.current) traceRead(TRACE_IN, port, byte);
+#endif
+        return byte;
+    }
+
+    // update the instrumented flag (execute switches the loop at the next instruction)
+    inline void updateInstrumented()
+    {
+        instrumented = false;
+#ifndef Z80_DISABLE_DEBUG
+        instrumented = instrumented || CB.debugMessageEnabled;
+#endif
+#ifndef Z80_DISABLE_BREAKPOINT
+        instrumented = instrumented || !CB.breakPoints.empty() || !CB.breakOperands.empty();
+#endif
+#ifndef Z80_DISABLE_TRACE
+        instrumented = instrumented || trace.buffer;
+#endif
+    }
 
 #ifndef Z80_DISABLE_BREAKPOINT
+    inline bool hasBreakPoint(unsigned short addr) { return CB.breakPointBits[addr >> 3] & bits[addr & 7]; }
+
+    // index of the first break point of the address (or the address after it)
+    inline size_t findBreakPoint(unsigned short addr)
+    {
+        auto it = std::lower_bound(CB.breakPoints.begin(), CB.breakPoints.end(), addr, [](const BreakPoint* bp, unsigned short a) {
+            return bp->addr < a;
+        });
+        return (size_t)(it - CB.breakPoints.begin());
+    }
+
     inline void checkBreakPoint()
     {
-        auto it = CB.breakPoints.find(reg.PC);
-        if (it == CB.breakPoints.end()) return;
-        for (auto bp : *CB.breakPoints[reg.PC]) {
-            bp->callback(CB.arg);
+        if (!hasBreakPoint(reg.PC)) return;
+        flushFlags();
+        unsigned short addr = reg.PC;
+        // NOTE: the callback can add or remove the break points (the removed ones are deleted after the callbacks, and not called)
+        std::vector<BreakPoint*> hits;
+        for (size_t i = findBreakPoint(addr); i < CB.breakPoints.size() && CB.breakPoints[i]->addr == addr; i++) {
+            hits.push_back(CB.breakPoints[i]);
+        }
+        bool nested = CB.checkingBreakPoints;
+        CB.checkingBreakPoints = true;
+        for (auto bp : hits) {
+            if (std::find(CB.removedBreakPoints.begin(), CB.removedBreakPoints.end(), bp) == CB.removedBreakPoints.end()) {
+                bp->callback(CB.arg);
+            }
+        }
+        CB.checkingBreakPoints = nested;
+        if (!nested) {
+            for (auto bp : CB.removedBreakPoints) delete bp;
+            CB.removedBreakPoints.clear();
+        }
+    }
+
+    inline void deleteBreakPoint(BreakPoint* bp)
+    {
+        if (CB.checkingBreakPoints) {
+            CB.removedBreakPoints.push_back(bp);
+        } else {
+            delete bp;
         }
     }
 
@@ -314,9 +1169,9 @@ class Z80
         switch (operand->prefixNumber) {
             case 0x00:
                 opcode[0] = operand->operandNumber;
-                *opcodeLength = opLength1[opcode[0]];
+                *opcodeLength = instructionTable1[opcode[0]].length;
                 for (int i = 1; i < *opcodeLength; i++) {
-                    opcode[i] = readByte(reg.PC + i - 1, 0); // read without consume clocks
+                    opcode[i] = readByte<true>(reg.PC + i - 1, 0); // read without consume clocks
                 }
                 break;
             case 0xCB:
@@ -327,67 +1182,129 @@ class Z80
             case 0xED:
                 opcode[0] = 0xED;
                 opcode[1] = operand->operandNumber;
-                *opcodeLength = opLengthED[opcode[1]];
+                *opcodeLength = instructionTableED[opcode[1]].length;
                 for (int i = 2; i < *opcodeLength; i++) {
-                    opcode[i] = readByte(reg.PC + i - 2, 0); // read without consume clocks
+                    opcode[i] = readByte<true>(reg.PC + i - 2, 0); // read without consume clocks
                 }
                 break;
             case 0xDD:
                 opcode[0] = 0xDD;
                 opcode[1] = operand->operandNumber;
-                *opcodeLength = opLengthIXY[opcode[1]];
+                *opcodeLength = instructionTableIXY[opcode[1]].length;
                 for (int i = 2; i < *opcodeLength; i++) {
-                    opcode[i] = readByte(reg.PC + i - 2, 0); // read without consume clocks
+                    opcode[i] = readByte<true>(reg.PC + i - 2, 0); // read without consume clocks
                 }
                 break;
             case 0xFD:
                 opcode[0] = 0xFD;
                 opcode[1] = operand->operandNumber;
-                *opcodeLength = opLengthIXY[opcode[1]];
+                *opcodeLength = instructionTableIXY[opcode[1]].length;
                 for (int i = 2; i < *opcodeLength; i++) {
-                    opcode[i] = readByte(reg.PC + i - 2, 0); // read without consume clocks
+                    opcode[i] = readByte<true>(reg.PC + i - 2, 0); // read without consume clocks
                 }
                 break;
             case 0xDDCB:
                 opcode[0] = 0xDD;
                 opcode[1] = 0xCB;
                 opcode[2] = operand->operandNumber;
-                opcode[3] = readByte(reg.PC, 0);
+                opcode[3] = readByte<true>(reg.PC, 0);
                 *opcodeLength = 4;
                 break;
             case 0xFDCB:
                 opcode[0] = 0xFD;
                 opcode[1] = 0xCB;
                 opcode[2] = operand->operandNumber;
-                opcode[3] = readByte(reg.PC, 0);
+                opcode[3] = readByte<true>(reg.PC, 0);
                 *opcodeLength = 4;
                 break;
         }
     }
 
-    inline void checkBreakOperand(int operandNumber)
+    // index of breakOperandBits by the prefix (-1: the number is never executed)
+    static inline int breakOperandSlot(int number)
+    {
+        switch (number >> 8) {
+            case 0x00: return 0;
+            case 0xCB: return 1;
+            case 0xED: return 2;
+            case 0xDD: return 3;
+            case 0xFD: return 4;
+            case 0xDDCB: return 5;
+            case 0xFDCB: return 6;
+            default: return -1;
+        }
+    }
+
+    inline bool hasBreakOperand(int slot, unsigned char operandNumber) { return CB.breakOperandBits[slot][operandNumber >> 3] & bits[operandNumber & 7]; }
+
+    inline void setBreakOperandBit(int number, bool on)
+    {
+        int slot = breakOperandSlot(number);
+        if (slot < 0) return;
+        if (on) {
+            CB.breakOperandBits[slot][(number & 0xFF) >> 3] |= bits[number & 7];
+        } else {
+            CB.breakOperandBits[slot][(number & 0xFF) >> 3] &= ~bits[number & 7];
+        }
+    }
+
+    // index of the first break operand of the number (or the number after it)
+    inline size_t findBreakOperand(int number)
+    {
+        auto it = std::lower_bound(CB.breakOperands.begin(), CB.breakOperands.end(), number, [](const BreakOperand* bo, int n) {
+            return bo->number < n;
+        });
+        return (size_t)(it - CB.breakOperands.begin());
+    }
+
+    inline void checkBreakOperand(int slot, int number)
     {
-        if (CB.breakOperands.empty()) return;
-        auto it = CB.breakOperands.find(operandNumber);
-        if (it == CB.breakOperands.end()) return;
+        if (!hasBreakOperand(slot, number & 0xFF)) return;
+        flushFlags();
         unsigned char opcode[16];
         int opcodeLength = 16;
-        bool first = true;
-        for (auto bo : *CB.breakOperands[operandNumber]) {
-            if (first) {
-                readFullOpcode(bo, opcode, &opcodeLength);
-                first = false;
+        // NOTE: the callback can add or remove the break operands (the removed ones are deleted after the callbacks, and not called)
+        std::vector<BreakOperand*> hits;
+        for (size_t i = findBreakOperand(number); i < CB.breakOperands.size() && CB.breakOperands[i]->number == number; i++) {
+            hits.push_back(CB.breakOperands[i]);
+        }
+        if (hits.empty()) return;
+        readFullOpcode(hits[0], opcode, &opcodeLength);
+        bool nested = CB.checkingBreakOperands;
+        CB.checkingBreakOperands = true;
+        for (auto bo : hits) {
+            if (std::find(CB.removedBreakOperands.begin(), CB.removedBreakOperands.end(), bo) == CB.removedBreakOperands.end()) {
+                bo->callback(CB.arg, opcode, opcodeLength);
             }
-            bo->callback(CB.arg, opcode, opcodeLength);
         }
+        CB.checkingBreakOperands = nested;
+        if (!nested) {
+            for (auto bo : CB.removedBreakOperands) delete bo;
+            CB.removedBreakOperands.clear();
+        }
+    }
+
+    inline void deleteBreakOperand(BreakOperand* bo)
+    {
+        if (CB.checkingBreakOperands) {
+            CB.removedBreakOperands.push_back(bo);
+        } else {
+            delete bo;
+        }
+    }
+
+    inline void checkBreakOperand(int number)
+    {
+        int slot = breakOperandSlot(number);
+        if (0 <= slot) checkBreakOperand(slot, number);
     }
 
-    inline void checkBreakOperandCB(unsigned char operandNumber) { checkBreakOperand(0xCB00 | operandNumber); }
-    inline void checkBreakOperandED(unsigned char operandNumber) { checkBreakOperand(0xED00 | operandNumber); }
-    inline void checkBreakOperandIX(unsigned char operandNumber) { checkBreakOperand(0xDD00 | operandNumber); }
-    inline void checkBreakOperandIY(unsigned char operandNumber) { checkBreakOperand(0xFD00 | operandNumber); }
-    inline void checkBreakOperandIX4(unsigned char operandNumber) { checkBreakOperand(0xDDCB00 | operandNumber); }
-    inline void checkBreakOperandIY4(unsigned char operandNumber) { checkBreakOperand(0xFDCB00 | operandNumber); }
+    inline void checkBreakOperandCB(unsigned char operandNumber) { checkBreakOperand(1, 0xCB00 | operandNumber); }
+    inline void checkBreakOperandED(unsigned char operandNumber) { checkBreakOperand(2, 0xED00 | operandNumber); }
+    inline void checkBreakOperandIX(unsigned char operandNumber) { checkBreakOperand(3, 0xDD00 | operandNumber); }
+    inline void checkBreakOperandIY(unsigned char operandNumber) { checkBreakOperand(4, 0xFD00 | operandNumber); }
+    inline void checkBreakOperandIX4(unsigned char operandNumber) { checkBreakOperand(5, 0xDDCB00 | operandNumber); }
+    inline void checkBreakOperandIY4(unsigned char operandNumber) { checkBreakOperand(6, 0xFDCB00 | operandNumber); }
 #endif
 
 #ifndef Z80_DISABLE_DEBUG
@@ -398,30 +1315,38 @@ class Z80
         va_start(args, format);
         vsnprintf(buf, sizeof(buf), format, args);
         va_end(args);
+        flushFlags();
         CB.debugMessage(CB.arg, buf);
     }
 #endif
 
     inline unsigned short getAF()
     {
-        return make16BitsFromLE(reg.pair.F, reg.pair.A);
-    }
-    inline unsigned short getAF2() { return make16BitsFromLE(reg.back.F, reg.back.A); }
-    inline unsigned short getBC() { return make16BitsFromLE(reg.pair.C, reg.pair.B); }
-    inline unsigned short getBC2() { return make16BitsFromLE(reg.back.C, reg.back.B); }
-    inline unsigned short getDE() { return make16BitsFromLE(reg.pair.E, reg.pair.D); }
-    inline unsigned short getDE2() { return make16BitsFromLE(reg.back.E, reg.back.D); }
-    inline unsigned short getHL() { return make16BitsFromLE(reg.pair.L, reg.pair.H); }
-    inline unsigned short getHL2() { return make16BitsFromLE(reg.back.L, reg.back.H); }
-
-    inline void setAF(unsigned short value) { splitTo8BitsPair(value, &reg.pair.A, &reg.pair.F); }
-    inline void setAF2(unsigned short value) { splitTo8BitsPair(value, &reg.back.A, &reg.back.F); }
-    inline void setBC(unsigned short value) { splitTo8BitsPair(value, &reg.pair.B, &reg.pair.C); }
-    inline void setBC2(unsigned short value) { splitTo8BitsPair(value, &reg.back.B, &reg.back.C); }
-    inline void setDE(unsigned short value) { splitTo8BitsPair(value, &reg.pair.D, &reg.pair.E); }
-    inline void setDE2(unsigned short value) { splitTo8BitsPair(value, &reg.back.D, &reg.back.E); }
-    inline void setHL(unsigned short value) { splitTo8BitsPair(value, &reg.pair.H, &reg.pair.L); }
-    inline void setHL2(unsigned short value) { splitTo8BitsPair(value, &reg.back.H, &reg.back.L); }
+        flushFlags();
+        return reg.pair.AF;
+    }
+    inline unsigned short getAF2() { return reg.back.AF; }
+    inline unsigned short getBC() { return reg.pair.BC; }
+    inline unsigned short getBC2() { return reg.back.BC; }
+    inline unsigned short getDE() { return reg.pair.DE; }
+    inline unsigned short getDE2() { return reg.back.DE; }
+    inline unsigned short getHL() { return reg.pair.HL; }
+    inline unsigned short getHL2() { return reg.back.HL; }
+
+    inline void setAF(unsigned short value)
+    {
+#ifdef Z80_LAZY_FLAGS
+        lazy.kind = 0;
+#endif
+        reg.pair.AF = value;
+    }
+    inline void setAF2(unsigned short value) { reg.back.AF = value; }
+    inline void setBC(unsigned short value) { reg.pair.BC = value; }
+    inline void setBC2(unsigned short value) { reg.back.BC = value; }
+    inline void setDE(unsigned short value) { reg.pair.DE = value; }
+    inline void setDE2(unsigned short value) { reg.back.DE = value; }
+    inline void setHL(unsigned short value) { reg.pair.HL = value; }
+    inline void setHL2(unsigned short value) { reg.back.HL = value; }
 
     inline unsigned short getRP(unsigned char rp)
     {
@@ -463,44 +1388,36 @@ class Z80
         }
     }
 
-    inline unsigned char getIXH() { return (reg.IX & 0xFF00) >> 8; }
-    inline unsigned char getIXL() { return reg.IX & 0x00FF; }
-    inline unsigned char getIYH() { return (reg.IY & 0xFF00) >> 8; }
-    inline unsigned char getIYL() { return reg.IY & 0x00FF; }
+    inline unsigned char getIXH() { return reg.IXH; }
+    inline unsigned char getIXL() { return reg.IXL; }
+    inline unsigned char getIYH() { return reg.IYH; }
+    inline unsigned char getIYL() { return reg.IYL; }
     inline unsigned char getPCH() { return (reg.PC & 0xFF00) >> 8; }
     inline unsigned char getPCL() { return reg.PC & 0x00FF; }
     inline void setPCH(unsigned char v) { reg.PC = (reg.PC & 0x00FF) + v * 256; }
     inline void setPCL(unsigned char v) { reg.PC = (reg.PC & 0xFF00) + v; }
     inline void setSPH(unsigned char v) { reg.SP = (reg.SP & 0x00FF) + v * 256; }
     inline void setSPL(unsigned char v) { reg.SP = (reg.SP & 0xFF00) + v; }
-    inline void setIXH(unsigned char v) { reg.IX = (reg.IX & 0x00FF) + v * 256; }
-    inline void setIXL(unsigned char v) { reg.IX = (reg.IX & 0xFF00) + v; }
-    inline void setIYH(unsigned char v) { reg.IY = (reg.IY & 0x00FF) + v * 256; }
-    inline void setIYL(unsigned char v) { reg.IY = (reg.IY & 0xFF00) + v; }
-
-    inline bool isEvenNumberBits(unsigned char value)
-    {
-        int on = 0;
-        int off = 0;
-        value & 0b10000000 ? on++ : off++;
-        value & 0b01000000 ? on++ : off++;
-        value & 0b00100000 ? on++ : off++;
-        value & 0b00010000 ? on++ : off++;
-        value & 0b00001000 ? on++ : off++;
-        value & 0b00000100 ? on++ : off++;
-        value & 0b00000010 ? on++ : off++;
-        value & 0b00000001 ? on++ : off++;
-        return (on & 1) == 0;
-    }
+    inline void setIXH(unsigned char v) { reg.IXH = v; }
+    inline void setIXL(unsigned char v) { reg.IXL = v; }
+    inline void setIYH(unsigned char v) { reg.IYH = v; }
+    inline void setIYL(unsigned char v) { reg.IYL = v; }
+
+    inline bool isEvenNumberBits(unsigned char value) { return flagTableSZ53P[value] & flagPV(); }
 
     inline void consumeClock(int hz)
     {
         reg.consumeClockCounter += hz;
+        totalClocks += (unsigned int)hz;
 #ifndef Z80_CALLBACK_PER_INSTRUCTION
 #ifdef Z80_CALLBACK_WITHOUT_CHECK
+        flushFlags();
         CB.consumeClock(CB.arg, hz);
 #else
-        if (CB.consumeClockEnabled && hz) CB.consumeClock(CB.arg, hz);
+        if (CB.consumeClockEnabled && hz) {
+            flushFlags();
+            CB.consumeClock(CB.arg, hz);
+        }
 #endif
 #endif
     }
@@ -508,12 +1425,21 @@ class Z80
     inline unsigned short getPort16WithB(unsigned char c) { return make16BitsFromLE(c, reg.pair.B); }
     inline unsigned short getPort16WithA(unsigned char c) { return make16BitsFromLE(c, reg.pair.A); }
 
+    inline void outPort(unsigned short port, unsigned char value)
+    {
+#ifndef Z80_DISABLE_TRACE
+        if (trace.current) traceWrite(TRACE_OUT, port, value);
+#endif
+        if (!replaying) bus.out(CB.arg, port, value);
+    }
+
     inline unsigned char inPortWithB(unsigned char port, int clock = 4)
     {
+        flushFlags();
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        unsigned char byte = CB.in(CB.arg, port);
+        unsigned char byte = inPort(port);
 #else
-        unsigned char byte = CB.in(CB.arg, CB.returnPortAs16Bits ? getPort16WithB(port) : port);
+        unsigned char byte = inPort(CB.returnPortAs16Bits ? getPort16WithB(port) : port);
 #endif
         consumeClock(clock);
         return byte;
@@ -521,10 +1447,11 @@ class Z80
 
     inline unsigned char inPortWithA(unsigned char port, int clock = 4)
     {
+        flushFlags();
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        unsigned char byte = CB.in(CB.arg, port);
+        unsigned char byte = inPort(port);
 #else
-        unsigned char byte = CB.in(CB.arg, CB.returnPortAs16Bits ? getPort16WithA(port) : port);
+        unsigned char byte = inPort(CB.returnPortAs16Bits ? getPort16WithA(port) : port);
 #endif
         consumeClock(clock);
         return byte;
@@ -532,32 +1459,34 @@ class Z80
 
     inline void outPortWithB(unsigned char port, unsigned char value, int clock = 4)
     {
+        flushFlags();
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        CB.out(CB.arg, port, value);
+        outPort(port, value);
 #else
-        CB.out(CB.arg, CB.returnPortAs16Bits ? getPort16WithB(port) : port, value);
+        outPort(CB.returnPortAs16Bits ? getPort16WithB(port) : port, value);
 #endif
         consumeClock(clock);
     }
 
     inline void outPortWithA(unsigned char port, unsigned char value, int clock = 4)
     {
+        flushFlags();
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        CB.out(CB.arg, port, value);
+        outPort(port, value);
 #else
-        CB.out(CB.arg, CB.returnPortAs16Bits ? getPort16WithA(port) : port, value);
+        outPort(CB.returnPortAs16Bits ? getPort16WithA(port) : port, value);
 #endif
         consumeClock(clock);
     }
 
-    static inline void NOP(Z80* ctx)
+    static inline void NOP(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] NOP", ctx->reg.PC - 1);
 #endif
     }
 
-    static inline void HALT(Z80* ctx)
+    static inline void HALT(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] HALT", ctx->reg.PC - 1);
@@ -565,7 +1494,7 @@ class Z80
         ctx->reg.IFF |= ctx->IFF_HALT();
     }
 
-    static inline void DI(Z80* ctx)
+    static inline void DI(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] DI", ctx->reg.PC - 1);
@@ -573,7 +1502,7 @@ class Z80
         ctx->reg.IFF &= ~(ctx->IFF1() | ctx->IFF2());
     }
 
-    static inline void EI(Z80* ctx)
+    static inline void EI(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] EI", ctx->reg.PC - 1);
@@ -582,9 +1511,9 @@ class Z80
         ctx->reg.execEI = 1;
     }
 
-    static inline void IM0(Z80* ctx) { ctx->IM(0); }
-    static inline void IM1(Z80* ctx) { ctx->IM(1); }
-    static inline void IM2(Z80* ctx) { ctx->IM(2); }
+    static inline void IM0(Z80Core* ctx) { ctx->IM(0); }
+    static inline void IM1(Z80Core* ctx) { ctx->IM(1); }
+    static inline void IM2(Z80Core* ctx) { ctx->IM(2); }
     inline void IM(unsigned char interrptMode)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -594,7 +1523,7 @@ class Z80
         reg.interrupt |= interrptMode & 0b11;
     }
 
-    static inline void LD_A_I_(Z80* ctx) { ctx->LD_A_I(); }
+    static inline void LD_A_I_(Z80Core* ctx) { ctx->LD_A_I(); }
     inline void LD_A_I()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -605,7 +1534,7 @@ class Z80
         consumeClock(1);
     }
 
-    static inline void LD_I_A_(Z80* ctx) { ctx->LD_I_A(); }
+    static inline void LD_I_A_(Z80Core* ctx) { ctx->LD_I_A(); }
     inline void LD_I_A()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -615,7 +1544,7 @@ class Z80
         consumeClock(1);
     }
 
-    static inline void LD_A_R_(Z80* ctx) { ctx->LD_A_R(); }
+    static inline void LD_A_R_(Z80Core* ctx) { ctx->LD_A_R(); }
     inline void LD_A_R()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -626,7 +1555,7 @@ class Z80
         consumeClock(1);
     }
 
-    static inline void LD_R_A_(Z80* ctx) { ctx->LD_R_A(); }
+    static inline void LD_R_A_(Z80Core* ctx) { ctx->LD_R_A(); }
     inline void LD_R_A()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -636,16 +1565,20 @@ class Z80
         consumeClock(1);
     }
 
-    static inline void OP_CB(Z80* ctx)
+    static inline void OP_CB(Z80Core* ctx)
     {
         unsigned char operandNumber = ctx->fetch(4 + ctx->wtc.fetchM);
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandCB(operandNumber);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchCB(operandNumber);
+#else
         ctx->opSetCB[operandNumber](ctx);
+#endif
     }
 
-    static inline void OP_ED(Z80* ctx)
+    static inline void OP_ED(Z80Core* ctx)
     {
         unsigned char operandNumber = ctx->fetch(4 + ctx->wtc.fetchM);
 #ifndef Z80_NO_EXCEPTION
@@ -658,10 +1591,14 @@ class Z80
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandED(operandNumber);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchED(operandNumber);
+#else
         ctx->opSetED[operandNumber](ctx);
+#endif
     }
 
-    static inline void OP_IX(Z80* ctx)
+    static inline void OP_IX(Z80Core* ctx)
     {
         unsigned char operandNumber = ctx->fetch(4 + ctx->wtc.fetchM);
 #ifndef Z80_NO_EXCEPTION
@@ -674,10 +1611,14 @@ class Z80
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandIX(operandNumber);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchIX(operandNumber);
+#else
         ctx->opSetIX[operandNumber](ctx);
+#endif
     }
 
-    static inline void OP_IY(Z80* ctx)
+    static inline void OP_IY(Z80Core* ctx)
     {
         unsigned char operandNumber = ctx->fetch(4 + ctx->wtc.fetchM);
 #ifndef Z80_NO_EXCEPTION
@@ -690,31 +1631,43 @@ class Z80
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandIY(operandNumber);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchIY(operandNumber);
+#else
         ctx->opSetIY[operandNumber](ctx);
+#endif
     }
 
-    static inline void OP_IX4(Z80* ctx)
+    static inline void OP_IX4(Z80Core* ctx)
     {
         signed char op3 = (signed char)ctx->fetch(4);
         unsigned char op4 = ctx->fetch(4);
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandIX4(op4);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchIX4(op4, op3);
+#else
         ctx->opSetIX4[op4](ctx, op3);
+#endif
     }
 
-    static inline void OP_IY4(Z80* ctx)
+    static inline void OP_IY4(Z80Core* ctx)
     {
         signed char op3 = (signed char)ctx->fetch(4);
         unsigned char op4 = ctx->fetch(4);
 #ifndef Z80_DISABLE_BREAKPOINT
         ctx->checkBreakOperandIY4(op4);
 #endif
+#ifdef Z80_SWITCH_DISPATCH
+        ctx->dispatchIY4(op4, op3);
+#else
         ctx->opSetIY4[op4](ctx, op3);
+#endif
     }
 
     // Load location (HL) with value n
-    static inline void LD_HL_N(Z80* ctx)
+    static inline void LD_HL_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
         unsigned short hl = ctx->getHL();
@@ -725,7 +1678,7 @@ class Z80
     }
 
     // Load Acc. wth location (BC)
-    static inline void LD_A_BC(Z80* ctx)
+    static inline void LD_A_BC(Z80Core* ctx)
     {
         unsigned short addr = ctx->getBC();
         unsigned char n = ctx->readByte(addr, 3);
@@ -736,7 +1689,7 @@ class Z80
     }
 
     // Load Acc. wth location (DE)
-    static inline void LD_A_DE(Z80* ctx)
+    static inline void LD_A_DE(Z80Core* ctx)
     {
         unsigned short addr = ctx->getDE();
         unsigned char n = ctx->readByte(addr, 3);
@@ -747,7 +1700,7 @@ class Z80
     }
 
     // Load Acc. wth location (nn)
-    static inline void LD_A_NN(Z80* ctx)
+    static inline void LD_A_NN(Z80Core* ctx)
     {
         unsigned char l = ctx->fetch(3);
         unsigned char h = ctx->fetch(3);
@@ -760,7 +1713,7 @@ class Z80
     }
 
     // Load location (BC) wtih Acc.
-    static inline void LD_BC_A(Z80* ctx)
+    static inline void LD_BC_A(Z80Core* ctx)
     {
         unsigned short addr = ctx->getBC();
         unsigned char n = ctx->reg.pair.A;
@@ -771,7 +1724,7 @@ class Z80
     }
 
     // Load location (DE) wtih Acc.
-    static inline void LD_DE_A(Z80* ctx)
+    static inline void LD_DE_A(Z80Core* ctx)
     {
         unsigned short addr = ctx->getDE();
         unsigned char n = ctx->reg.pair.A;
@@ -782,7 +1735,7 @@ class Z80
     }
 
     // Load location (nn) with Acc.
-    static inline void LD_NN_A(Z80* ctx)
+    static inline void LD_NN_A(Z80Core* ctx)
     {
         unsigned char l = ctx->fetch(3);
         unsigned char h = ctx->fetch(3);
@@ -795,7 +1748,7 @@ class Z80
     }
 
     // Load HL with location (nn).
-    static inline void LD_HL_ADDR(Z80* ctx)
+    static inline void LD_HL_ADDR(Z80Core* ctx)
     {
         unsigned char l = ctx->fetch(3);
         unsigned char h = ctx->fetch(3);
@@ -811,7 +1764,7 @@ class Z80
     }
 
     // Load location (nn) with HL.
-    static inline void LD_ADDR_HL(Z80* ctx)
+    static inline void LD_ADDR_HL(Z80Core* ctx)
     {
         unsigned char l = ctx->fetch(3);
         unsigned char h = ctx->fetch(3);
@@ -824,7 +1777,7 @@ class Z80
     }
 
     // Load SP with HL.
-    static inline void LD_SP_HL(Z80* ctx)
+    static inline void LD_SP_HL(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] LD %s, HL<$%04X>", ctx->reg.PC - 1, ctx->registerPairDump(0b11), ctx->getHL());
@@ -834,7 +1787,7 @@ class Z80
     }
 
     // Exchange H and L with D and E
-    static inline void EX_DE_HL(Z80* ctx)
+    static inline void EX_DE_HL(Z80Core* ctx)
     {
         unsigned short de = ctx->getDE();
         unsigned short hl = ctx->getHL();
@@ -846,7 +1799,7 @@ class Z80
     }
 
     // Exchange A and F with A' and F'
-    static inline void EX_AF_AF2(Z80* ctx)
+    static inline void EX_AF_AF2(Z80Core* ctx)
     {
         unsigned short af = ctx->getAF();
         unsigned short af2 = ctx->getAF2();
@@ -857,7 +1810,7 @@ class Z80
         ctx->setAF2(af);
     }
 
-    static inline void EX_SP_HL(Z80* ctx)
+    static inline void EX_SP_HL(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         unsigned short sp = ctx->reg.SP;
@@ -874,7 +1827,7 @@ class Z80
         ctx->reg.pair.L = l;
     }
 
-    static inline void EXX(Z80* ctx)
+    static inline void EXX(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] EXX", ctx->reg.PC - 1);
@@ -906,18 +1859,18 @@ class Z80
         return value;
     }
 
-    static inline void PUSH_AF(Z80* ctx)
+    static inline void PUSH_AF(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
-        if (ctx->isDebug()) ctx->log("[%04X] PUSH AF<$%02X%02X> <SP:$%04X>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->reg.pair.F, ctx->reg.SP);
+        if (ctx->isDebug()) ctx->log("[%04X] PUSH AF<$%02X%02X> <SP:$%04X>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->regF(), ctx->reg.SP);
 #endif
         ctx->push(ctx->reg.pair.A, 4);
-        ctx->push(ctx->reg.pair.F, 3);
+        ctx->push(ctx->regF(), 3);
     }
 
-    static inline void POP_AF(Z80* ctx)
+    static inline void POP_AF(Z80Core* ctx)
     {
-        ctx->reg.pair.F = ctx->pop(3);
+        ctx->regF() = ctx->pop(3);
         ctx->reg.pair.A = ctx->pop(3);
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] POP AF <SP:$%04X> = $%04X", ctx->reg.PC - 1, ctx->reg.SP - 2, ctx->getAF());
@@ -948,7 +1901,7 @@ class Z80
             case 0b011: snprintf(E, sizeof(E), "E<$%02X>", reg.pair.E); return E;
             case 0b100: snprintf(H, sizeof(H), "H<$%02X>", reg.pair.H); return H;
             case 0b101: snprintf(L, sizeof(L), "L<$%02X>", reg.pair.L); return L;
-            case 0b110: snprintf(F, sizeof(F), "F<$%02X>", reg.pair.F); return F;
+            case 0b110: snprintf(F, sizeof(F), "F<$%02X>", regF()); return F;
         }
         unknown[0] = '?';
         unknown[1] = '\0';
@@ -1056,80 +2009,80 @@ class Z80
 #endif
 
     // Load Reg. r1 with Reg. r2
-    static inline void LD_B_B(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b000); }
-    static inline void LD_B_C(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b001); }
-    static inline void LD_B_D(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b010); }
-    static inline void LD_B_E(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b011); }
-    static inline void LD_B_B_2(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b000, 2); }
-    static inline void LD_B_C_2(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b001, 2); }
-    static inline void LD_B_D_2(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b010, 2); }
-    static inline void LD_B_E_2(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b011, 2); }
-    static inline void LD_B_H(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b100); }
-    static inline void LD_B_L(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b101); }
-    static inline void LD_B_A(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b111); }
-    static inline void LD_C_B(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b000); }
-    static inline void LD_C_C(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b001); }
-    static inline void LD_C_D(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b010); }
-    static inline void LD_C_E(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b011); }
-    static inline void LD_B_A_2(Z80* ctx) { ctx->LD_R1_R2(0b000, 0b111, 2); }
-    static inline void LD_C_B_2(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b000, 2); }
-    static inline void LD_C_C_2(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b001, 2); }
-    static inline void LD_C_D_2(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b010, 2); }
-    static inline void LD_C_E_2(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b011, 2); }
-    static inline void LD_C_H(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b100); }
-    static inline void LD_C_L(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b101); }
-    static inline void LD_C_A(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b111); }
-    static inline void LD_D_B(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b000); }
-    static inline void LD_D_C(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b001); }
-    static inline void LD_D_D(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b010); }
-    static inline void LD_D_E(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b011); }
-    static inline void LD_C_A_2(Z80* ctx) { ctx->LD_R1_R2(0b001, 0b111, 2); }
-    static inline void LD_D_B_2(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b000, 2); }
-    static inline void LD_D_C_2(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b001, 2); }
-    static inline void LD_D_D_2(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b010, 2); }
-    static inline void LD_D_E_2(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b011, 2); }
-    static inline void LD_D_H(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b100); }
-    static inline void LD_D_L(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b101); }
-    static inline void LD_D_A(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b111); }
-    static inline void LD_E_B(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b000); }
-    static inline void LD_E_C(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b001); }
-    static inline void LD_E_D(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b010); }
-    static inline void LD_E_E(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b011); }
-    static inline void LD_D_A_2(Z80* ctx) { ctx->LD_R1_R2(0b010, 0b111, 2); }
-    static inline void LD_E_B_2(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b000, 2); }
-    static inline void LD_E_C_2(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b001, 2); }
-    static inline void LD_E_D_2(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b010, 2); }
-    static inline void LD_E_E_2(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b011, 2); }
-    static inline void LD_E_H(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b100); }
-    static inline void LD_E_L(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b101); }
-    static inline void LD_E_A(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b111); }
-    static inline void LD_E_A_2(Z80* ctx) { ctx->LD_R1_R2(0b011, 0b111, 2); }
-    static inline void LD_H_B(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b000); }
-    static inline void LD_H_C(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b001); }
-    static inline void LD_H_D(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b010); }
-    static inline void LD_H_E(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b011); }
-    static inline void LD_H_H(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b100); }
-    static inline void LD_H_L(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b101); }
-    static inline void LD_H_A(Z80* ctx) { ctx->LD_R1_R2(0b100, 0b111); }
-    static inline void LD_L_B(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b000); }
-    static inline void LD_L_C(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b001); }
-    static inline void LD_L_D(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b010); }
-    static inline void LD_L_E(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b011); }
-    static inline void LD_L_H(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b100); }
-    static inline void LD_L_L(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b101); }
-    static inline void LD_L_A(Z80* ctx) { ctx->LD_R1_R2(0b101, 0b111); }
-    static inline void LD_A_B(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b000); }
-    static inline void LD_A_C(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b001); }
-    static inline void LD_A_D(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b010); }
-    static inline void LD_A_E(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b011); }
-    static inline void LD_A_B_2(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b000, 2); }
-    static inline void LD_A_C_2(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b001, 2); }
-    static inline void LD_A_D_2(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b010, 2); }
-    static inline void LD_A_E_2(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b011, 2); }
-    static inline void LD_A_H(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b100); }
-    static inline void LD_A_L(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b101); }
-    static inline void LD_A_A(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b111); }
-    static inline void LD_A_A_2(Z80* ctx) { ctx->LD_R1_R2(0b111, 0b111, 2); }
+    static inline void LD_B_B(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b000); }
+    static inline void LD_B_C(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b001); }
+    static inline void LD_B_D(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b010); }
+    static inline void LD_B_E(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b011); }
+    static inline void LD_B_B_2(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b000, 2); }
+    static inline void LD_B_C_2(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b001, 2); }
+    static inline void LD_B_D_2(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b010, 2); }
+    static inline void LD_B_E_2(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b011, 2); }
+    static inline void LD_B_H(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b100); }
+    static inline void LD_B_L(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b101); }
+    static inline void LD_B_A(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b111); }
+    static inline void LD_C_B(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b000); }
+    static inline void LD_C_C(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b001); }
+    static inline void LD_C_D(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b010); }
+    static inline void LD_C_E(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b011); }
+    static inline void LD_B_A_2(Z80Core* ctx) { ctx->LD_R1_R2(0b000, 0b111, 2); }
+    static inline void LD_C_B_2(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b000, 2); }
+    static inline void LD_C_C_2(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b001, 2); }
+    static inline void LD_C_D_2(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b010, 2); }
+    static inline void LD_C_E_2(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b011, 2); }
+    static inline void LD_C_H(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b100); }
+    static inline void LD_C_L(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b101); }
+    static inline void LD_C_A(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b111); }
+    static inline void LD_D_B(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b000); }
+    static inline void LD_D_C(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b001); }
+    static inline void LD_D_D(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b010); }
+    static inline void LD_D_E(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b011); }
+    static inline void LD_C_A_2(Z80Core* ctx) { ctx->LD_R1_R2(0b001, 0b111, 2); }
+    static inline void LD_D_B_2(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b000, 2); }
+    static inline void LD_D_C_2(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b001, 2); }
+    static inline void LD_D_D_2(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b010, 2); }
+    static inline void LD_D_E_2(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b011, 2); }
+    static inline void LD_D_H(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b100); }
+    static inline void LD_D_L(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b101); }
+    static inline void LD_D_A(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b111); }
+    static inline void LD_E_B(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b000); }
+    static inline void LD_E_C(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b001); }
+    static inline void LD_E_D(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b010); }
+    static inline void LD_E_E(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b011); }
+    static inline void LD_D_A_2(Z80Core* ctx) { ctx->LD_R1_R2(0b010, 0b111, 2); }
+    static inline void LD_E_B_2(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b000, 2); }
+    static inline void LD_E_C_2(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b001, 2); }
+    static inline void LD_E_D_2(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b010, 2); }
+    static inline void LD_E_E_2(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b011, 2); }
+    static inline void LD_E_H(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b100); }
+    static inline void LD_E_L(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b101); }
+    static inline void LD_E_A(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b111); }
+    static inline void LD_E_A_2(Z80Core* ctx) { ctx->LD_R1_R2(0b011, 0b111, 2); }
+    static inline void LD_H_B(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b000); }
+    static inline void LD_H_C(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b001); }
+    static inline void LD_H_D(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b010); }
+    static inline void LD_H_E(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b011); }
+    static inline void LD_H_H(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b100); }
+    static inline void LD_H_L(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b101); }
+    static inline void LD_H_A(Z80Core* ctx) { ctx->LD_R1_R2(0b100, 0b111); }
+    static inline void LD_L_B(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b000); }
+    static inline void LD_L_C(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b001); }
+    static inline void LD_L_D(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b010); }
+    static inline void LD_L_E(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b011); }
+    static inline void LD_L_H(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b100); }
+    static inline void LD_L_L(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b101); }
+    static inline void LD_L_A(Z80Core* ctx) { ctx->LD_R1_R2(0b101, 0b111); }
+    static inline void LD_A_B(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b000); }
+    static inline void LD_A_C(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b001); }
+    static inline void LD_A_D(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b010); }
+    static inline void LD_A_E(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b011); }
+    static inline void LD_A_B_2(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b000, 2); }
+    static inline void LD_A_C_2(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b001, 2); }
+    static inline void LD_A_D_2(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b010, 2); }
+    static inline void LD_A_E_2(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b011, 2); }
+    static inline void LD_A_H(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b100); }
+    static inline void LD_A_L(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b101); }
+    static inline void LD_A_A(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b111); }
+    static inline void LD_A_A_2(Z80Core* ctx) { ctx->LD_R1_R2(0b111, 0b111, 2); }
     inline void LD_R1_R2(unsigned char r1, unsigned char r2, int counter = 1)
     {
         unsigned char* r1p = getRegisterPointer(r1);
@@ -1141,18 +2094,18 @@ class Z80
     }
 
     // Load Reg. r with value n
-    static inline void LD_A_N(Z80* ctx) { ctx->LD_R_N(0b111); }
-    static inline void LD_B_N(Z80* ctx) { ctx->LD_R_N(0b000); }
-    static inline void LD_C_N(Z80* ctx) { ctx->LD_R_N(0b001); }
-    static inline void LD_D_N(Z80* ctx) { ctx->LD_R_N(0b010); }
-    static inline void LD_E_N(Z80* ctx) { ctx->LD_R_N(0b011); }
-    static inline void LD_H_N(Z80* ctx) { ctx->LD_R_N(0b100); }
-    static inline void LD_L_N(Z80* ctx) { ctx->LD_R_N(0b101); }
-    static inline void LD_A_N_3(Z80* ctx) { ctx->LD_R_N(0b111, 3); }
-    static inline void LD_B_N_3(Z80* ctx) { ctx->LD_R_N(0b000, 3); }
-    static inline void LD_C_N_3(Z80* ctx) { ctx->LD_R_N(0b001, 3); }
-    static inline void LD_D_N_3(Z80* ctx) { ctx->LD_R_N(0b010, 3); }
-    static inline void LD_E_N_3(Z80* ctx) { ctx->LD_R_N(0b011, 3); }
+    static inline void LD_A_N(Z80Core* ctx) { ctx->LD_R_N(0b111); }
+    static inline void LD_B_N(Z80Core* ctx) { ctx->LD_R_N(0b000); }
+    static inline void LD_C_N(Z80Core* ctx) { ctx->LD_R_N(0b001); }
+    static inline void LD_D_N(Z80Core* ctx) { ctx->LD_R_N(0b010); }
+    static inline void LD_E_N(Z80Core* ctx) { ctx->LD_R_N(0b011); }
+    static inline void LD_H_N(Z80Core* ctx) { ctx->LD_R_N(0b100); }
+    static inline void LD_L_N(Z80Core* ctx) { ctx->LD_R_N(0b101); }
+    static inline void LD_A_N_3(Z80Core* ctx) { ctx->LD_R_N(0b111, 3); }
+    static inline void LD_B_N_3(Z80Core* ctx) { ctx->LD_R_N(0b000, 3); }
+    static inline void LD_C_N_3(Z80Core* ctx) { ctx->LD_R_N(0b001, 3); }
+    static inline void LD_D_N_3(Z80Core* ctx) { ctx->LD_R_N(0b010, 3); }
+    static inline void LD_E_N_3(Z80Core* ctx) { ctx->LD_R_N(0b011, 3); }
     inline void LD_R_N(unsigned char r, int pc = 2)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1164,7 +2117,7 @@ class Z80
     }
 
     // Load Reg. IX(high) with value n
-    static inline void LD_IXH_N_(Z80* ctx) { ctx->LD_IXH_N(); }
+    static inline void LD_IXH_N_(Z80Core* ctx) { ctx->LD_IXH_N(); }
     inline void LD_IXH_N()
     {
         unsigned char n = fetch(3);
@@ -1175,11 +2128,11 @@ class Z80
     }
 
     // Load Reg. IX(high) with value Reg.
-    static inline void LD_IXH_A(Z80* ctx) { ctx->LD_IXH_R(0b111); }
-    static inline void LD_IXH_B(Z80* ctx) { ctx->LD_IXH_R(0b000); }
-    static inline void LD_IXH_C(Z80* ctx) { ctx->LD_IXH_R(0b001); }
-    static inline void LD_IXH_D(Z80* ctx) { ctx->LD_IXH_R(0b010); }
-    static inline void LD_IXH_E(Z80* ctx) { ctx->LD_IXH_R(0b011); }
+    static inline void LD_IXH_A(Z80Core* ctx) { ctx->LD_IXH_R(0b111); }
+    static inline void LD_IXH_B(Z80Core* ctx) { ctx->LD_IXH_R(0b000); }
+    static inline void LD_IXH_C(Z80Core* ctx) { ctx->LD_IXH_R(0b001); }
+    static inline void LD_IXH_D(Z80Core* ctx) { ctx->LD_IXH_R(0b010); }
+    static inline void LD_IXH_E(Z80Core* ctx) { ctx->LD_IXH_R(0b011); }
     inline void LD_IXH_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1190,7 +2143,7 @@ class Z80
     }
 
     // Load Reg. IX(high) with value IX(high)
-    static inline void LD_IXH_IXH_(Z80* ctx) { ctx->LD_IXH_IXH(); }
+    static inline void LD_IXH_IXH_(Z80Core* ctx) { ctx->LD_IXH_IXH(); }
     inline void LD_IXH_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1199,7 +2152,7 @@ class Z80
     }
 
     // Load Reg. IX(high) with value IX(low)
-    static inline void LD_IXH_IXL_(Z80* ctx) { ctx->LD_IXH_IXL(); }
+    static inline void LD_IXH_IXL_(Z80Core* ctx) { ctx->LD_IXH_IXL(); }
     inline void LD_IXH_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1209,7 +2162,7 @@ class Z80
     }
 
     // Load Reg. IX(low) with value n
-    static inline void LD_IXL_N_(Z80* ctx) { ctx->LD_IXL_N(); }
+    static inline void LD_IXL_N_(Z80Core* ctx) { ctx->LD_IXL_N(); }
     inline void LD_IXL_N()
     {
         unsigned char n = fetch(3);
@@ -1220,11 +2173,11 @@ class Z80
     }
 
     // Load Reg. IX(low) with value Reg.
-    static inline void LD_IXL_A(Z80* ctx) { ctx->LD_IXL_R(0b111); }
-    static inline void LD_IXL_B(Z80* ctx) { ctx->LD_IXL_R(0b000); }
-    static inline void LD_IXL_C(Z80* ctx) { ctx->LD_IXL_R(0b001); }
-    static inline void LD_IXL_D(Z80* ctx) { ctx->LD_IXL_R(0b010); }
-    static inline void LD_IXL_E(Z80* ctx) { ctx->LD_IXL_R(0b011); }
+    static inline void LD_IXL_A(Z80Core* ctx) { ctx->LD_IXL_R(0b111); }
+    static inline void LD_IXL_B(Z80Core* ctx) { ctx->LD_IXL_R(0b000); }
+    static inline void LD_IXL_C(Z80Core* ctx) { ctx->LD_IXL_R(0b001); }
+    static inline void LD_IXL_D(Z80Core* ctx) { ctx->LD_IXL_R(0b010); }
+    static inline void LD_IXL_E(Z80Core* ctx) { ctx->LD_IXL_R(0b011); }
     inline void LD_IXL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1235,7 +2188,7 @@ class Z80
     }
 
     // Load Reg. IX(low) with value IX(high)
-    static inline void LD_IXL_IXH_(Z80* ctx) { ctx->LD_IXL_IXH(); }
+    static inline void LD_IXL_IXH_(Z80Core* ctx) { ctx->LD_IXL_IXH(); }
     inline void LD_IXL_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1245,7 +2198,7 @@ class Z80
     }
 
     // Load Reg. IX(low) with value IX(low)
-    static inline void LD_IXL_IXL_(Z80* ctx) { ctx->LD_IXL_IXL(); }
+    static inline void LD_IXL_IXL_(Z80Core* ctx) { ctx->LD_IXL_IXL(); }
     inline void LD_IXL_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1254,7 +2207,7 @@ class Z80
     }
 
     // Load Reg. IY(high) with value n
-    static inline void LD_IYH_N_(Z80* ctx) { ctx->LD_IYH_N(); }
+    static inline void LD_IYH_N_(Z80Core* ctx) { ctx->LD_IYH_N(); }
     inline void LD_IYH_N()
     {
         unsigned char n = fetch(3);
@@ -1265,11 +2218,11 @@ class Z80
     }
 
     // Load Reg. IY(high) with value Reg.
-    static inline void LD_IYH_A(Z80* ctx) { ctx->LD_IYH_R(0b111); }
-    static inline void LD_IYH_B(Z80* ctx) { ctx->LD_IYH_R(0b000); }
-    static inline void LD_IYH_C(Z80* ctx) { ctx->LD_IYH_R(0b001); }
-    static inline void LD_IYH_D(Z80* ctx) { ctx->LD_IYH_R(0b010); }
-    static inline void LD_IYH_E(Z80* ctx) { ctx->LD_IYH_R(0b011); }
+    static inline void LD_IYH_A(Z80Core* ctx) { ctx->LD_IYH_R(0b111); }
+    static inline void LD_IYH_B(Z80Core* ctx) { ctx->LD_IYH_R(0b000); }
+    static inline void LD_IYH_C(Z80Core* ctx) { ctx->LD_IYH_R(0b001); }
+    static inline void LD_IYH_D(Z80Core* ctx) { ctx->LD_IYH_R(0b010); }
+    static inline void LD_IYH_E(Z80Core* ctx) { ctx->LD_IYH_R(0b011); }
     inline void LD_IYH_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1280,7 +2233,7 @@ class Z80
     }
 
     // Load Reg. IY(high) with value IY(high)
-    static inline void LD_IYH_IYH_(Z80* ctx) { ctx->LD_IYH_IYH(); }
+    static inline void LD_IYH_IYH_(Z80Core* ctx) { ctx->LD_IYH_IYH(); }
     inline void LD_IYH_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1289,7 +2242,7 @@ class Z80
     }
 
     // Load Reg. IY(high) with value IY(low)
-    static inline void LD_IYH_IYL_(Z80* ctx) { ctx->LD_IYH_IYL(); }
+    static inline void LD_IYH_IYL_(Z80Core* ctx) { ctx->LD_IYH_IYL(); }
     inline void LD_IYH_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1299,7 +2252,7 @@ class Z80
     }
 
     // Load Reg. IY(low) with value n
-    static inline void LD_IYL_N_(Z80* ctx) { ctx->LD_IYL_N(); }
+    static inline void LD_IYL_N_(Z80Core* ctx) { ctx->LD_IYL_N(); }
     inline void LD_IYL_N()
     {
         unsigned char n = fetch(3);
@@ -1310,11 +2263,11 @@ class Z80
     }
 
     // Load Reg. IY(low) with value Reg.
-    static inline void LD_IYL_A(Z80* ctx) { ctx->LD_IYL_R(0b111); }
-    static inline void LD_IYL_B(Z80* ctx) { ctx->LD_IYL_R(0b000); }
-    static inline void LD_IYL_C(Z80* ctx) { ctx->LD_IYL_R(0b001); }
-    static inline void LD_IYL_D(Z80* ctx) { ctx->LD_IYL_R(0b010); }
-    static inline void LD_IYL_E(Z80* ctx) { ctx->LD_IYL_R(0b011); }
+    static inline void LD_IYL_A(Z80Core* ctx) { ctx->LD_IYL_R(0b111); }
+    static inline void LD_IYL_B(Z80Core* ctx) { ctx->LD_IYL_R(0b000); }
+    static inline void LD_IYL_C(Z80Core* ctx) { ctx->LD_IYL_R(0b001); }
+    static inline void LD_IYL_D(Z80Core* ctx) { ctx->LD_IYL_R(0b010); }
+    static inline void LD_IYL_E(Z80Core* ctx) { ctx->LD_IYL_R(0b011); }
     inline void LD_IYL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1325,7 +2278,7 @@ class Z80
     }
 
     // Load Reg. IY(low) with value IY(high)
-    static inline void LD_IYL_IYH_(Z80* ctx) { ctx->LD_IYL_IYH(); }
+    static inline void LD_IYL_IYH_(Z80Core* ctx) { ctx->LD_IYL_IYH(); }
     inline void LD_IYL_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1335,7 +2288,7 @@ class Z80
     }
 
     // Load Reg. IY(low) with value IY(low)
-    static inline void LD_IYL_IYL_(Z80* ctx) { ctx->LD_IYL_IYL(); }
+    static inline void LD_IYL_IYL_(Z80Core* ctx) { ctx->LD_IYL_IYL(); }
     inline void LD_IYL_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1344,13 +2297,13 @@ class Z80
     }
 
     // Load Reg. r with location (HL)
-    static inline void LD_B_HL(Z80* ctx) { ctx->LD_R_HL(0b000); }
-    static inline void LD_C_HL(Z80* ctx) { ctx->LD_R_HL(0b001); }
-    static inline void LD_D_HL(Z80* ctx) { ctx->LD_R_HL(0b010); }
-    static inline void LD_E_HL(Z80* ctx) { ctx->LD_R_HL(0b011); }
-    static inline void LD_H_HL(Z80* ctx) { ctx->LD_R_HL(0b100); }
-    static inline void LD_L_HL(Z80* ctx) { ctx->LD_R_HL(0b101); }
-    static inline void LD_A_HL(Z80* ctx) { ctx->LD_R_HL(0b111); }
+    static inline void LD_B_HL(Z80Core* ctx) { ctx->LD_R_HL(0b000); }
+    static inline void LD_C_HL(Z80Core* ctx) { ctx->LD_R_HL(0b001); }
+    static inline void LD_D_HL(Z80Core* ctx) { ctx->LD_R_HL(0b010); }
+    static inline void LD_E_HL(Z80Core* ctx) { ctx->LD_R_HL(0b011); }
+    static inline void LD_H_HL(Z80Core* ctx) { ctx->LD_R_HL(0b100); }
+    static inline void LD_L_HL(Z80Core* ctx) { ctx->LD_R_HL(0b101); }
+    static inline void LD_A_HL(Z80Core* ctx) { ctx->LD_R_HL(0b111); }
     inline void LD_R_HL(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1362,13 +2315,13 @@ class Z80
     }
 
     // Load Reg. r with location (IX+d)
-    static inline void LD_A_IX(Z80* ctx) { ctx->LD_R_IX(0b111); }
-    static inline void LD_B_IX(Z80* ctx) { ctx->LD_R_IX(0b000); }
-    static inline void LD_C_IX(Z80* ctx) { ctx->LD_R_IX(0b001); }
-    static inline void LD_D_IX(Z80* ctx) { ctx->LD_R_IX(0b010); }
-    static inline void LD_E_IX(Z80* ctx) { ctx->LD_R_IX(0b011); }
-    static inline void LD_H_IX(Z80* ctx) { ctx->LD_R_IX(0b100); }
-    static inline void LD_L_IX(Z80* ctx) { ctx->LD_R_IX(0b101); }
+    static inline void LD_A_IX(Z80Core* ctx) { ctx->LD_R_IX(0b111); }
+    static inline void LD_B_IX(Z80Core* ctx) { ctx->LD_R_IX(0b000); }
+    static inline void LD_C_IX(Z80Core* ctx) { ctx->LD_R_IX(0b001); }
+    static inline void LD_D_IX(Z80Core* ctx) { ctx->LD_R_IX(0b010); }
+    static inline void LD_E_IX(Z80Core* ctx) { ctx->LD_R_IX(0b011); }
+    static inline void LD_H_IX(Z80Core* ctx) { ctx->LD_R_IX(0b100); }
+    static inline void LD_L_IX(Z80Core* ctx) { ctx->LD_R_IX(0b101); }
     inline void LD_R_IX(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1382,11 +2335,11 @@ class Z80
     }
 
     // Load Reg. r with IXH
-    static inline void LD_A_IXH(Z80* ctx) { ctx->LD_R_IXH(0b111); }
-    static inline void LD_B_IXH(Z80* ctx) { ctx->LD_R_IXH(0b000); }
-    static inline void LD_C_IXH(Z80* ctx) { ctx->LD_R_IXH(0b001); }
-    static inline void LD_D_IXH(Z80* ctx) { ctx->LD_R_IXH(0b010); }
-    static inline void LD_E_IXH(Z80* ctx) { ctx->LD_R_IXH(0b011); }
+    static inline void LD_A_IXH(Z80Core* ctx) { ctx->LD_R_IXH(0b111); }
+    static inline void LD_B_IXH(Z80Core* ctx) { ctx->LD_R_IXH(0b000); }
+    static inline void LD_C_IXH(Z80Core* ctx) { ctx->LD_R_IXH(0b001); }
+    static inline void LD_D_IXH(Z80Core* ctx) { ctx->LD_R_IXH(0b010); }
+    static inline void LD_E_IXH(Z80Core* ctx) { ctx->LD_R_IXH(0b011); }
     inline void LD_R_IXH(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1397,11 +2350,11 @@ class Z80
     }
 
     // Load Reg. r with IXL
-    static inline void LD_A_IXL(Z80* ctx) { ctx->LD_R_IXL(0b111); }
-    static inline void LD_B_IXL(Z80* ctx) { ctx->LD_R_IXL(0b000); }
-    static inline void LD_C_IXL(Z80* ctx) { ctx->LD_R_IXL(0b001); }
-    static inline void LD_D_IXL(Z80* ctx) { ctx->LD_R_IXL(0b010); }
-    static inline void LD_E_IXL(Z80* ctx) { ctx->LD_R_IXL(0b011); }
+    static inline void LD_A_IXL(Z80Core* ctx) { ctx->LD_R_IXL(0b111); }
+    static inline void LD_B_IXL(Z80Core* ctx) { ctx->LD_R_IXL(0b000); }
+    static inline void LD_C_IXL(Z80Core* ctx) { ctx->LD_R_IXL(0b001); }
+    static inline void LD_D_IXL(Z80Core* ctx) { ctx->LD_R_IXL(0b010); }
+    static inline void LD_E_IXL(Z80Core* ctx) { ctx->LD_R_IXL(0b011); }
     inline void LD_R_IXL(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1412,13 +2365,13 @@ class Z80
     }
 
     // Load Reg. r with location (IY+d)
-    static inline void LD_A_IY(Z80* ctx) { ctx->LD_R_IY(0b111); }
-    static inline void LD_B_IY(Z80* ctx) { ctx->LD_R_IY(0b000); }
-    static inline void LD_C_IY(Z80* ctx) { ctx->LD_R_IY(0b001); }
-    static inline void LD_D_IY(Z80* ctx) { ctx->LD_R_IY(0b010); }
-    static inline void LD_E_IY(Z80* ctx) { ctx->LD_R_IY(0b011); }
-    static inline void LD_H_IY(Z80* ctx) { ctx->LD_R_IY(0b100); }
-    static inline void LD_L_IY(Z80* ctx) { ctx->LD_R_IY(0b101); }
+    static inline void LD_A_IY(Z80Core* ctx) { ctx->LD_R_IY(0b111); }
+    static inline void LD_B_IY(Z80Core* ctx) { ctx->LD_R_IY(0b000); }
+    static inline void LD_C_IY(Z80Core* ctx) { ctx->LD_R_IY(0b001); }
+    static inline void LD_D_IY(Z80Core* ctx) { ctx->LD_R_IY(0b010); }
+    static inline void LD_E_IY(Z80Core* ctx) { ctx->LD_R_IY(0b011); }
+    static inline void LD_H_IY(Z80Core* ctx) { ctx->LD_R_IY(0b100); }
+    static inline void LD_L_IY(Z80Core* ctx) { ctx->LD_R_IY(0b101); }
     inline void LD_R_IY(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1432,11 +2385,11 @@ class Z80
     }
 
     // Load Reg. r with IYH
-    static inline void LD_A_IYH(Z80* ctx) { ctx->LD_R_IYH(0b111); }
-    static inline void LD_B_IYH(Z80* ctx) { ctx->LD_R_IYH(0b000); }
-    static inline void LD_C_IYH(Z80* ctx) { ctx->LD_R_IYH(0b001); }
-    static inline void LD_D_IYH(Z80* ctx) { ctx->LD_R_IYH(0b010); }
-    static inline void LD_E_IYH(Z80* ctx) { ctx->LD_R_IYH(0b011); }
+    static inline void LD_A_IYH(Z80Core* ctx) { ctx->LD_R_IYH(0b111); }
+    static inline void LD_B_IYH(Z80Core* ctx) { ctx->LD_R_IYH(0b000); }
+    static inline void LD_C_IYH(Z80Core* ctx) { ctx->LD_R_IYH(0b001); }
+    static inline void LD_D_IYH(Z80Core* ctx) { ctx->LD_R_IYH(0b010); }
+    static inline void LD_E_IYH(Z80Core* ctx) { ctx->LD_R_IYH(0b011); }
     inline void LD_R_IYH(unsigned char r)
     {
         unsigned char iyh = getIYH();
@@ -1448,11 +2401,11 @@ class Z80
     }
 
     // Load Reg. r with IYL
-    static inline void LD_A_IYL(Z80* ctx) { ctx->LD_R_IYL(0b111); }
-    static inline void LD_B_IYL(Z80* ctx) { ctx->LD_R_IYL(0b000); }
-    static inline void LD_C_IYL(Z80* ctx) { ctx->LD_R_IYL(0b001); }
-    static inline void LD_D_IYL(Z80* ctx) { ctx->LD_R_IYL(0b010); }
-    static inline void LD_E_IYL(Z80* ctx) { ctx->LD_R_IYL(0b011); }
+    static inline void LD_A_IYL(Z80Core* ctx) { ctx->LD_R_IYL(0b111); }
+    static inline void LD_B_IYL(Z80Core* ctx) { ctx->LD_R_IYL(0b000); }
+    static inline void LD_C_IYL(Z80Core* ctx) { ctx->LD_R_IYL(0b001); }
+    static inline void LD_D_IYL(Z80Core* ctx) { ctx->LD_R_IYL(0b010); }
+    static inline void LD_E_IYL(Z80Core* ctx) { ctx->LD_R_IYL(0b011); }
     inline void LD_R_IYL(unsigned char r)
     {
         unsigned char iyl = getIYL();
@@ -1464,13 +2417,13 @@ class Z80
     }
 
     // Load location (HL) with Reg. r
-    static inline void LD_HL_B(Z80* ctx) { ctx->LD_HL_R(0b000); }
-    static inline void LD_HL_C(Z80* ctx) { ctx->LD_HL_R(0b001); }
-    static inline void LD_HL_D(Z80* ctx) { ctx->LD_HL_R(0b010); }
-    static inline void LD_HL_E(Z80* ctx) { ctx->LD_HL_R(0b011); }
-    static inline void LD_HL_H(Z80* ctx) { ctx->LD_HL_R(0b100); }
-    static inline void LD_HL_L(Z80* ctx) { ctx->LD_HL_R(0b101); }
-    static inline void LD_HL_A(Z80* ctx) { ctx->LD_HL_R(0b111); }
+    static inline void LD_HL_B(Z80Core* ctx) { ctx->LD_HL_R(0b000); }
+    static inline void LD_HL_C(Z80Core* ctx) { ctx->LD_HL_R(0b001); }
+    static inline void LD_HL_D(Z80Core* ctx) { ctx->LD_HL_R(0b010); }
+    static inline void LD_HL_E(Z80Core* ctx) { ctx->LD_HL_R(0b011); }
+    static inline void LD_HL_H(Z80Core* ctx) { ctx->LD_HL_R(0b100); }
+    static inline void LD_HL_L(Z80Core* ctx) { ctx->LD_HL_R(0b101); }
+    static inline void LD_HL_A(Z80Core* ctx) { ctx->LD_HL_R(0b111); }
     inline void LD_HL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1482,13 +2435,13 @@ class Z80
     }
 
     // 	Load location (IX+d) with Reg. r
-    static inline void LD_IX_A(Z80* ctx) { ctx->LD_IX_R(0b111); }
-    static inline void LD_IX_B(Z80* ctx) { ctx->LD_IX_R(0b000); }
-    static inline void LD_IX_C(Z80* ctx) { ctx->LD_IX_R(0b001); }
-    static inline void LD_IX_D(Z80* ctx) { ctx->LD_IX_R(0b010); }
-    static inline void LD_IX_E(Z80* ctx) { ctx->LD_IX_R(0b011); }
-    static inline void LD_IX_H(Z80* ctx) { ctx->LD_IX_R(0b100); }
-    static inline void LD_IX_L(Z80* ctx) { ctx->LD_IX_R(0b101); }
+    static inline void LD_IX_A(Z80Core* ctx) { ctx->LD_IX_R(0b111); }
+    static inline void LD_IX_B(Z80Core* ctx) { ctx->LD_IX_R(0b000); }
+    static inline void LD_IX_C(Z80Core* ctx) { ctx->LD_IX_R(0b001); }
+    static inline void LD_IX_D(Z80Core* ctx) { ctx->LD_IX_R(0b010); }
+    static inline void LD_IX_E(Z80Core* ctx) { ctx->LD_IX_R(0b011); }
+    static inline void LD_IX_H(Z80Core* ctx) { ctx->LD_IX_R(0b100); }
+    static inline void LD_IX_L(Z80Core* ctx) { ctx->LD_IX_R(0b101); }
     inline void LD_IX_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1502,13 +2455,13 @@ class Z80
     }
 
     // 	Load location (IY+d) with Reg. r
-    static inline void LD_IY_A(Z80* ctx) { ctx->LD_IY_R(0b111); }
-    static inline void LD_IY_B(Z80* ctx) { ctx->LD_IY_R(0b000); }
-    static inline void LD_IY_C(Z80* ctx) { ctx->LD_IY_R(0b001); }
-    static inline void LD_IY_D(Z80* ctx) { ctx->LD_IY_R(0b010); }
-    static inline void LD_IY_E(Z80* ctx) { ctx->LD_IY_R(0b011); }
-    static inline void LD_IY_H(Z80* ctx) { ctx->LD_IY_R(0b100); }
-    static inline void LD_IY_L(Z80* ctx) { ctx->LD_IY_R(0b101); }
+    static inline void LD_IY_A(Z80Core* ctx) { ctx->LD_IY_R(0b111); }
+    static inline void LD_IY_B(Z80Core* ctx) { ctx->LD_IY_R(0b000); }
+    static inline void LD_IY_C(Z80Core* ctx) { ctx->LD_IY_R(0b001); }
+    static inline void LD_IY_D(Z80Core* ctx) { ctx->LD_IY_R(0b010); }
+    static inline void LD_IY_E(Z80Core* ctx) { ctx->LD_IY_R(0b011); }
+    static inline void LD_IY_H(Z80Core* ctx) { ctx->LD_IY_R(0b100); }
+    static inline void LD_IY_L(Z80Core* ctx) { ctx->LD_IY_R(0b101); }
     inline void LD_IY_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -1522,7 +2475,7 @@ class Z80
     }
 
     // Load location (IX+d) with value n
-    static inline void LD_IX_N_(Z80* ctx) { ctx->LD_IX_N(); }
+    static inline void LD_IX_N_(Z80Core* ctx) { ctx->LD_IX_N(); }
     inline void LD_IX_N()
     {
         signed char d = (signed char)fetch(4);
@@ -1535,7 +2488,7 @@ class Z80
     }
 
     // Load location (IY+d) with value n
-    static inline void LD_IY_N_(Z80* ctx) { ctx->LD_IY_N(); }
+    static inline void LD_IY_N_(Z80Core* ctx) { ctx->LD_IY_N(); }
     inline void LD_IY_N()
     {
         signed char d = (signed char)fetch(4);
@@ -1548,10 +2501,10 @@ class Z80
     }
 
     // Load Reg. pair rp with value nn.
-    static inline void LD_BC_NN(Z80* ctx) { ctx->LD_RP_NN(0b00); }
-    static inline void LD_DE_NN(Z80* ctx) { ctx->LD_RP_NN(0b01); }
-    static inline void LD_HL_NN(Z80* ctx) { ctx->LD_RP_NN(0b10); }
-    static inline void LD_SP_NN(Z80* ctx) { ctx->LD_RP_NN(0b11); }
+    static inline void LD_BC_NN(Z80Core* ctx) { ctx->LD_RP_NN(0b00); }
+    static inline void LD_DE_NN(Z80Core* ctx) { ctx->LD_RP_NN(0b01); }
+    static inline void LD_HL_NN(Z80Core* ctx) { ctx->LD_RP_NN(0b10); }
+    static inline void LD_SP_NN(Z80Core* ctx) { ctx->LD_RP_NN(0b11); }
     inline void LD_RP_NN(unsigned char rp)
     {
         unsigned char* rH;
@@ -1602,7 +2555,7 @@ class Z80
 #endif
     }
 
-    static inline void LD_IX_NN_(Z80* ctx) { ctx->LD_IX_NN(); }
+    static inline void LD_IX_NN_(Z80Core* ctx) { ctx->LD_IX_NN(); }
     inline void LD_IX_NN()
     {
         setIXL(fetch(3));
@@ -1612,7 +2565,7 @@ class Z80
 #endif
     }
 
-    static inline void LD_IY_NN_(Z80* ctx) { ctx->LD_IY_NN(); }
+    static inline void LD_IY_NN_(Z80Core* ctx) { ctx->LD_IY_NN(); }
     inline void LD_IY_NN()
     {
         setIYL(fetch(3));
@@ -1623,10 +2576,10 @@ class Z80
     }
 
     // Load Reg. pair rp with location (nn)
-    static inline void LD_RP_ADDR_BC(Z80* ctx) { ctx->LD_RP_ADDR(0b00); }
-    static inline void LD_RP_ADDR_DE(Z80* ctx) { ctx->LD_RP_ADDR(0b01); }
-    static inline void LD_RP_ADDR_HL(Z80* ctx) { ctx->LD_RP_ADDR(0b10); }
-    static inline void LD_RP_ADDR_SP(Z80* ctx) { ctx->LD_RP_ADDR(0b11); }
+    static inline void LD_RP_ADDR_BC(Z80Core* ctx) { ctx->LD_RP_ADDR(0b00); }
+    static inline void LD_RP_ADDR_DE(Z80Core* ctx) { ctx->LD_RP_ADDR(0b01); }
+    static inline void LD_RP_ADDR_HL(Z80Core* ctx) { ctx->LD_RP_ADDR(0b10); }
+    static inline void LD_RP_ADDR_SP(Z80Core* ctx) { ctx->LD_RP_ADDR(0b11); }
     inline void LD_RP_ADDR(unsigned char rp)
     {
         unsigned char l = fetch(3);
@@ -1680,10 +2633,10 @@ class Z80
     }
 
     // Load location (nn) with Reg. pair rp.
-    static inline void LD_ADDR_RP_BC(Z80* ctx) { ctx->LD_ADDR_RP(0b00); }
-    static inline void LD_ADDR_RP_DE(Z80* ctx) { ctx->LD_ADDR_RP(0b01); }
-    static inline void LD_ADDR_RP_HL(Z80* ctx) { ctx->LD_ADDR_RP(0b10); }
-    static inline void LD_ADDR_RP_SP(Z80* ctx) { ctx->LD_ADDR_RP(0b11); }
+    static inline void LD_ADDR_RP_BC(Z80Core* ctx) { ctx->LD_ADDR_RP(0b00); }
+    static inline void LD_ADDR_RP_DE(Z80Core* ctx) { ctx->LD_ADDR_RP(0b01); }
+    static inline void LD_ADDR_RP_HL(Z80Core* ctx) { ctx->LD_ADDR_RP(0b10); }
+    static inline void LD_ADDR_RP_SP(Z80Core* ctx) { ctx->LD_ADDR_RP(0b11); }
     inline void LD_ADDR_RP(unsigned char rp)
     {
         unsigned char l = fetch(3);
@@ -1723,7 +2676,7 @@ class Z80
     }
 
     // Load IX with location (nn)
-    static inline void LD_IX_ADDR_(Z80* ctx) { ctx->LD_IX_ADDR(); }
+    static inline void LD_IX_ADDR_(Z80Core* ctx) { ctx->LD_IX_ADDR(); }
     inline void LD_IX_ADDR()
     {
         unsigned char l = fetch(3);
@@ -1740,7 +2693,7 @@ class Z80
     }
 
     // Load IY with location (nn)
-    static inline void LD_IY_ADDR_(Z80* ctx) { ctx->LD_IY_ADDR(); }
+    static inline void LD_IY_ADDR_(Z80Core* ctx) { ctx->LD_IY_ADDR(); }
     inline void LD_IY_ADDR()
     {
         unsigned char l = fetch(3);
@@ -1756,7 +2709,7 @@ class Z80
 #endif
     }
 
-    static inline void LD_ADDR_IX_(Z80* ctx) { ctx->LD_ADDR_IX(); }
+    static inline void LD_ADDR_IX_(Z80Core* ctx) { ctx->LD_ADDR_IX(); }
     inline void LD_ADDR_IX()
     {
         unsigned char l = fetch(3);
@@ -1769,7 +2722,7 @@ class Z80
         writeByte(addr + 1, getIXH(), 3);
     }
 
-    static inline void LD_ADDR_IY_(Z80* ctx) { ctx->LD_ADDR_IY(); }
+    static inline void LD_ADDR_IY_(Z80Core* ctx) { ctx->LD_ADDR_IY(); }
     inline void LD_ADDR_IY()
     {
         unsigned char l = fetch(3);
@@ -1783,7 +2736,7 @@ class Z80
     }
 
     // Load SP with IX.
-    static inline void LD_SP_IX_(Z80* ctx) { ctx->LD_SP_IX(); }
+    static inline void LD_SP_IX_(Z80Core* ctx) { ctx->LD_SP_IX(); }
     inline void LD_SP_IX()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1794,7 +2747,7 @@ class Z80
     }
 
     // Load SP with IY.
-    static inline void LD_SP_IY_(Z80* ctx) { ctx->LD_SP_IY(); }
+    static inline void LD_SP_IY_(Z80Core* ctx) { ctx->LD_SP_IY(); }
     inline void LD_SP_IY()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1804,11 +2757,186 @@ class Z80
         consumeClock(2);
     }
 
-    // Load location (DE) with Loacation (HL), increment/decrement DE, HL, decrement BC
-    inline void repeatLD(bool isIncDEHL, bool isRepeat)
+    // consume the clocks of the skipped iterations (added to the clocks of the current instruction)
+    inline void skipClocks(int clocks)
     {
-#ifndef Z80_DISABLE_DEBUG
-        if (isDebug()) {
+        skippedClocks += clocks;
+        totalClocks += (unsigned int)clocks;
+    }
+
+    // true if nothing can observe each iteration of the repeat instructions and the idle loops (callbacks, break points, interrupts)
+    inline bool isRepeatFastPathAvailable()
+    {
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+        return false;
+#else
+        if (CB.consumeClockEnabled || requestBreakFlag || (reg.interrupt & 0b11000000)) return false;
+#ifndef Z80_DISABLE_DEBUG
+        if (isDebug()) return false;
+#endif
+#ifndef Z80_DISABLE_BREAKPOINT
+        if (!CB.breakPoints.empty() || !CB.breakOperands.empty()) return false;
+#endif
+#ifndef Z80_DISABLE_TRACE
+        if (trace.buffer) return false;
+#endif
+#ifndef Z80_DISABLE_PROFILE
+        if (profile.data) return false;
+#endif
+        return true;
+#endif
+    }
+
+    // clocks of an iteration of the repeat instructions (ED prefix, operand, body and the repeat)
+    inline int repeatClocks(int body) { return wtc.fetch + wtc.read + 2 + 2 + wtc.read + 4 + wtc.fetchM + body + 5; }
+
+    // iterations that execute runs from the current one (included) within the remaining clocks and BC
+    inline int repeatCount(int clocks)
+    {
+        int count = clockLeft / clocks + (clockLeft % clocks ? 1 : 0);
+        int bc = getBC() ? getBC() : 0x10000;
+        return count < bc ? count : bc;
+    }
+
+    // true if the opcode bytes of an idle loop are on the mapped memory (fetching them has no side effect)
+    inline bool isIdleLoopMapped(unsigned short addr, int size)
+    {
+        for (int i = 0; i < size; i++) {
+            if (!pageMap[((addr + i) & 0xFFFF) >> 8].read) return false;
+        }
+        return true;
+    }
+
+    // clocks of an instruction with an immediate byte (opcode, immediate and the clocks after them)
+    inline int immediateClocks(int body) { return wtc.fetch + wtc.read + 2 + 2 + wtc.read + 3 + body; }
+
+    // iterations of an idle loop that execute runs after the current one within the remaining clocks (up to limit)
+    inline int idleCount(int clocks, int limit)
+    {
+        if (INT_MAX == clockLeft) return 0; // execute() without the clocks
+        int count = clockLeft / clocks + (clockLeft % clocks ? 1 : 0) - 1;
+        return count < limit ? count : limit;
+    }
+
+    // skip the iterations of an idle loop (R is incremented at each opcode fetch)
+    inline void skipIdleLoop(int count, int clocks, int fetches)
+    {
+        reg.R = ((reg.R + count * fetches) & 0x7F) | (reg.R & 0x80);
+        skipClocks(count * clocks);
+    }
+
+    // IN A, ($n) / AND $m / JR Z, $-4: skip the iterations while the device declares that the port is stable
+    inline void skipPollingLoop()
+    {
+        if (!CB.portStableEnabled || recordLog || replaying || reg.pair.A || !isRepeatFastPathAvailable() || !isIdleLoopMapped(reg.PC, 6)) return;
+        if (0xDB != readMemory(reg.PC) || 0xE6 != readMemory(reg.PC + 2)) return;
+        unsigned char n = readMemory(reg.PC + 1);
+#ifdef Z80_UNSUPPORT_16BIT_PORT
+        unsigned short port = n;
+#else
+        unsigned short port = CB.returnPortAs16Bits ? getPort16WithA(n) : n;
+#endif
+        flushFlags();
+        int stable = CB.portStable(CB.arg, port);
+        int clocks = immediateClocks(4) + immediateClocks(0) + immediateClocks(5);
+        if (clocks <= stable) skipIdleLoop(idleCount(clocks, stable / clocks), clocks, 3);
+    }
+
+    // execute the iterations of LDIR/LDDR on the mapped memory until an unmapped page or the opcode itself
+    inline int repeatLDNative(bool isIncDEHL, int count)
+    {
+        unsigned short opcode = reg.PC - 2;
+        int done = 0;
+        while (done < count) {
+            unsigned short hl = getHL();
+            unsigned short de = getDE();
+            unsigned char* src = pageMap[hl >> 8].read;
+            unsigned char* dst = pageMap[de >> 8].write;
+            if (!src || !dst) break;
+            int len = count - done;
+            int room = isIncDEHL ? 0x100 - (hl & 0xFF) : (hl & 0xFF) + 1;
+            if (room < len) len = room;
+            room = isIncDEHL ? 0x100 - (de & 0xFF) : (de & 0xFF) + 1;
+            if (room < len) len = room;
+            bool stop = false;
+            for (int i = 0; i < 2; i++) {
+                int distance = (isIncDEHL ? opcode + i - de : de - opcode - i) & 0xFFFF;
+                if (distance < len) {
+                    len = distance;
+                    stop = true;
+                }
+            }
+#ifdef Z80_DECODE_CACHE
+            for (int i = 0; i < len; i++) {
+                unsigned short addr = (unsigned short)(isIncDEHL ? de + i : de - i);
+                if (decodedBytes[addr >> 3] & bits[addr & 7]) {
+                    invalidateDecodedPage(addr >> 8);
+                    break;
+                }
+            }
+#endif
+            markDirtyPage(de);
+            src += hl & 0xFF;
+            dst += de & 0xFF;
+            if (isIncDEHL) {
+                if (dst <= src || src + len <= dst) {
+                    memmove(dst, src, (size_t)len);
+                } else {
+                    for (int i = 0; i < len; i++) dst[i] = src[i]; // propagates the pattern as the Z80 does
+                }
+                setHL((unsigned short)(hl + len));
+                setDE((unsigned short)(de + len));
+            } else {
+                if (src <= dst || dst + len <= src) {
+                    memmove(dst - len + 1, src - len + 1, (size_t)len);
+                } else {
+                    for (int i = 0; i < len; i++) dst[-i] = src[-i];
+                }
+                setHL((unsigned short)(hl - len));
+                setDE((unsigned short)(de - len));
+            }
+            setBC((unsigned short)(getBC() - len));
+            done += len;
+            if (stop) break;
+        }
+        reg.R = ((reg.R + done) & 0x7F) | (reg.R & 0x80);
+        return done;
+    }
+
+    // execute the iterations of CPIR/CPDR on the mapped memory until an unmapped page or the matched byte
+    inline int repeatCPNative(bool isIncHL, int count)
+    {
+        int done = 0;
+        while (done < count) {
+            unsigned short hl = getHL();
+            unsigned char* src = pageMap[hl >> 8].read;
+            if (!src) break;
+            int len = count - done;
+            int room = isIncHL ? 0x100 - (hl & 0xFF) : (hl & 0xFF) + 1;
+            if (room < len) len = room;
+            src += hl & 0xFF;
+            int n = 0;
+            if (isIncHL) {
+                void* hit = memchr(src, reg.pair.A, (size_t)len);
+                n = hit ? (int)((unsigned char*)hit - src) : len;
+            } else {
+                while (n < len && src[-n] != reg.pair.A) n++;
+            }
+            setHL((unsigned short)(isIncHL ? hl + n : hl - n));
+            setBC((unsigned short)(getBC() - n));
+            reg.WZ = (unsigned short)(isIncHL ? reg.WZ + n : reg.WZ - n);
+            done += n;
+            if (n < len) break;
+        }
+        reg.R = ((reg.R + done) & 0x7F) | (reg.R & 0x80);
+        return done;
+    }
+
+    // Load location (DE) with Loacation (HL), increment/decrement DE, HL, decrement BC
+    inline void repeatLD(bool isIncDEHL, bool isRepeat)
+    {
+#ifndef Z80_DISABLE_DEBUG
+        if (isDebug()) {
             if (isIncDEHL) {
                 if (isDebug()) log("[%04X] %s ... %s, %s, %s", reg.PC - 2, isRepeat ? "LDIR" : "LDI", registerPairDump(0b00), registerPairDump(0b01), registerPairDump(0b10));
             } else {
@@ -1816,6 +2944,12 @@ class Z80
             }
         }
 #endif
+        if (isRepeat && isRepeatFastPathAvailable()) {
+            // run the iterations except the last one natively, and the last one as usual (sets the flags)
+            int clocks = repeatClocks(wtc.read + 4 + wtc.write + 4);
+            int count = repeatCount(clocks) - 1;
+            if (0 < count) skipClocks(repeatLDNative(isIncDEHL, count) * clocks);
+        }
         unsigned short bc = getBC();
         unsigned short de = getDE();
         unsigned short hl = getHL();
@@ -1843,13 +2977,13 @@ class Z80
             consumeClock(5);
         }
     }
-    static inline void LDI(Z80* ctx) { ctx->repeatLD(true, false); }
-    static inline void LDIR(Z80* ctx) { ctx->repeatLD(true, true); }
-    static inline void LDD(Z80* ctx) { ctx->repeatLD(false, false); }
-    static inline void LDDR(Z80* ctx) { ctx->repeatLD(false, true); }
+    static inline void LDI(Z80Core* ctx) { ctx->repeatLD(true, false); }
+    static inline void LDIR(Z80Core* ctx) { ctx->repeatLD(true, true); }
+    static inline void LDD(Z80Core* ctx) { ctx->repeatLD(false, false); }
+    static inline void LDDR(Z80Core* ctx) { ctx->repeatLD(false, true); }
 
     // Exchange stack top with IX
-    static inline void EX_SP_IX_(Z80* ctx) { ctx->EX_SP_IX(); }
+    static inline void EX_SP_IX_(Z80Core* ctx) { ctx->EX_SP_IX(); }
     inline void EX_SP_IX()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1867,7 +3001,7 @@ class Z80
     }
 
     // Exchange stack top with IY
-    static inline void EX_SP_IY_(Z80* ctx) { ctx->EX_SP_IY(); }
+    static inline void EX_SP_IY_(Z80Core* ctx) { ctx->EX_SP_IY(); }
     inline void EX_SP_IY()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1885,9 +3019,9 @@ class Z80
     }
 
     // Push Reg. on Stack.
-    static inline void PUSH_BC(Z80* ctx) { ctx->PUSH_RP(0b00); }
-    static inline void PUSH_DE(Z80* ctx) { ctx->PUSH_RP(0b01); }
-    static inline void PUSH_HL(Z80* ctx) { ctx->PUSH_RP(0b10); }
+    static inline void PUSH_BC(Z80Core* ctx) { ctx->PUSH_RP(0b00); }
+    static inline void PUSH_DE(Z80Core* ctx) { ctx->PUSH_RP(0b01); }
+    static inline void PUSH_HL(Z80Core* ctx) { ctx->PUSH_RP(0b10); }
     inline void PUSH_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1919,9 +3053,9 @@ class Z80
     }
 
     // Push Reg. on Stack.
-    static inline void POP_BC(Z80* ctx) { ctx->POP_RP(0b00); }
-    static inline void POP_DE(Z80* ctx) { ctx->POP_RP(0b01); }
-    static inline void POP_HL(Z80* ctx) { ctx->POP_RP(0b10); }
+    static inline void POP_BC(Z80Core* ctx) { ctx->POP_RP(0b00); }
+    static inline void POP_DE(Z80Core* ctx) { ctx->POP_RP(0b01); }
+    static inline void POP_HL(Z80Core* ctx) { ctx->POP_RP(0b10); }
     inline void POP_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1966,7 +3100,7 @@ class Z80
     }
 
     // Push Reg. IX on Stack.
-    static inline void PUSH_IX_(Z80* ctx) { ctx->PUSH_IX(); }
+    static inline void PUSH_IX_(Z80Core* ctx) { ctx->PUSH_IX(); }
     inline void PUSH_IX()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1977,7 +3111,7 @@ class Z80
     }
 
     // Pop Reg. IX from Stack.
-    static inline void POP_IX_(Z80* ctx) { ctx->POP_IX(); }
+    static inline void POP_IX_(Z80Core* ctx) { ctx->POP_IX(); }
     inline void POP_IX()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -1991,7 +3125,7 @@ class Z80
     }
 
     // Push Reg. IY on Stack.
-    static inline void PUSH_IY_(Z80* ctx) { ctx->PUSH_IY(); }
+    static inline void PUSH_IY_(Z80Core* ctx) { ctx->PUSH_IY(); }
     inline void PUSH_IY()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -2002,7 +3136,7 @@ class Z80
     }
 
     // Pop Reg. IY from Stack.
-    static inline void POP_IY_(Z80* ctx) { ctx->POP_IY(); }
+    static inline void POP_IY_(Z80Core* ctx) { ctx->POP_IY(); }
     inline void POP_IY()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -2017,14 +3151,10 @@ class Z80
 
     inline void setFlagByRotate(unsigned char n, bool carry, bool isA = false)
     {
-        setFlagC(carry);
-        resetFlagH();
-        resetFlagN();
-        setFlagXY(n);
-        if (!isA) {
-            setFlagS(n & 0x80);
-            setFlagZ(0 == n);
-            setFlagPV(isEvenNumberBits(n));
+        if (isA) {
+            regF() = (regF() & (flagS() | flagZ() | flagPV())) | (n & (flagX() | flagY())) | (carry ? flagC() : 0);
+        } else {
+            regF() = flagTableSZ53P[n] | (carry ? flagC() : 0);
         }
     }
 
@@ -2107,7 +3237,7 @@ class Z80
         return n;
     }
 
-    static inline void RLCA(Z80* ctx)
+    static inline void RLCA(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] RLCA <A:$%02X, C:%s>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->isFlagC() ? "ON" : "OFF");
@@ -2115,7 +3245,7 @@ class Z80
         ctx->reg.pair.A = ctx->RLC(ctx->reg.pair.A, true);
     }
 
-    static inline void RRCA(Z80* ctx)
+    static inline void RRCA(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] RRCA <A:$%02X, C:%s>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->isFlagC() ? "ON" : "OFF");
@@ -2123,7 +3253,7 @@ class Z80
         ctx->reg.pair.A = ctx->RRC(ctx->reg.pair.A, true);
     }
 
-    static inline void RLA(Z80* ctx)
+    static inline void RLA(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] RLA <A:$%02X, C:%s>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->isFlagC() ? "ON" : "OFF");
@@ -2131,7 +3261,7 @@ class Z80
         ctx->reg.pair.A = ctx->RL(ctx->reg.pair.A, true);
     }
 
-    static inline void RRA(Z80* ctx)
+    static inline void RRA(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] RRA <A:$%02X, C:%s>", ctx->reg.PC - 1, ctx->reg.pair.A, ctx->isFlagC() ? "ON" : "OFF");
@@ -2140,13 +3270,13 @@ class Z80
     }
 
     // Rotate register Left Circular
-    static inline void RLC_B(Z80* ctx) { ctx->RLC_R(0b000); }
-    static inline void RLC_C(Z80* ctx) { ctx->RLC_R(0b001); }
-    static inline void RLC_D(Z80* ctx) { ctx->RLC_R(0b010); }
-    static inline void RLC_E(Z80* ctx) { ctx->RLC_R(0b011); }
-    static inline void RLC_H(Z80* ctx) { ctx->RLC_R(0b100); }
-    static inline void RLC_L(Z80* ctx) { ctx->RLC_R(0b101); }
-    static inline void RLC_A(Z80* ctx) { ctx->RLC_R(0b111); }
+    static inline void RLC_B(Z80Core* ctx) { ctx->RLC_R(0b000); }
+    static inline void RLC_C(Z80Core* ctx) { ctx->RLC_R(0b001); }
+    static inline void RLC_D(Z80Core* ctx) { ctx->RLC_R(0b010); }
+    static inline void RLC_E(Z80Core* ctx) { ctx->RLC_R(0b011); }
+    static inline void RLC_H(Z80Core* ctx) { ctx->RLC_R(0b100); }
+    static inline void RLC_L(Z80Core* ctx) { ctx->RLC_R(0b101); }
+    static inline void RLC_A(Z80Core* ctx) { ctx->RLC_R(0b111); }
     inline void RLC_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2157,13 +3287,13 @@ class Z80
     }
 
     // Rotate Left register
-    static inline void RL_B(Z80* ctx) { ctx->RL_R(0b000); }
-    static inline void RL_C(Z80* ctx) { ctx->RL_R(0b001); }
-    static inline void RL_D(Z80* ctx) { ctx->RL_R(0b010); }
-    static inline void RL_E(Z80* ctx) { ctx->RL_R(0b011); }
-    static inline void RL_H(Z80* ctx) { ctx->RL_R(0b100); }
-    static inline void RL_L(Z80* ctx) { ctx->RL_R(0b101); }
-    static inline void RL_A(Z80* ctx) { ctx->RL_R(0b111); }
+    static inline void RL_B(Z80Core* ctx) { ctx->RL_R(0b000); }
+    static inline void RL_C(Z80Core* ctx) { ctx->RL_R(0b001); }
+    static inline void RL_D(Z80Core* ctx) { ctx->RL_R(0b010); }
+    static inline void RL_E(Z80Core* ctx) { ctx->RL_R(0b011); }
+    static inline void RL_H(Z80Core* ctx) { ctx->RL_R(0b100); }
+    static inline void RL_L(Z80Core* ctx) { ctx->RL_R(0b101); }
+    static inline void RL_A(Z80Core* ctx) { ctx->RL_R(0b111); }
     inline void RL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2174,13 +3304,13 @@ class Z80
     }
 
     // Shift operand register left Arithmetic
-    static inline void SLA_B(Z80* ctx) { ctx->SLA_R(0b000); }
-    static inline void SLA_C(Z80* ctx) { ctx->SLA_R(0b001); }
-    static inline void SLA_D(Z80* ctx) { ctx->SLA_R(0b010); }
-    static inline void SLA_E(Z80* ctx) { ctx->SLA_R(0b011); }
-    static inline void SLA_H(Z80* ctx) { ctx->SLA_R(0b100); }
-    static inline void SLA_L(Z80* ctx) { ctx->SLA_R(0b101); }
-    static inline void SLA_A(Z80* ctx) { ctx->SLA_R(0b111); }
+    static inline void SLA_B(Z80Core* ctx) { ctx->SLA_R(0b000); }
+    static inline void SLA_C(Z80Core* ctx) { ctx->SLA_R(0b001); }
+    static inline void SLA_D(Z80Core* ctx) { ctx->SLA_R(0b010); }
+    static inline void SLA_E(Z80Core* ctx) { ctx->SLA_R(0b011); }
+    static inline void SLA_H(Z80Core* ctx) { ctx->SLA_R(0b100); }
+    static inline void SLA_L(Z80Core* ctx) { ctx->SLA_R(0b101); }
+    static inline void SLA_A(Z80Core* ctx) { ctx->SLA_R(0b111); }
     inline void SLA_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2191,13 +3321,13 @@ class Z80
     }
 
     // Rotate register Right Circular
-    static inline void RRC_B(Z80* ctx) { ctx->RRC_R(0b000); }
-    static inline void RRC_C(Z80* ctx) { ctx->RRC_R(0b001); }
-    static inline void RRC_D(Z80* ctx) { ctx->RRC_R(0b010); }
-    static inline void RRC_E(Z80* ctx) { ctx->RRC_R(0b011); }
-    static inline void RRC_H(Z80* ctx) { ctx->RRC_R(0b100); }
-    static inline void RRC_L(Z80* ctx) { ctx->RRC_R(0b101); }
-    static inline void RRC_A(Z80* ctx) { ctx->RRC_R(0b111); }
+    static inline void RRC_B(Z80Core* ctx) { ctx->RRC_R(0b000); }
+    static inline void RRC_C(Z80Core* ctx) { ctx->RRC_R(0b001); }
+    static inline void RRC_D(Z80Core* ctx) { ctx->RRC_R(0b010); }
+    static inline void RRC_E(Z80Core* ctx) { ctx->RRC_R(0b011); }
+    static inline void RRC_H(Z80Core* ctx) { ctx->RRC_R(0b100); }
+    static inline void RRC_L(Z80Core* ctx) { ctx->RRC_R(0b101); }
+    static inline void RRC_A(Z80Core* ctx) { ctx->RRC_R(0b111); }
     inline void RRC_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2208,13 +3338,13 @@ class Z80
     }
 
     // Rotate Right register
-    static inline void RR_B(Z80* ctx) { ctx->RR_R(0b000); }
-    static inline void RR_C(Z80* ctx) { ctx->RR_R(0b001); }
-    static inline void RR_D(Z80* ctx) { ctx->RR_R(0b010); }
-    static inline void RR_E(Z80* ctx) { ctx->RR_R(0b011); }
-    static inline void RR_H(Z80* ctx) { ctx->RR_R(0b100); }
-    static inline void RR_L(Z80* ctx) { ctx->RR_R(0b101); }
-    static inline void RR_A(Z80* ctx) { ctx->RR_R(0b111); }
+    static inline void RR_B(Z80Core* ctx) { ctx->RR_R(0b000); }
+    static inline void RR_C(Z80Core* ctx) { ctx->RR_R(0b001); }
+    static inline void RR_D(Z80Core* ctx) { ctx->RR_R(0b010); }
+    static inline void RR_E(Z80Core* ctx) { ctx->RR_R(0b011); }
+    static inline void RR_H(Z80Core* ctx) { ctx->RR_R(0b100); }
+    static inline void RR_L(Z80Core* ctx) { ctx->RR_R(0b101); }
+    static inline void RR_A(Z80Core* ctx) { ctx->RR_R(0b111); }
     inline void RR_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2225,13 +3355,13 @@ class Z80
     }
 
     // Shift operand register Right Arithmetic
-    static inline void SRA_B(Z80* ctx) { ctx->SRA_R(0b000); }
-    static inline void SRA_C(Z80* ctx) { ctx->SRA_R(0b001); }
-    static inline void SRA_D(Z80* ctx) { ctx->SRA_R(0b010); }
-    static inline void SRA_E(Z80* ctx) { ctx->SRA_R(0b011); }
-    static inline void SRA_H(Z80* ctx) { ctx->SRA_R(0b100); }
-    static inline void SRA_L(Z80* ctx) { ctx->SRA_R(0b101); }
-    static inline void SRA_A(Z80* ctx) { ctx->SRA_R(0b111); }
+    static inline void SRA_B(Z80Core* ctx) { ctx->SRA_R(0b000); }
+    static inline void SRA_C(Z80Core* ctx) { ctx->SRA_R(0b001); }
+    static inline void SRA_D(Z80Core* ctx) { ctx->SRA_R(0b010); }
+    static inline void SRA_E(Z80Core* ctx) { ctx->SRA_R(0b011); }
+    static inline void SRA_H(Z80Core* ctx) { ctx->SRA_R(0b100); }
+    static inline void SRA_L(Z80Core* ctx) { ctx->SRA_R(0b101); }
+    static inline void SRA_A(Z80Core* ctx) { ctx->SRA_R(0b111); }
     inline void SRA_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2242,13 +3372,13 @@ class Z80
     }
 
     // Shift operand register Right Logical
-    static inline void SRL_B(Z80* ctx) { ctx->SRL_R(0b000); }
-    static inline void SRL_C(Z80* ctx) { ctx->SRL_R(0b001); }
-    static inline void SRL_D(Z80* ctx) { ctx->SRL_R(0b010); }
-    static inline void SRL_E(Z80* ctx) { ctx->SRL_R(0b011); }
-    static inline void SRL_H(Z80* ctx) { ctx->SRL_R(0b100); }
-    static inline void SRL_L(Z80* ctx) { ctx->SRL_R(0b101); }
-    static inline void SRL_A(Z80* ctx) { ctx->SRL_R(0b111); }
+    static inline void SRL_B(Z80Core* ctx) { ctx->SRL_R(0b000); }
+    static inline void SRL_C(Z80Core* ctx) { ctx->SRL_R(0b001); }
+    static inline void SRL_D(Z80Core* ctx) { ctx->SRL_R(0b010); }
+    static inline void SRL_E(Z80Core* ctx) { ctx->SRL_R(0b011); }
+    static inline void SRL_H(Z80Core* ctx) { ctx->SRL_R(0b100); }
+    static inline void SRL_L(Z80Core* ctx) { ctx->SRL_R(0b101); }
+    static inline void SRL_A(Z80Core* ctx) { ctx->SRL_R(0b111); }
     inline void SRL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2259,13 +3389,13 @@ class Z80
     }
 
     // Shift operand register Left Logical
-    static inline void SLL_B(Z80* ctx) { ctx->SLL_R(0b000); }
-    static inline void SLL_C(Z80* ctx) { ctx->SLL_R(0b001); }
-    static inline void SLL_D(Z80* ctx) { ctx->SLL_R(0b010); }
-    static inline void SLL_E(Z80* ctx) { ctx->SLL_R(0b011); }
-    static inline void SLL_H(Z80* ctx) { ctx->SLL_R(0b100); }
-    static inline void SLL_L(Z80* ctx) { ctx->SLL_R(0b101); }
-    static inline void SLL_A(Z80* ctx) { ctx->SLL_R(0b111); }
+    static inline void SLL_B(Z80Core* ctx) { ctx->SLL_R(0b000); }
+    static inline void SLL_C(Z80Core* ctx) { ctx->SLL_R(0b001); }
+    static inline void SLL_D(Z80Core* ctx) { ctx->SLL_R(0b010); }
+    static inline void SLL_E(Z80Core* ctx) { ctx->SLL_R(0b011); }
+    static inline void SLL_H(Z80Core* ctx) { ctx->SLL_R(0b100); }
+    static inline void SLL_L(Z80Core* ctx) { ctx->SLL_R(0b101); }
+    static inline void SLL_A(Z80Core* ctx) { ctx->SLL_R(0b111); }
     inline void SLL_R(unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2276,7 +3406,7 @@ class Z80
     }
 
     // Rotate memory (HL) Left Circular
-    static inline void RLC_HL_(Z80* ctx) { ctx->RLC_HL(); }
+    static inline void RLC_HL_(Z80Core* ctx) { ctx->RLC_HL(); }
     inline void RLC_HL()
     {
         unsigned short addr = getHL();
@@ -2288,7 +3418,7 @@ class Z80
     }
 
     // Rotate Left memory
-    static inline void RL_HL_(Z80* ctx) { ctx->RL_HL(); }
+    static inline void RL_HL_(Z80Core* ctx) { ctx->RL_HL(); }
     inline void RL_HL()
     {
         unsigned short addr = getHL();
@@ -2300,7 +3430,7 @@ class Z80
     }
 
     // Shift operand location (HL) left Arithmetic
-    static inline void SLA_HL_(Z80* ctx) { ctx->SLA_HL(); }
+    static inline void SLA_HL_(Z80Core* ctx) { ctx->SLA_HL(); }
     inline void SLA_HL()
     {
         unsigned short addr = getHL();
@@ -2312,7 +3442,7 @@ class Z80
     }
 
     // Rotate memory (HL) Right Circular
-    static inline void RRC_HL_(Z80* ctx) { ctx->RRC_HL(); }
+    static inline void RRC_HL_(Z80Core* ctx) { ctx->RRC_HL(); }
     inline void RRC_HL()
     {
         unsigned short addr = getHL();
@@ -2324,7 +3454,7 @@ class Z80
     }
 
     // Rotate Right memory
-    static inline void RR_HL_(Z80* ctx) { ctx->RR_HL(); }
+    static inline void RR_HL_(Z80Core* ctx) { ctx->RR_HL(); }
     inline void RR_HL()
     {
         unsigned short addr = getHL();
@@ -2336,7 +3466,7 @@ class Z80
     }
 
     // Shift operand location (HL) Right Arithmetic
-    static inline void SRA_HL_(Z80* ctx) { ctx->SRA_HL(); }
+    static inline void SRA_HL_(Z80Core* ctx) { ctx->SRA_HL(); }
     inline void SRA_HL()
     {
         unsigned short addr = getHL();
@@ -2348,7 +3478,7 @@ class Z80
     }
 
     // Shift operand location (HL) Right Logical
-    static inline void SRL_HL_(Z80* ctx) { ctx->SRL_HL(); }
+    static inline void SRL_HL_(Z80Core* ctx) { ctx->SRL_HL(); }
     inline void SRL_HL()
     {
         unsigned short addr = getHL();
@@ -2360,7 +3490,7 @@ class Z80
     }
 
     // Shift operand location (HL) Left Logical
-    static inline void SLL_HL_(Z80* ctx) { ctx->SLL_HL(); }
+    static inline void SLL_HL_(Z80Core* ctx) { ctx->SLL_HL(); }
     inline void SLL_HL()
     {
         unsigned short addr = getHL();
@@ -2372,7 +3502,7 @@ class Z80
     }
 
     // Rotate memory (IX+d) Left Circular
-    static inline void RLC_IX_(Z80* ctx, signed char d) { ctx->RLC_IX(d); }
+    static inline void RLC_IX_(Z80Core* ctx, signed char d) { ctx->RLC_IX(d); }
     inline void RLC_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2386,13 +3516,13 @@ class Z80
     }
 
     // Rotate memory (IX+d) Left Circular with load to Reg A/B/C/D/E/H/L/F
-    static inline void RLC_IX_with_LD_B(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b000); }
-    static inline void RLC_IX_with_LD_C(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b001); }
-    static inline void RLC_IX_with_LD_D(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b010); }
-    static inline void RLC_IX_with_LD_E(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b011); }
-    static inline void RLC_IX_with_LD_H(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b100); }
-    static inline void RLC_IX_with_LD_L(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b101); }
-    static inline void RLC_IX_with_LD_A(Z80* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b111); }
+    static inline void RLC_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b000); }
+    static inline void RLC_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b001); }
+    static inline void RLC_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b010); }
+    static inline void RLC_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b011); }
+    static inline void RLC_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b100); }
+    static inline void RLC_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b101); }
+    static inline void RLC_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->RLC_IX_with_LD(d, 0b111); }
     inline void RLC_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2410,13 +3540,13 @@ class Z80
     }
 
     // Rotate memory (IY+d) Left Circular with load to Reg A/B/C/D/E/H/L/F
-    static inline void RLC_IY_with_LD_B(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b000); }
-    static inline void RLC_IY_with_LD_C(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b001); }
-    static inline void RLC_IY_with_LD_D(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b010); }
-    static inline void RLC_IY_with_LD_E(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b011); }
-    static inline void RLC_IY_with_LD_H(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b100); }
-    static inline void RLC_IY_with_LD_L(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b101); }
-    static inline void RLC_IY_with_LD_A(Z80* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b111); }
+    static inline void RLC_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b000); }
+    static inline void RLC_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b001); }
+    static inline void RLC_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b010); }
+    static inline void RLC_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b011); }
+    static inline void RLC_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b100); }
+    static inline void RLC_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b101); }
+    static inline void RLC_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->RLC_IY_with_LD(d, 0b111); }
     inline void RLC_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2434,7 +3564,7 @@ class Z80
     }
 
     // Rotate memory (IX+d) Right Circular
-    static inline void RRC_IX_(Z80* ctx, signed char d) { ctx->RRC_IX(d); }
+    static inline void RRC_IX_(Z80Core* ctx, signed char d) { ctx->RRC_IX(d); }
     inline void RRC_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2448,13 +3578,13 @@ class Z80
     }
 
     // Rotate memory (IX+d) Right Circular with load to Reg A/B/C/D/E/H/L/F
-    static inline void RRC_IX_with_LD_B(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b000); }
-    static inline void RRC_IX_with_LD_C(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b001); }
-    static inline void RRC_IX_with_LD_D(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b010); }
-    static inline void RRC_IX_with_LD_E(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b011); }
-    static inline void RRC_IX_with_LD_H(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b100); }
-    static inline void RRC_IX_with_LD_L(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b101); }
-    static inline void RRC_IX_with_LD_A(Z80* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b111); }
+    static inline void RRC_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b000); }
+    static inline void RRC_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b001); }
+    static inline void RRC_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b010); }
+    static inline void RRC_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b011); }
+    static inline void RRC_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b100); }
+    static inline void RRC_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b101); }
+    static inline void RRC_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->RRC_IX_with_LD(d, 0b111); }
     inline void RRC_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2472,13 +3602,13 @@ class Z80
     }
 
     // Rotate memory (IY+d) Right Circular with load to Reg A/B/C/D/E/H/L/F
-    static inline void RRC_IY_with_LD_B(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b000); }
-    static inline void RRC_IY_with_LD_C(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b001); }
-    static inline void RRC_IY_with_LD_D(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b010); }
-    static inline void RRC_IY_with_LD_E(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b011); }
-    static inline void RRC_IY_with_LD_H(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b100); }
-    static inline void RRC_IY_with_LD_L(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b101); }
-    static inline void RRC_IY_with_LD_A(Z80* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b111); }
+    static inline void RRC_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b000); }
+    static inline void RRC_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b001); }
+    static inline void RRC_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b010); }
+    static inline void RRC_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b011); }
+    static inline void RRC_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b100); }
+    static inline void RRC_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b101); }
+    static inline void RRC_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->RRC_IY_with_LD(d, 0b111); }
     inline void RRC_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2496,7 +3626,7 @@ class Z80
     }
 
     // Rotate Left memory
-    static inline void RL_IX_(Z80* ctx, signed char d) { ctx->RL_IX(d); }
+    static inline void RL_IX_(Z80Core* ctx, signed char d) { ctx->RL_IX(d); }
     inline void RL_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2510,13 +3640,13 @@ class Z80
     }
 
     // Rotate Left memory with load Reg.
-    static inline void RL_IX_with_LD_B(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b000); }
-    static inline void RL_IX_with_LD_C(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b001); }
-    static inline void RL_IX_with_LD_D(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b010); }
-    static inline void RL_IX_with_LD_E(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b011); }
-    static inline void RL_IX_with_LD_H(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b100); }
-    static inline void RL_IX_with_LD_L(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b101); }
-    static inline void RL_IX_with_LD_A(Z80* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b111); }
+    static inline void RL_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b000); }
+    static inline void RL_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b001); }
+    static inline void RL_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b010); }
+    static inline void RL_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b011); }
+    static inline void RL_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b100); }
+    static inline void RL_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b101); }
+    static inline void RL_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->RL_IX_with_LD(d, 0b111); }
     inline void RL_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2534,13 +3664,13 @@ class Z80
     }
 
     // Rotate Left memory with load Reg.
-    static inline void RL_IY_with_LD_B(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b000); }
-    static inline void RL_IY_with_LD_C(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b001); }
-    static inline void RL_IY_with_LD_D(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b010); }
-    static inline void RL_IY_with_LD_E(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b011); }
-    static inline void RL_IY_with_LD_H(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b100); }
-    static inline void RL_IY_with_LD_L(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b101); }
-    static inline void RL_IY_with_LD_A(Z80* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b111); }
+    static inline void RL_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b000); }
+    static inline void RL_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b001); }
+    static inline void RL_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b010); }
+    static inline void RL_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b011); }
+    static inline void RL_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b100); }
+    static inline void RL_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b101); }
+    static inline void RL_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->RL_IY_with_LD(d, 0b111); }
     inline void RL_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2558,7 +3688,7 @@ class Z80
     }
 
     // Rotate Right memory
-    static inline void RR_IX_(Z80* ctx, signed char d) { ctx->RR_IX(d); }
+    static inline void RR_IX_(Z80Core* ctx, signed char d) { ctx->RR_IX(d); }
     inline void RR_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2572,13 +3702,13 @@ class Z80
     }
 
     // Rotate Right memory with load Reg.
-    static inline void RR_IX_with_LD_B(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b000); }
-    static inline void RR_IX_with_LD_C(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b001); }
-    static inline void RR_IX_with_LD_D(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b010); }
-    static inline void RR_IX_with_LD_E(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b011); }
-    static inline void RR_IX_with_LD_H(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b100); }
-    static inline void RR_IX_with_LD_L(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b101); }
-    static inline void RR_IX_with_LD_A(Z80* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b111); }
+    static inline void RR_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b000); }
+    static inline void RR_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b001); }
+    static inline void RR_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b010); }
+    static inline void RR_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b011); }
+    static inline void RR_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b100); }
+    static inline void RR_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b101); }
+    static inline void RR_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->RR_IX_with_LD(d, 0b111); }
     inline void RR_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2596,13 +3726,13 @@ class Z80
     }
 
     // Rotate Right memory with load Reg.
-    static inline void RR_IY_with_LD_B(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b000); }
-    static inline void RR_IY_with_LD_C(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b001); }
-    static inline void RR_IY_with_LD_D(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b010); }
-    static inline void RR_IY_with_LD_E(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b011); }
-    static inline void RR_IY_with_LD_H(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b100); }
-    static inline void RR_IY_with_LD_L(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b101); }
-    static inline void RR_IY_with_LD_A(Z80* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b111); }
+    static inline void RR_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b000); }
+    static inline void RR_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b001); }
+    static inline void RR_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b010); }
+    static inline void RR_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b011); }
+    static inline void RR_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b100); }
+    static inline void RR_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b101); }
+    static inline void RR_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->RR_IY_with_LD(d, 0b111); }
     inline void RR_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2620,7 +3750,7 @@ class Z80
     }
 
     // Shift operand location (IX+d) left Arithmetic
-    static inline void SLA_IX_(Z80* ctx, signed char d) { ctx->SLA_IX(d); }
+    static inline void SLA_IX_(Z80Core* ctx, signed char d) { ctx->SLA_IX(d); }
     inline void SLA_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2634,13 +3764,13 @@ class Z80
     }
 
     // Shift operand location (IX+d) left Arithmetic with load Reg.
-    static inline void SLA_IX_with_LD_B(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b000); }
-    static inline void SLA_IX_with_LD_C(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b001); }
-    static inline void SLA_IX_with_LD_D(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b010); }
-    static inline void SLA_IX_with_LD_E(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b011); }
-    static inline void SLA_IX_with_LD_H(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b100); }
-    static inline void SLA_IX_with_LD_L(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b101); }
-    static inline void SLA_IX_with_LD_A(Z80* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b111); }
+    static inline void SLA_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b000); }
+    static inline void SLA_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b001); }
+    static inline void SLA_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b010); }
+    static inline void SLA_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b011); }
+    static inline void SLA_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b100); }
+    static inline void SLA_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b101); }
+    static inline void SLA_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->SLA_IX_with_LD(d, 0b111); }
     inline void SLA_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2658,13 +3788,13 @@ class Z80
     }
 
     // Shift operand location (IY+d) left Arithmetic with load Reg.
-    static inline void SLA_IY_with_LD_B(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b000); }
-    static inline void SLA_IY_with_LD_C(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b001); }
-    static inline void SLA_IY_with_LD_D(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b010); }
-    static inline void SLA_IY_with_LD_E(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b011); }
-    static inline void SLA_IY_with_LD_H(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b100); }
-    static inline void SLA_IY_with_LD_L(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b101); }
-    static inline void SLA_IY_with_LD_A(Z80* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b111); }
+    static inline void SLA_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b000); }
+    static inline void SLA_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b001); }
+    static inline void SLA_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b010); }
+    static inline void SLA_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b011); }
+    static inline void SLA_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b100); }
+    static inline void SLA_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b101); }
+    static inline void SLA_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->SLA_IY_with_LD(d, 0b111); }
     inline void SLA_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2682,7 +3812,7 @@ class Z80
     }
 
     // Shift operand location (IX+d) Right Arithmetic
-    static inline void SRA_IX_(Z80* ctx, signed char d) { ctx->SRA_IX(d); }
+    static inline void SRA_IX_(Z80Core* ctx, signed char d) { ctx->SRA_IX(d); }
     inline void SRA_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2696,13 +3826,13 @@ class Z80
     }
 
     // Shift operand location (IX+d) right Arithmetic with load Reg.
-    static inline void SRA_IX_with_LD_B(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b000); }
-    static inline void SRA_IX_with_LD_C(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b001); }
-    static inline void SRA_IX_with_LD_D(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b010); }
-    static inline void SRA_IX_with_LD_E(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b011); }
-    static inline void SRA_IX_with_LD_H(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b100); }
-    static inline void SRA_IX_with_LD_L(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b101); }
-    static inline void SRA_IX_with_LD_A(Z80* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b111); }
+    static inline void SRA_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b000); }
+    static inline void SRA_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b001); }
+    static inline void SRA_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b010); }
+    static inline void SRA_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b011); }
+    static inline void SRA_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b100); }
+    static inline void SRA_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b101); }
+    static inline void SRA_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->SRA_IX_with_LD(d, 0b111); }
     inline void SRA_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2720,13 +3850,13 @@ class Z80
     }
 
     // Shift operand location (IY+d) right Arithmetic with load Reg.
-    static inline void SRA_IY_with_LD_B(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b000); }
-    static inline void SRA_IY_with_LD_C(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b001); }
-    static inline void SRA_IY_with_LD_D(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b010); }
-    static inline void SRA_IY_with_LD_E(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b011); }
-    static inline void SRA_IY_with_LD_H(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b100); }
-    static inline void SRA_IY_with_LD_L(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b101); }
-    static inline void SRA_IY_with_LD_A(Z80* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b111); }
+    static inline void SRA_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b000); }
+    static inline void SRA_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b001); }
+    static inline void SRA_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b010); }
+    static inline void SRA_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b011); }
+    static inline void SRA_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b100); }
+    static inline void SRA_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b101); }
+    static inline void SRA_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->SRA_IY_with_LD(d, 0b111); }
     inline void SRA_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2744,7 +3874,7 @@ class Z80
     }
 
     // Shift operand location (IX+d) Right Logical
-    static inline void SRL_IX_(Z80* ctx, signed char d) { ctx->SRL_IX(d); }
+    static inline void SRL_IX_(Z80Core* ctx, signed char d) { ctx->SRL_IX(d); }
     inline void SRL_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2758,13 +3888,13 @@ class Z80
     }
 
     // Shift operand location (IX+d) Right Logical with load Reg.
-    static inline void SRL_IX_with_LD_B(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b000); }
-    static inline void SRL_IX_with_LD_C(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b001); }
-    static inline void SRL_IX_with_LD_D(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b010); }
-    static inline void SRL_IX_with_LD_E(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b011); }
-    static inline void SRL_IX_with_LD_H(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b100); }
-    static inline void SRL_IX_with_LD_L(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b101); }
-    static inline void SRL_IX_with_LD_A(Z80* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b111); }
+    static inline void SRL_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b000); }
+    static inline void SRL_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b001); }
+    static inline void SRL_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b010); }
+    static inline void SRL_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b011); }
+    static inline void SRL_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b100); }
+    static inline void SRL_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b101); }
+    static inline void SRL_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->SRL_IX_with_LD(d, 0b111); }
     inline void SRL_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2782,13 +3912,13 @@ class Z80
     }
 
     // Shift operand location (IY+d) Right Logical with load Reg.
-    static inline void SRL_IY_with_LD_B(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b000); }
-    static inline void SRL_IY_with_LD_C(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b001); }
-    static inline void SRL_IY_with_LD_D(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b010); }
-    static inline void SRL_IY_with_LD_E(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b011); }
-    static inline void SRL_IY_with_LD_H(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b100); }
-    static inline void SRL_IY_with_LD_L(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b101); }
-    static inline void SRL_IY_with_LD_A(Z80* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b111); }
+    static inline void SRL_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b000); }
+    static inline void SRL_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b001); }
+    static inline void SRL_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b010); }
+    static inline void SRL_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b011); }
+    static inline void SRL_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b100); }
+    static inline void SRL_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b101); }
+    static inline void SRL_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->SRL_IY_with_LD(d, 0b111); }
     inline void SRL_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2807,7 +3937,7 @@ class Z80
 
     // Shift operand location (IX+d) Left Logical
     // NOTE: this function is only for SLL_IX_with_LD
-    static inline void SLL_IX_(Z80* ctx, signed char d) { ctx->SLL_IX(d); }
+    static inline void SLL_IX_(Z80Core* ctx, signed char d) { ctx->SLL_IX(d); }
     inline void SLL_IX(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -2821,13 +3951,13 @@ class Z80
     }
 
     // Shift operand location (IX+d) Left Logical with load Reg.
-    static inline void SLL_IX_with_LD_B(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b000); }
-    static inline void SLL_IX_with_LD_C(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b001); }
-    static inline void SLL_IX_with_LD_D(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b010); }
-    static inline void SLL_IX_with_LD_E(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b011); }
-    static inline void SLL_IX_with_LD_H(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b100); }
-    static inline void SLL_IX_with_LD_L(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b101); }
-    static inline void SLL_IX_with_LD_A(Z80* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b111); }
+    static inline void SLL_IX_with_LD_B(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b000); }
+    static inline void SLL_IX_with_LD_C(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b001); }
+    static inline void SLL_IX_with_LD_D(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b010); }
+    static inline void SLL_IX_with_LD_E(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b011); }
+    static inline void SLL_IX_with_LD_H(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b100); }
+    static inline void SLL_IX_with_LD_L(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b101); }
+    static inline void SLL_IX_with_LD_A(Z80Core* ctx, signed char d) { ctx->SLL_IX_with_LD(d, 0b111); }
     inline void SLL_IX_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2846,7 +3976,7 @@ class Z80
 
     // Shift operand location (IY+d) Left Logical
     // NOTE: this function is only for SLL_IY_with_LD
-    static inline void SLL_IY_(Z80* ctx, signed char d) { ctx->SLL_IY(d); }
+    static inline void SLL_IY_(Z80Core* ctx, signed char d) { ctx->SLL_IY(d); }
     inline void SLL_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2860,13 +3990,13 @@ class Z80
     }
 
     // Shift operand location (IY+d) Left Logical with load Reg.
-    static inline void SLL_IY_with_LD_B(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b000); }
-    static inline void SLL_IY_with_LD_C(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b001); }
-    static inline void SLL_IY_with_LD_D(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b010); }
-    static inline void SLL_IY_with_LD_E(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b011); }
-    static inline void SLL_IY_with_LD_H(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b100); }
-    static inline void SLL_IY_with_LD_L(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b101); }
-    static inline void SLL_IY_with_LD_A(Z80* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b111); }
+    static inline void SLL_IY_with_LD_B(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b000); }
+    static inline void SLL_IY_with_LD_C(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b001); }
+    static inline void SLL_IY_with_LD_D(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b010); }
+    static inline void SLL_IY_with_LD_E(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b011); }
+    static inline void SLL_IY_with_LD_H(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b100); }
+    static inline void SLL_IY_with_LD_L(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b101); }
+    static inline void SLL_IY_with_LD_A(Z80Core* ctx, signed char d) { ctx->SLL_IY_with_LD(d, 0b111); }
     inline void SLL_IY_with_LD(signed char d, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -2884,7 +4014,7 @@ class Z80
     }
 
     // Rotate memory (IY+d) Left Circular
-    static inline void RLC_IY_(Z80* ctx, signed char d) { ctx->RLC_IY(d); }
+    static inline void RLC_IY_(Z80Core* ctx, signed char d) { ctx->RLC_IY(d); }
     inline void RLC_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2898,7 +4028,7 @@ class Z80
     }
 
     // Rotate memory (IY+d) Right Circular
-    static inline void RRC_IY_(Z80* ctx, signed char d) { ctx->RRC_IY(d); }
+    static inline void RRC_IY_(Z80Core* ctx, signed char d) { ctx->RRC_IY(d); }
     inline void RRC_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2912,7 +4042,7 @@ class Z80
     }
 
     // Rotate Left memory
-    static inline void RL_IY_(Z80* ctx, signed char d) { ctx->RL_IY(d); }
+    static inline void RL_IY_(Z80Core* ctx, signed char d) { ctx->RL_IY(d); }
     inline void RL_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2926,7 +4056,7 @@ class Z80
     }
 
     // Shift operand location (IY+d) left Arithmetic
-    static inline void SLA_IY_(Z80* ctx, signed char d) { ctx->SLA_IY(d); }
+    static inline void SLA_IY_(Z80Core* ctx, signed char d) { ctx->SLA_IY(d); }
     inline void SLA_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2940,7 +4070,7 @@ class Z80
     }
 
     // Rotate Right memory
-    static inline void RR_IY_(Z80* ctx, signed char d) { ctx->RR_IY(d); }
+    static inline void RR_IY_(Z80Core* ctx, signed char d) { ctx->RR_IY(d); }
     inline void RR_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2954,7 +4084,7 @@ class Z80
     }
 
     // Shift operand location (IY+d) Right Arithmetic
-    static inline void SRA_IY_(Z80* ctx, signed char d) { ctx->SRA_IY(d); }
+    static inline void SRA_IY_(Z80Core* ctx, signed char d) { ctx->SRA_IY(d); }
     inline void SRA_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2968,7 +4098,7 @@ class Z80
     }
 
     // Shift operand location (IY+d) Right Logical
-    static inline void SRL_IY_(Z80* ctx, signed char d) { ctx->SRL_IY(d); }
+    static inline void SRL_IY_(Z80Core* ctx, signed char d) { ctx->SRL_IY(d); }
     inline void SRL_IY(signed char d, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -2989,55 +4119,52 @@ class Z80
         int result = before + (negative ? -addition - carry : addition + carry);
         int carryX = before ^ addition ^ result;
         unsigned char finalResult = result & 0xFF;
-        setFlagZ(0 == finalResult);
-        setFlagN(negative);
-        setFlagS(0x80 & finalResult);
-        setFlagH(carryX & 0x10);
-        setFlagPV(((carryX << 1) ^ carryX) & 0x100);
-        if (setCarry) setFlagC(carryX & 0x100);
-        if (setResult) {
-            reg.pair.A = finalResult;
-            setFlagXY(reg.pair.A);
-        } else {
-            setFlagXY(addition);
+#ifdef Z80_LAZY_FLAGS
+        if (setCarry) {
+            lazy.kind = 1;
+            lazy.result = finalResult;
+            lazy.carryX = carryX;
+            lazy.fixed = negative ? flagN() : 0;
+            if (setResult) reg.pair.A = finalResult;
+            lazy.xy = setResult ? finalResult : addition;
+            return;
         }
+#endif
+        unsigned char f = flagTableSZ53P[finalResult] & (flagS() | flagZ());
+        f |= (setResult ? finalResult : addition) & (flagX() | flagY());
+        f |= carryX & flagH();
+        if (((carryX << 1) ^ carryX) & 0x100) f |= flagPV();
+        if (negative) f |= flagN();
+        if (setCarry ? carryX & 0x100 : isFlagC()) f |= flagC();
+        regF() = f;
+        if (setResult) reg.pair.A = finalResult;
     }
 
     inline void setFlagByIncrement(unsigned char before)
     {
         unsigned char finalResult = before + 1;
-        resetFlagN();
-        setFlagZ(0 == finalResult);
-        setFlagS(0x80 & finalResult);
-        setFlagH((finalResult & 0x0F) == 0x00);
-        setFlagPV(finalResult == 0x80);
-        setFlagXY(finalResult);
+        regF() = (regF() & flagC()) | flagTableInc[finalResult];
     }
 
     inline void setFlagByDecrement(unsigned char before)
     {
         unsigned char finalResult = before - 1;
-        setFlagN();
-        setFlagZ(0 == finalResult);
-        setFlagS(0x80 & finalResult);
-        setFlagH((finalResult & 0x0F) == 0x0F);
-        setFlagPV(finalResult == 0x7F);
-        setFlagXY(finalResult);
+        regF() = (regF() & flagC()) | flagTableDec[finalResult];
     }
 
     // Add Reg. r to Acc.
-    static inline void ADD_B(Z80* ctx) { ctx->ADD_R(0b000); }
-    static inline void ADD_C(Z80* ctx) { ctx->ADD_R(0b001); }
-    static inline void ADD_D(Z80* ctx) { ctx->ADD_R(0b010); }
-    static inline void ADD_E(Z80* ctx) { ctx->ADD_R(0b011); }
-    static inline void ADD_H(Z80* ctx) { ctx->ADD_R(0b100); }
-    static inline void ADD_L(Z80* ctx) { ctx->ADD_R(0b101); }
-    static inline void ADD_A(Z80* ctx) { ctx->ADD_R(0b111); }
-    static inline void ADD_B_2(Z80* ctx) { ctx->ADD_R(0b000, 2); }
-    static inline void ADD_C_2(Z80* ctx) { ctx->ADD_R(0b001, 2); }
-    static inline void ADD_D_2(Z80* ctx) { ctx->ADD_R(0b010, 2); }
-    static inline void ADD_E_2(Z80* ctx) { ctx->ADD_R(0b011, 2); }
-    static inline void ADD_A_2(Z80* ctx) { ctx->ADD_R(0b111, 2); }
+    static inline void ADD_B(Z80Core* ctx) { ctx->ADD_R(0b000); }
+    static inline void ADD_C(Z80Core* ctx) { ctx->ADD_R(0b001); }
+    static inline void ADD_D(Z80Core* ctx) { ctx->ADD_R(0b010); }
+    static inline void ADD_E(Z80Core* ctx) { ctx->ADD_R(0b011); }
+    static inline void ADD_H(Z80Core* ctx) { ctx->ADD_R(0b100); }
+    static inline void ADD_L(Z80Core* ctx) { ctx->ADD_R(0b101); }
+    static inline void ADD_A(Z80Core* ctx) { ctx->ADD_R(0b111); }
+    static inline void ADD_B_2(Z80Core* ctx) { ctx->ADD_R(0b000, 2); }
+    static inline void ADD_C_2(Z80Core* ctx) { ctx->ADD_R(0b001, 2); }
+    static inline void ADD_D_2(Z80Core* ctx) { ctx->ADD_R(0b010, 2); }
+    static inline void ADD_E_2(Z80Core* ctx) { ctx->ADD_R(0b011, 2); }
+    static inline void ADD_A_2(Z80Core* ctx) { ctx->ADD_R(0b111, 2); }
     inline void ADD_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3048,7 +4175,7 @@ class Z80
     }
 
     // Add IXH to Acc.
-    static inline void ADD_IXH_(Z80* ctx) { ctx->ADD_IXH(); }
+    static inline void ADD_IXH_(Z80Core* ctx) { ctx->ADD_IXH(); }
     inline void ADD_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3058,7 +4185,7 @@ class Z80
     }
 
     // Add IXL to Acc.
-    static inline void ADD_IXL_(Z80* ctx) { ctx->ADD_IXL(); }
+    static inline void ADD_IXL_(Z80Core* ctx) { ctx->ADD_IXL(); }
     inline void ADD_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3068,7 +4195,7 @@ class Z80
     }
 
     // Add IYH to Acc.
-    static inline void ADD_IYH_(Z80* ctx) { ctx->ADD_IYH(); }
+    static inline void ADD_IYH_(Z80Core* ctx) { ctx->ADD_IYH(); }
     inline void ADD_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3078,7 +4205,7 @@ class Z80
     }
 
     // Add IYL to Acc.
-    static inline void ADD_IYL_(Z80* ctx) { ctx->ADD_IYL(); }
+    static inline void ADD_IYL_(Z80Core* ctx) { ctx->ADD_IYL(); }
     inline void ADD_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3088,7 +4215,7 @@ class Z80
     }
 
     // Add value n to Acc.
-    static inline void ADD_N(Z80* ctx)
+    static inline void ADD_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -3098,7 +4225,7 @@ class Z80
     }
 
     // Add location (HL) to Acc.
-    static inline void ADD_HL(Z80* ctx)
+    static inline void ADD_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr, 3);
@@ -3109,7 +4236,7 @@ class Z80
     }
 
     // Add location (IX+d) to Acc.
-    static inline void ADD_IX_(Z80* ctx) { ctx->ADD_IX(); }
+    static inline void ADD_IX_(Z80Core* ctx) { ctx->ADD_IX(); }
     inline void ADD_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3123,7 +4250,7 @@ class Z80
     }
 
     // Add location (IY+d) to Acc.
-    static inline void ADD_IY_(Z80* ctx) { ctx->ADD_IY(); }
+    static inline void ADD_IY_(Z80Core* ctx) { ctx->ADD_IY(); }
     inline void ADD_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3137,18 +4264,18 @@ class Z80
     }
 
     // Add Resister with carry
-    static inline void ADC_B(Z80* ctx) { ctx->ADC_R(0b000); }
-    static inline void ADC_C(Z80* ctx) { ctx->ADC_R(0b001); }
-    static inline void ADC_D(Z80* ctx) { ctx->ADC_R(0b010); }
-    static inline void ADC_E(Z80* ctx) { ctx->ADC_R(0b011); }
-    static inline void ADC_H(Z80* ctx) { ctx->ADC_R(0b100); }
-    static inline void ADC_L(Z80* ctx) { ctx->ADC_R(0b101); }
-    static inline void ADC_A(Z80* ctx) { ctx->ADC_R(0b111); }
-    static inline void ADC_B_2(Z80* ctx) { ctx->ADC_R(0b000, 2); }
-    static inline void ADC_C_2(Z80* ctx) { ctx->ADC_R(0b001, 2); }
-    static inline void ADC_D_2(Z80* ctx) { ctx->ADC_R(0b010, 2); }
-    static inline void ADC_E_2(Z80* ctx) { ctx->ADC_R(0b011, 2); }
-    static inline void ADC_A_2(Z80* ctx) { ctx->ADC_R(0b111, 2); }
+    static inline void ADC_B(Z80Core* ctx) { ctx->ADC_R(0b000); }
+    static inline void ADC_C(Z80Core* ctx) { ctx->ADC_R(0b001); }
+    static inline void ADC_D(Z80Core* ctx) { ctx->ADC_R(0b010); }
+    static inline void ADC_E(Z80Core* ctx) { ctx->ADC_R(0b011); }
+    static inline void ADC_H(Z80Core* ctx) { ctx->ADC_R(0b100); }
+    static inline void ADC_L(Z80Core* ctx) { ctx->ADC_R(0b101); }
+    static inline void ADC_A(Z80Core* ctx) { ctx->ADC_R(0b111); }
+    static inline void ADC_B_2(Z80Core* ctx) { ctx->ADC_R(0b000, 2); }
+    static inline void ADC_C_2(Z80Core* ctx) { ctx->ADC_R(0b001, 2); }
+    static inline void ADC_D_2(Z80Core* ctx) { ctx->ADC_R(0b010, 2); }
+    static inline void ADC_E_2(Z80Core* ctx) { ctx->ADC_R(0b011, 2); }
+    static inline void ADC_A_2(Z80Core* ctx) { ctx->ADC_R(0b111, 2); }
     inline void ADC_R(unsigned char r, int pc = 1)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -3160,7 +4287,7 @@ class Z80
     }
 
     // Add IXH to Acc.
-    static inline void ADC_IXH_(Z80* ctx) { ctx->ADC_IXH(); }
+    static inline void ADC_IXH_(Z80Core* ctx) { ctx->ADC_IXH(); }
     inline void ADC_IXH()
     {
         unsigned char c = isFlagC() ? 1 : 0;
@@ -3171,7 +4298,7 @@ class Z80
     }
 
     // Add IXL to Acc.
-    static inline void ADC_IXL_(Z80* ctx) { ctx->ADC_IXL(); }
+    static inline void ADC_IXL_(Z80Core* ctx) { ctx->ADC_IXL(); }
     inline void ADC_IXL()
     {
         unsigned char c = isFlagC() ? 1 : 0;
@@ -3182,7 +4309,7 @@ class Z80
     }
 
     // Add IYH to Acc.
-    static inline void ADC_IYH_(Z80* ctx) { ctx->ADC_IYH(); }
+    static inline void ADC_IYH_(Z80Core* ctx) { ctx->ADC_IYH(); }
     inline void ADC_IYH()
     {
         unsigned char c = isFlagC() ? 1 : 0;
@@ -3193,7 +4320,7 @@ class Z80
     }
 
     // Add IYL to Acc.
-    static inline void ADC_IYL_(Z80* ctx) { ctx->ADC_IYL(); }
+    static inline void ADC_IYL_(Z80Core* ctx) { ctx->ADC_IYL(); }
     inline void ADC_IYL()
     {
         unsigned char c = isFlagC() ? 1 : 0;
@@ -3204,7 +4331,7 @@ class Z80
     }
 
     // Add immediate with carry
-    static inline void ADC_N(Z80* ctx)
+    static inline void ADC_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
         unsigned char c = ctx->isFlagC() ? 1 : 0;
@@ -3215,7 +4342,7 @@ class Z80
     }
 
     // Add memory with carry
-    static inline void ADC_HL(Z80* ctx)
+    static inline void ADC_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr, 3);
@@ -3227,7 +4354,7 @@ class Z80
     }
 
     // Add memory with carry
-    static inline void ADC_IX_(Z80* ctx) { ctx->ADC_IX(); }
+    static inline void ADC_IX_(Z80Core* ctx) { ctx->ADC_IX(); }
     inline void ADC_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3242,7 +4369,7 @@ class Z80
     }
 
     // Add memory with carry
-    static inline void ADC_IY_(Z80* ctx) { ctx->ADC_IY(); }
+    static inline void ADC_IY_(Z80Core* ctx) { ctx->ADC_IY(); }
     inline void ADC_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3257,18 +4384,18 @@ class Z80
     }
 
     // Increment Register
-    static inline void INC_B(Z80* ctx) { ctx->INC_R(0b000); }
-    static inline void INC_C(Z80* ctx) { ctx->INC_R(0b001); }
-    static inline void INC_D(Z80* ctx) { ctx->INC_R(0b010); }
-    static inline void INC_E(Z80* ctx) { ctx->INC_R(0b011); }
-    static inline void INC_H(Z80* ctx) { ctx->INC_R(0b100); }
-    static inline void INC_L(Z80* ctx) { ctx->INC_R(0b101); }
-    static inline void INC_A(Z80* ctx) { ctx->INC_R(0b111); }
-    static inline void INC_B_2(Z80* ctx) { ctx->INC_R(0b000, 2); }
-    static inline void INC_C_2(Z80* ctx) { ctx->INC_R(0b001, 2); }
-    static inline void INC_D_2(Z80* ctx) { ctx->INC_R(0b010, 2); }
-    static inline void INC_E_2(Z80* ctx) { ctx->INC_R(0b011, 2); }
-    static inline void INC_A_2(Z80* ctx) { ctx->INC_R(0b111, 2); }
+    static inline void INC_B(Z80Core* ctx) { ctx->INC_R(0b000); }
+    static inline void INC_C(Z80Core* ctx) { ctx->INC_R(0b001); }
+    static inline void INC_D(Z80Core* ctx) { ctx->INC_R(0b010); }
+    static inline void INC_E(Z80Core* ctx) { ctx->INC_R(0b011); }
+    static inline void INC_H(Z80Core* ctx) { ctx->INC_R(0b100); }
+    static inline void INC_L(Z80Core* ctx) { ctx->INC_R(0b101); }
+    static inline void INC_A(Z80Core* ctx) { ctx->INC_R(0b111); }
+    static inline void INC_B_2(Z80Core* ctx) { ctx->INC_R(0b000, 2); }
+    static inline void INC_C_2(Z80Core* ctx) { ctx->INC_R(0b001, 2); }
+    static inline void INC_D_2(Z80Core* ctx) { ctx->INC_R(0b010, 2); }
+    static inline void INC_E_2(Z80Core* ctx) { ctx->INC_R(0b011, 2); }
+    static inline void INC_A_2(Z80Core* ctx) { ctx->INC_R(0b111, 2); }
     inline void INC_R(unsigned char r, int pc = 1)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -3280,7 +4407,7 @@ class Z80
     }
 
     // Increment location (HL)
-    static inline void INC_HL(Z80* ctx)
+    static inline void INC_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr);
@@ -3292,7 +4419,7 @@ class Z80
     }
 
     // Increment location (IX+d)
-    static inline void INC_IX_(Z80* ctx) { ctx->INC_IX(); }
+    static inline void INC_IX_(Z80Core* ctx) { ctx->INC_IX(); }
     inline void INC_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3307,7 +4434,7 @@ class Z80
     }
 
     // Increment register high 8 bits of IX
-    static inline void INC_IXH_(Z80* ctx) { ctx->INC_IXH(); }
+    static inline void INC_IXH_(Z80Core* ctx) { ctx->INC_IXH(); }
     inline void INC_IXH()
     {
         unsigned char ixh = getIXH();
@@ -3319,7 +4446,7 @@ class Z80
     }
 
     // Increment register low 8 bits of IX
-    static inline void INC_IXL_(Z80* ctx) { ctx->INC_IXL(); }
+    static inline void INC_IXL_(Z80Core* ctx) { ctx->INC_IXL(); }
     inline void INC_IXL()
     {
         unsigned char ixl = getIXL();
@@ -3331,7 +4458,7 @@ class Z80
     }
 
     // Increment location (IY+d)
-    static inline void INC_IY_(Z80* ctx) { ctx->INC_IY(); }
+    static inline void INC_IY_(Z80Core* ctx) { ctx->INC_IY(); }
     inline void INC_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3346,7 +4473,7 @@ class Z80
     }
 
     // Increment register high 8 bits of IY
-    static inline void INC_IYH_(Z80* ctx) { ctx->INC_IYH(); }
+    static inline void INC_IYH_(Z80Core* ctx) { ctx->INC_IYH(); }
     inline void INC_IYH()
     {
         unsigned char iyh = getIYH();
@@ -3358,7 +4485,7 @@ class Z80
     }
 
     // Increment register low 8 bits of IY
-    static inline void INC_IYL_(Z80* ctx) { ctx->INC_IYL(); }
+    static inline void INC_IYL_(Z80Core* ctx) { ctx->INC_IYL(); }
     inline void INC_IYL()
     {
         unsigned char iyl = getIYL();
@@ -3370,18 +4497,18 @@ class Z80
     }
 
     // Subtract Register
-    static inline void SUB_B(Z80* ctx) { ctx->SUB_R(0b000); }
-    static inline void SUB_C(Z80* ctx) { ctx->SUB_R(0b001); }
-    static inline void SUB_D(Z80* ctx) { ctx->SUB_R(0b010); }
-    static inline void SUB_E(Z80* ctx) { ctx->SUB_R(0b011); }
-    static inline void SUB_H(Z80* ctx) { ctx->SUB_R(0b100); }
-    static inline void SUB_L(Z80* ctx) { ctx->SUB_R(0b101); }
-    static inline void SUB_A(Z80* ctx) { ctx->SUB_R(0b111); }
-    static inline void SUB_B_2(Z80* ctx) { ctx->SUB_R(0b000, 2); }
-    static inline void SUB_C_2(Z80* ctx) { ctx->SUB_R(0b001, 2); }
-    static inline void SUB_D_2(Z80* ctx) { ctx->SUB_R(0b010, 2); }
-    static inline void SUB_E_2(Z80* ctx) { ctx->SUB_R(0b011, 2); }
-    static inline void SUB_A_2(Z80* ctx) { ctx->SUB_R(0b111, 2); }
+    static inline void SUB_B(Z80Core* ctx) { ctx->SUB_R(0b000); }
+    static inline void SUB_C(Z80Core* ctx) { ctx->SUB_R(0b001); }
+    static inline void SUB_D(Z80Core* ctx) { ctx->SUB_R(0b010); }
+    static inline void SUB_E(Z80Core* ctx) { ctx->SUB_R(0b011); }
+    static inline void SUB_H(Z80Core* ctx) { ctx->SUB_R(0b100); }
+    static inline void SUB_L(Z80Core* ctx) { ctx->SUB_R(0b101); }
+    static inline void SUB_A(Z80Core* ctx) { ctx->SUB_R(0b111); }
+    static inline void SUB_B_2(Z80Core* ctx) { ctx->SUB_R(0b000, 2); }
+    static inline void SUB_C_2(Z80Core* ctx) { ctx->SUB_R(0b001, 2); }
+    static inline void SUB_D_2(Z80Core* ctx) { ctx->SUB_R(0b010, 2); }
+    static inline void SUB_E_2(Z80Core* ctx) { ctx->SUB_R(0b011, 2); }
+    static inline void SUB_A_2(Z80Core* ctx) { ctx->SUB_R(0b111, 2); }
     inline void SUB_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3392,7 +4519,7 @@ class Z80
     }
 
     // Subtract IXH to Acc.
-    static inline void SUB_IXH_(Z80* ctx) { ctx->SUB_IXH(); }
+    static inline void SUB_IXH_(Z80Core* ctx) { ctx->SUB_IXH(); }
     inline void SUB_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3402,7 +4529,7 @@ class Z80
     }
 
     // Subtract IXL to Acc.
-    static inline void SUB_IXL_(Z80* ctx) { ctx->SUB_IXL(); }
+    static inline void SUB_IXL_(Z80Core* ctx) { ctx->SUB_IXL(); }
     inline void SUB_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3412,7 +4539,7 @@ class Z80
     }
 
     // Subtract IYH to Acc.
-    static inline void SUB_IYH_(Z80* ctx) { ctx->SUB_IYH(); }
+    static inline void SUB_IYH_(Z80Core* ctx) { ctx->SUB_IYH(); }
     inline void SUB_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3422,7 +4549,7 @@ class Z80
     }
 
     // Subtract IYL to Acc.
-    static inline void SUB_IYL_(Z80* ctx) { ctx->SUB_IYL(); }
+    static inline void SUB_IYL_(Z80Core* ctx) { ctx->SUB_IYL(); }
     inline void SUB_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3432,7 +4559,7 @@ class Z80
     }
 
     // Subtract immediate
-    static inline void SUB_N(Z80* ctx)
+    static inline void SUB_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -3442,7 +4569,7 @@ class Z80
     }
 
     // Subtract memory
-    static inline void SUB_HL(Z80* ctx)
+    static inline void SUB_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr, 3);
@@ -3453,7 +4580,7 @@ class Z80
     }
 
     // Subtract memory
-    static inline void SUB_IX_(Z80* ctx) { ctx->SUB_IX(); }
+    static inline void SUB_IX_(Z80Core* ctx) { ctx->SUB_IX(); }
     inline void SUB_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3467,7 +4594,7 @@ class Z80
     }
 
     // Subtract memory
-    static inline void SUB_IY_(Z80* ctx) { ctx->SUB_IY(); }
+    static inline void SUB_IY_(Z80Core* ctx) { ctx->SUB_IY(); }
     inline void SUB_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3481,18 +4608,18 @@ class Z80
     }
 
     // Subtract Resister with carry
-    static inline void SBC_B(Z80* ctx) { ctx->SBC_R(0b000); }
-    static inline void SBC_C(Z80* ctx) { ctx->SBC_R(0b001); }
-    static inline void SBC_D(Z80* ctx) { ctx->SBC_R(0b010); }
-    static inline void SBC_E(Z80* ctx) { ctx->SBC_R(0b011); }
-    static inline void SBC_H(Z80* ctx) { ctx->SBC_R(0b100); }
-    static inline void SBC_L(Z80* ctx) { ctx->SBC_R(0b101); }
-    static inline void SBC_A(Z80* ctx) { ctx->SBC_R(0b111); }
-    static inline void SBC_B_2(Z80* ctx) { ctx->SBC_R(0b000, 2); }
-    static inline void SBC_C_2(Z80* ctx) { ctx->SBC_R(0b001, 2); }
-    static inline void SBC_D_2(Z80* ctx) { ctx->SBC_R(0b010, 2); }
-    static inline void SBC_E_2(Z80* ctx) { ctx->SBC_R(0b011, 2); }
-    static inline void SBC_A_2(Z80* ctx) { ctx->SBC_R(0b111, 2); }
+    static inline void SBC_B(Z80Core* ctx) { ctx->SBC_R(0b000); }
+    static inline void SBC_C(Z80Core* ctx) { ctx->SBC_R(0b001); }
+    static inline void SBC_D(Z80Core* ctx) { ctx->SBC_R(0b010); }
+    static inline void SBC_E(Z80Core* ctx) { ctx->SBC_R(0b011); }
+    static inline void SBC_H(Z80Core* ctx) { ctx->SBC_R(0b100); }
+    static inline void SBC_L(Z80Core* ctx) { ctx->SBC_R(0b101); }
+    static inline void SBC_A(Z80Core* ctx) { ctx->SBC_R(0b111); }
+    static inline void SBC_B_2(Z80Core* ctx) { ctx->SBC_R(0b000, 2); }
+    static inline void SBC_C_2(Z80Core* ctx) { ctx->SBC_R(0b001, 2); }
+    static inline void SBC_D_2(Z80Core* ctx) { ctx->SBC_R(0b010, 2); }
+    static inline void SBC_E_2(Z80Core* ctx) { ctx->SBC_R(0b011, 2); }
+    static inline void SBC_A_2(Z80Core* ctx) { ctx->SBC_R(0b111, 2); }
     inline void SBC_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3502,7 +4629,7 @@ class Z80
     }
 
     // Subtract IXH to Acc. with carry
-    static inline void SBC_IXH_(Z80* ctx) { ctx->SBC_IXH(); }
+    static inline void SBC_IXH_(Z80Core* ctx) { ctx->SBC_IXH(); }
     inline void SBC_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3512,7 +4639,7 @@ class Z80
     }
 
     // Subtract IXL to Acc. with carry
-    static inline void SBC_IXL_(Z80* ctx) { ctx->SBC_IXL(); }
+    static inline void SBC_IXL_(Z80Core* ctx) { ctx->SBC_IXL(); }
     inline void SBC_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3522,7 +4649,7 @@ class Z80
     }
 
     // Subtract IYH to Acc. with carry
-    static inline void SBC_IYH_(Z80* ctx) { ctx->SBC_IYH(); }
+    static inline void SBC_IYH_(Z80Core* ctx) { ctx->SBC_IYH(); }
     inline void SBC_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3532,7 +4659,7 @@ class Z80
     }
 
     // Subtract IYL to Acc. with carry
-    static inline void SBC_IYL_(Z80* ctx) { ctx->SBC_IYL(); }
+    static inline void SBC_IYL_(Z80Core* ctx) { ctx->SBC_IYL(); }
     inline void SBC_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3542,7 +4669,7 @@ class Z80
     }
 
     // Subtract immediate with carry
-    static inline void SBC_N(Z80* ctx)
+    static inline void SBC_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -3552,7 +4679,7 @@ class Z80
     }
 
     // Subtract memory with carry
-    static inline void SBC_HL(Z80* ctx)
+    static inline void SBC_HL(Z80Core* ctx)
     {
         unsigned char n = ctx->readByte(ctx->getHL(), 3);
 #ifndef Z80_DISABLE_DEBUG
@@ -3562,7 +4689,7 @@ class Z80
     }
 
     // Subtract memory with carry
-    static inline void SBC_IX_(Z80* ctx) { ctx->SBC_IX(); }
+    static inline void SBC_IX_(Z80Core* ctx) { ctx->SBC_IX(); }
     inline void SBC_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3575,7 +4702,7 @@ class Z80
     }
 
     // Subtract memory with carry
-    static inline void SBC_IY_(Z80* ctx) { ctx->SBC_IY(); }
+    static inline void SBC_IY_(Z80Core* ctx) { ctx->SBC_IY(); }
     inline void SBC_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3588,18 +4715,18 @@ class Z80
     }
 
     // Decrement Register
-    static inline void DEC_B(Z80* ctx) { ctx->DEC_R(0b000); }
-    static inline void DEC_C(Z80* ctx) { ctx->DEC_R(0b001); }
-    static inline void DEC_D(Z80* ctx) { ctx->DEC_R(0b010); }
-    static inline void DEC_E(Z80* ctx) { ctx->DEC_R(0b011); }
-    static inline void DEC_H(Z80* ctx) { ctx->DEC_R(0b100); }
-    static inline void DEC_L(Z80* ctx) { ctx->DEC_R(0b101); }
-    static inline void DEC_A(Z80* ctx) { ctx->DEC_R(0b111); }
-    static inline void DEC_B_2(Z80* ctx) { ctx->DEC_R(0b000, 2); }
-    static inline void DEC_C_2(Z80* ctx) { ctx->DEC_R(0b001, 2); }
-    static inline void DEC_D_2(Z80* ctx) { ctx->DEC_R(0b010, 2); }
-    static inline void DEC_E_2(Z80* ctx) { ctx->DEC_R(0b011, 2); }
-    static inline void DEC_A_2(Z80* ctx) { ctx->DEC_R(0b111, 2); }
+    static inline void DEC_B(Z80Core* ctx) { ctx->DEC_R(0b000); }
+    static inline void DEC_C(Z80Core* ctx) { ctx->DEC_R(0b001); }
+    static inline void DEC_D(Z80Core* ctx) { ctx->DEC_R(0b010); }
+    static inline void DEC_E(Z80Core* ctx) { ctx->DEC_R(0b011); }
+    static inline void DEC_H(Z80Core* ctx) { ctx->DEC_R(0b100); }
+    static inline void DEC_L(Z80Core* ctx) { ctx->DEC_R(0b101); }
+    static inline void DEC_A(Z80Core* ctx) { ctx->DEC_R(0b111); }
+    static inline void DEC_B_2(Z80Core* ctx) { ctx->DEC_R(0b000, 2); }
+    static inline void DEC_C_2(Z80Core* ctx) { ctx->DEC_R(0b001, 2); }
+    static inline void DEC_D_2(Z80Core* ctx) { ctx->DEC_R(0b010, 2); }
+    static inline void DEC_E_2(Z80Core* ctx) { ctx->DEC_R(0b011, 2); }
+    static inline void DEC_A_2(Z80Core* ctx) { ctx->DEC_R(0b111, 2); }
     inline void DEC_R(unsigned char r, int pc = 1)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -3611,7 +4738,7 @@ class Z80
     }
 
     // Decrement location (HL)
-    static inline void DEC_HL(Z80* ctx)
+    static inline void DEC_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr);
@@ -3623,7 +4750,7 @@ class Z80
     }
 
     // Decrement location (IX+d)
-    static inline void DEC_IX_(Z80* ctx) { ctx->DEC_IX(); }
+    static inline void DEC_IX_(Z80Core* ctx) { ctx->DEC_IX(); }
     inline void DEC_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -3638,7 +4765,7 @@ class Z80
     }
 
     // Decrement high 8 bits of IX
-    static inline void DEC_IXH_(Z80* ctx) { ctx->DEC_IXH(); }
+    static inline void DEC_IXH_(Z80Core* ctx) { ctx->DEC_IXH(); }
     inline void DEC_IXH()
     {
         unsigned char ixh = getIXH();
@@ -3650,7 +4777,7 @@ class Z80
     }
 
     // Decrement low 8 bits of IX
-    static inline void DEC_IXL_(Z80* ctx) { ctx->DEC_IXL(); }
+    static inline void DEC_IXL_(Z80Core* ctx) { ctx->DEC_IXL(); }
     inline void DEC_IXL()
     {
         unsigned char ixl = getIXL();
@@ -3662,7 +4789,7 @@ class Z80
     }
 
     // Decrement location (IY+d)
-    static inline void DEC_IY_(Z80* ctx) { ctx->DEC_IY(); }
+    static inline void DEC_IY_(Z80Core* ctx) { ctx->DEC_IY(); }
     inline void DEC_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -3677,7 +4804,7 @@ class Z80
     }
 
     // Decrement high 8 bits of IY
-    static inline void DEC_IYH_(Z80* ctx) { ctx->DEC_IYH(); }
+    static inline void DEC_IYH_(Z80Core* ctx) { ctx->DEC_IYH(); }
     inline void DEC_IYH()
     {
         unsigned char iyh = getIYH();
@@ -3689,7 +4816,7 @@ class Z80
     }
 
     // Decrement low 8 bits of IY
-    static inline void DEC_IYL_(Z80* ctx) { ctx->DEC_IYL(); }
+    static inline void DEC_IYL_(Z80Core* ctx) { ctx->DEC_IYL(); }
     inline void DEC_IYL()
     {
         unsigned char iyl = getIYL();
@@ -3727,10 +4854,10 @@ class Z80
     }
 
     // Add register pair to H and L
-    static inline void ADD_HL_BC(Z80* ctx) { ctx->ADD_HL_RP(0b00); }
-    static inline void ADD_HL_DE(Z80* ctx) { ctx->ADD_HL_RP(0b01); }
-    static inline void ADD_HL_HL(Z80* ctx) { ctx->ADD_HL_RP(0b10); }
-    static inline void ADD_HL_SP(Z80* ctx) { ctx->ADD_HL_RP(0b11); }
+    static inline void ADD_HL_BC(Z80Core* ctx) { ctx->ADD_HL_RP(0b00); }
+    static inline void ADD_HL_DE(Z80Core* ctx) { ctx->ADD_HL_RP(0b01); }
+    static inline void ADD_HL_HL(Z80Core* ctx) { ctx->ADD_HL_RP(0b10); }
+    static inline void ADD_HL_SP(Z80Core* ctx) { ctx->ADD_HL_RP(0b11); }
     inline void ADD_HL_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3745,10 +4872,10 @@ class Z80
     }
 
     // Add with carry register pair to HL
-    static inline void ADC_HL_BC(Z80* ctx) { ctx->ADC_HL_RP(0b00); }
-    static inline void ADC_HL_DE(Z80* ctx) { ctx->ADC_HL_RP(0b01); }
-    static inline void ADC_HL_HL(Z80* ctx) { ctx->ADC_HL_RP(0b10); }
-    static inline void ADC_HL_SP(Z80* ctx) { ctx->ADC_HL_RP(0b11); }
+    static inline void ADC_HL_BC(Z80Core* ctx) { ctx->ADC_HL_RP(0b00); }
+    static inline void ADC_HL_DE(Z80Core* ctx) { ctx->ADC_HL_RP(0b01); }
+    static inline void ADC_HL_HL(Z80Core* ctx) { ctx->ADC_HL_RP(0b10); }
+    static inline void ADC_HL_SP(Z80Core* ctx) { ctx->ADC_HL_RP(0b11); }
     inline void ADC_HL_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3764,10 +4891,10 @@ class Z80
     }
 
     // Add register pair to IX
-    static inline void ADD_IX_BC(Z80* ctx) { ctx->ADD_IX_RP(0b00); }
-    static inline void ADD_IX_DE(Z80* ctx) { ctx->ADD_IX_RP(0b01); }
-    static inline void ADD_IX_IX(Z80* ctx) { ctx->ADD_IX_RP(0b10); }
-    static inline void ADD_IX_SP(Z80* ctx) { ctx->ADD_IX_RP(0b11); }
+    static inline void ADD_IX_BC(Z80Core* ctx) { ctx->ADD_IX_RP(0b00); }
+    static inline void ADD_IX_DE(Z80Core* ctx) { ctx->ADD_IX_RP(0b01); }
+    static inline void ADD_IX_IX(Z80Core* ctx) { ctx->ADD_IX_RP(0b10); }
+    static inline void ADD_IX_SP(Z80Core* ctx) { ctx->ADD_IX_RP(0b11); }
     inline void ADD_IX_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3780,10 +4907,10 @@ class Z80
     }
 
     // Add register pair to IY
-    static inline void ADD_IY_BC(Z80* ctx) { ctx->ADD_IY_RP(0b00); }
-    static inline void ADD_IY_DE(Z80* ctx) { ctx->ADD_IY_RP(0b01); }
-    static inline void ADD_IY_IY(Z80* ctx) { ctx->ADD_IY_RP(0b10); }
-    static inline void ADD_IY_SP(Z80* ctx) { ctx->ADD_IY_RP(0b11); }
+    static inline void ADD_IY_BC(Z80Core* ctx) { ctx->ADD_IY_RP(0b00); }
+    static inline void ADD_IY_DE(Z80Core* ctx) { ctx->ADD_IY_RP(0b01); }
+    static inline void ADD_IY_IY(Z80Core* ctx) { ctx->ADD_IY_RP(0b10); }
+    static inline void ADD_IY_SP(Z80Core* ctx) { ctx->ADD_IY_RP(0b11); }
     inline void ADD_IY_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3796,10 +4923,10 @@ class Z80
     }
 
     // Increment register pair
-    static inline void INC_RP_BC(Z80* ctx) { ctx->INC_RP(0b00); }
-    static inline void INC_RP_DE(Z80* ctx) { ctx->INC_RP(0b01); }
-    static inline void INC_RP_HL(Z80* ctx) { ctx->INC_RP(0b10); }
-    static inline void INC_RP_SP(Z80* ctx) { ctx->INC_RP(0b11); }
+    static inline void INC_RP_BC(Z80Core* ctx) { ctx->INC_RP(0b00); }
+    static inline void INC_RP_DE(Z80Core* ctx) { ctx->INC_RP(0b01); }
+    static inline void INC_RP_HL(Z80Core* ctx) { ctx->INC_RP(0b10); }
+    static inline void INC_RP_SP(Z80Core* ctx) { ctx->INC_RP(0b11); }
     inline void INC_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3810,7 +4937,7 @@ class Z80
     }
 
     // Increment IX
-    static inline void INC_IX_reg_(Z80* ctx) { ctx->INC_IX_reg(); }
+    static inline void INC_IX_reg_(Z80Core* ctx) { ctx->INC_IX_reg(); }
     inline void INC_IX_reg()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3821,7 +4948,7 @@ class Z80
     }
 
     // Increment IY
-    static inline void INC_IY_reg_(Z80* ctx) { ctx->INC_IY_reg(); }
+    static inline void INC_IY_reg_(Z80Core* ctx) { ctx->INC_IY_reg(); }
     inline void INC_IY_reg()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3832,10 +4959,10 @@ class Z80
     }
 
     // Decrement register pair
-    static inline void DEC_RP_BC(Z80* ctx) { ctx->DEC_RP(0b00); }
-    static inline void DEC_RP_DE(Z80* ctx) { ctx->DEC_RP(0b01); }
-    static inline void DEC_RP_HL(Z80* ctx) { ctx->DEC_RP(0b10); }
-    static inline void DEC_RP_SP(Z80* ctx) { ctx->DEC_RP(0b11); }
+    static inline void DEC_RP_BC(Z80Core* ctx) { ctx->DEC_RP(0b00); }
+    static inline void DEC_RP_DE(Z80Core* ctx) { ctx->DEC_RP(0b01); }
+    static inline void DEC_RP_HL(Z80Core* ctx) { ctx->DEC_RP(0b10); }
+    static inline void DEC_RP_SP(Z80Core* ctx) { ctx->DEC_RP(0b11); }
     inline void DEC_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3846,7 +4973,7 @@ class Z80
     }
 
     // Decrement IX
-    static inline void DEC_IX_reg_(Z80* ctx) { ctx->DEC_IX_reg(); }
+    static inline void DEC_IX_reg_(Z80Core* ctx) { ctx->DEC_IX_reg(); }
     inline void DEC_IX_reg()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3857,7 +4984,7 @@ class Z80
     }
 
     // Decrement IY
-    static inline void DEC_IY_reg_(Z80* ctx) { ctx->DEC_IY_reg(); }
+    static inline void DEC_IY_reg_(Z80Core* ctx) { ctx->DEC_IY_reg(); }
     inline void DEC_IY_reg()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3882,10 +5009,10 @@ class Z80
     }
 
     // Subtract register pair from HL with carry
-    static inline void SBC_HL_BC(Z80* ctx) { ctx->SBC_HL_RP(0b00); }
-    static inline void SBC_HL_DE(Z80* ctx) { ctx->SBC_HL_RP(0b01); }
-    static inline void SBC_HL_HL(Z80* ctx) { ctx->SBC_HL_RP(0b10); }
-    static inline void SBC_HL_SP(Z80* ctx) { ctx->SBC_HL_RP(0b11); }
+    static inline void SBC_HL_BC(Z80Core* ctx) { ctx->SBC_HL_RP(0b00); }
+    static inline void SBC_HL_DE(Z80Core* ctx) { ctx->SBC_HL_RP(0b01); }
+    static inline void SBC_HL_HL(Z80Core* ctx) { ctx->SBC_HL_RP(0b10); }
+    static inline void SBC_HL_SP(Z80Core* ctx) { ctx->SBC_HL_RP(0b11); }
     inline void SBC_HL_RP(unsigned char rp)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3902,48 +5029,58 @@ class Z80
 
     inline void setFlagByLogical()
     {
-        setFlagS(reg.pair.A & 0x80);
-        setFlagZ(reg.pair.A == 0);
-        setFlagXY(reg.pair.A);
-        setFlagPV(isEvenNumberBits(reg.pair.A));
-        resetFlagN();
-        resetFlagC();
+#ifdef Z80_LAZY_FLAGS
+        lazy.kind = 2;
+        lazy.result = reg.pair.A;
+        lazy.xy = reg.pair.A;
+        lazy.fixed = 0;
+#else
+        regF() = flagTableSZ53P[reg.pair.A];
+#endif
     }
 
     inline void and8(unsigned char n)
     {
         reg.pair.A &= n;
         setFlagByLogical();
+#ifdef Z80_LAZY_FLAGS
+        lazy.fixed = flagH();
+#else
         setFlagH();
+#endif
     }
 
     inline void or8(unsigned char n)
     {
         reg.pair.A |= n;
         setFlagByLogical();
+#ifndef Z80_LAZY_FLAGS
         resetFlagH();
+#endif
     }
 
     inline void xor8(unsigned char n)
     {
         reg.pair.A ^= n;
         setFlagByLogical();
+#ifndef Z80_LAZY_FLAGS
         resetFlagH();
+#endif
     }
 
     // AND Register
-    static inline void AND_B(Z80* ctx) { ctx->AND_R(0b000); }
-    static inline void AND_C(Z80* ctx) { ctx->AND_R(0b001); }
-    static inline void AND_D(Z80* ctx) { ctx->AND_R(0b010); }
-    static inline void AND_E(Z80* ctx) { ctx->AND_R(0b011); }
-    static inline void AND_H(Z80* ctx) { ctx->AND_R(0b100); }
-    static inline void AND_L(Z80* ctx) { ctx->AND_R(0b101); }
-    static inline void AND_A(Z80* ctx) { ctx->AND_R(0b111); }
-    static inline void AND_B_2(Z80* ctx) { ctx->AND_R(0b000, 2); }
-    static inline void AND_C_2(Z80* ctx) { ctx->AND_R(0b001, 2); }
-    static inline void AND_D_2(Z80* ctx) { ctx->AND_R(0b010, 2); }
-    static inline void AND_E_2(Z80* ctx) { ctx->AND_R(0b011, 2); }
-    static inline void AND_A_2(Z80* ctx) { ctx->AND_R(0b111, 2); }
+    static inline void AND_B(Z80Core* ctx) { ctx->AND_R(0b000); }
+    static inline void AND_C(Z80Core* ctx) { ctx->AND_R(0b001); }
+    static inline void AND_D(Z80Core* ctx) { ctx->AND_R(0b010); }
+    static inline void AND_E(Z80Core* ctx) { ctx->AND_R(0b011); }
+    static inline void AND_H(Z80Core* ctx) { ctx->AND_R(0b100); }
+    static inline void AND_L(Z80Core* ctx) { ctx->AND_R(0b101); }
+    static inline void AND_A(Z80Core* ctx) { ctx->AND_R(0b111); }
+    static inline void AND_B_2(Z80Core* ctx) { ctx->AND_R(0b000, 2); }
+    static inline void AND_C_2(Z80Core* ctx) { ctx->AND_R(0b001, 2); }
+    static inline void AND_D_2(Z80Core* ctx) { ctx->AND_R(0b010, 2); }
+    static inline void AND_E_2(Z80Core* ctx) { ctx->AND_R(0b011, 2); }
+    static inline void AND_A_2(Z80Core* ctx) { ctx->AND_R(0b111, 2); }
     inline void AND_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3953,7 +5090,7 @@ class Z80
     }
 
     // AND with register IXH
-    static inline void AND_IXH_(Z80* ctx) { ctx->AND_IXH(); }
+    static inline void AND_IXH_(Z80Core* ctx) { ctx->AND_IXH(); }
     inline void AND_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3963,7 +5100,7 @@ class Z80
     }
 
     // AND with register IXL
-    static inline void AND_IXL_(Z80* ctx) { ctx->AND_IXL(); }
+    static inline void AND_IXL_(Z80Core* ctx) { ctx->AND_IXL(); }
     inline void AND_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3973,7 +5110,7 @@ class Z80
     }
 
     // AND with register IYH
-    static inline void AND_IYH_(Z80* ctx) { ctx->AND_IYH(); }
+    static inline void AND_IYH_(Z80Core* ctx) { ctx->AND_IYH(); }
     inline void AND_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3983,7 +5120,7 @@ class Z80
     }
 
     // AND with register IYL
-    static inline void AND_IYL_(Z80* ctx) { ctx->AND_IYL(); }
+    static inline void AND_IYL_(Z80Core* ctx) { ctx->AND_IYL(); }
     inline void AND_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -3993,7 +5130,7 @@ class Z80
     }
 
     // AND immediate
-    static inline void AND_N(Z80* ctx)
+    static inline void AND_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -4003,7 +5140,7 @@ class Z80
     }
 
     // AND Memory
-    static inline void AND_HL(Z80* ctx)
+    static inline void AND_HL(Z80Core* ctx)
     {
         unsigned short addr = ctx->getHL();
         unsigned char n = ctx->readByte(addr, 3);
@@ -4014,7 +5151,7 @@ class Z80
     }
 
     // AND Memory
-    static inline void AND_IX_(Z80* ctx) { ctx->AND_IX(); }
+    static inline void AND_IX_(Z80Core* ctx) { ctx->AND_IX(); }
     inline void AND_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -4027,7 +5164,7 @@ class Z80
     }
 
     // AND Memory
-    static inline void AND_IY_(Z80* ctx) { ctx->AND_IY(); }
+    static inline void AND_IY_(Z80Core* ctx) { ctx->AND_IY(); }
     inline void AND_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -4040,18 +5177,18 @@ class Z80
     }
 
     // OR Register
-    static inline void OR_B(Z80* ctx) { ctx->OR_R(0b000); }
-    static inline void OR_C(Z80* ctx) { ctx->OR_R(0b001); }
-    static inline void OR_D(Z80* ctx) { ctx->OR_R(0b010); }
-    static inline void OR_E(Z80* ctx) { ctx->OR_R(0b011); }
-    static inline void OR_H(Z80* ctx) { ctx->OR_R(0b100); }
-    static inline void OR_L(Z80* ctx) { ctx->OR_R(0b101); }
-    static inline void OR_A(Z80* ctx) { ctx->OR_R(0b111); }
-    static inline void OR_B_2(Z80* ctx) { ctx->OR_R(0b000, 2); }
-    static inline void OR_C_2(Z80* ctx) { ctx->OR_R(0b001, 2); }
-    static inline void OR_D_2(Z80* ctx) { ctx->OR_R(0b010, 2); }
-    static inline void OR_E_2(Z80* ctx) { ctx->OR_R(0b011, 2); }
-    static inline void OR_A_2(Z80* ctx) { ctx->OR_R(0b111, 2); }
+    static inline void OR_B(Z80Core* ctx) { ctx->OR_R(0b000); }
+    static inline void OR_C(Z80Core* ctx) { ctx->OR_R(0b001); }
+    static inline void OR_D(Z80Core* ctx) { ctx->OR_R(0b010); }
+    static inline void OR_E(Z80Core* ctx) { ctx->OR_R(0b011); }
+    static inline void OR_H(Z80Core* ctx) { ctx->OR_R(0b100); }
+    static inline void OR_L(Z80Core* ctx) { ctx->OR_R(0b101); }
+    static inline void OR_A(Z80Core* ctx) { ctx->OR_R(0b111); }
+    static inline void OR_B_2(Z80Core* ctx) { ctx->OR_R(0b000, 2); }
+    static inline void OR_C_2(Z80Core* ctx) { ctx->OR_R(0b001, 2); }
+    static inline void OR_D_2(Z80Core* ctx) { ctx->OR_R(0b010, 2); }
+    static inline void OR_E_2(Z80Core* ctx) { ctx->OR_R(0b011, 2); }
+    static inline void OR_A_2(Z80Core* ctx) { ctx->OR_R(0b111, 2); }
     inline void OR_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4061,7 +5198,7 @@ class Z80
     }
 
     // OR with register IXH
-    static inline void OR_IXH_(Z80* ctx) { ctx->OR_IXH(); }
+    static inline void OR_IXH_(Z80Core* ctx) { ctx->OR_IXH(); }
     inline void OR_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4071,7 +5208,7 @@ class Z80
     }
 
     // OR with register IXL
-    static inline void OR_IXL_(Z80* ctx) { ctx->OR_IXL(); }
+    static inline void OR_IXL_(Z80Core* ctx) { ctx->OR_IXL(); }
     inline void OR_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4081,7 +5218,7 @@ class Z80
     }
 
     // OR with register IYH
-    static inline void OR_IYH_(Z80* ctx) { ctx->OR_IYH(); }
+    static inline void OR_IYH_(Z80Core* ctx) { ctx->OR_IYH(); }
     inline void OR_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4091,7 +5228,7 @@ class Z80
     }
 
     // OR with register IYL
-    static inline void OR_IYL_(Z80* ctx) { ctx->OR_IYL(); }
+    static inline void OR_IYL_(Z80Core* ctx) { ctx->OR_IYL(); }
     inline void OR_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4101,7 +5238,7 @@ class Z80
     }
 
     // OR immediate
-    static inline void OR_N(Z80* ctx)
+    static inline void OR_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -4111,7 +5248,7 @@ class Z80
     }
 
     // OR Memory
-    static inline void OR_HL(Z80* ctx)
+    static inline void OR_HL(Z80Core* ctx)
     {
         unsigned char n = ctx->readByte(ctx->getHL(), 3);
 #ifndef Z80_DISABLE_DEBUG
@@ -4121,7 +5258,7 @@ class Z80
     }
 
     // OR Memory
-    static inline void OR_IX_(Z80* ctx) { ctx->OR_IX(); }
+    static inline void OR_IX_(Z80Core* ctx) { ctx->OR_IX(); }
     inline void OR_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -4134,7 +5271,7 @@ class Z80
     }
 
     // OR Memory
-    static inline void OR_IY_(Z80* ctx) { ctx->OR_IY(); }
+    static inline void OR_IY_(Z80Core* ctx) { ctx->OR_IY(); }
     inline void OR_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -4147,18 +5284,18 @@ class Z80
     }
 
     // XOR Reigster
-    static inline void XOR_B(Z80* ctx) { ctx->XOR_R(0b000); }
-    static inline void XOR_C(Z80* ctx) { ctx->XOR_R(0b001); }
-    static inline void XOR_D(Z80* ctx) { ctx->XOR_R(0b010); }
-    static inline void XOR_E(Z80* ctx) { ctx->XOR_R(0b011); }
-    static inline void XOR_H(Z80* ctx) { ctx->XOR_R(0b100); }
-    static inline void XOR_L(Z80* ctx) { ctx->XOR_R(0b101); }
-    static inline void XOR_A(Z80* ctx) { ctx->XOR_R(0b111); }
-    static inline void XOR_B_2(Z80* ctx) { ctx->XOR_R(0b000, 2); }
-    static inline void XOR_C_2(Z80* ctx) { ctx->XOR_R(0b001, 2); }
-    static inline void XOR_D_2(Z80* ctx) { ctx->XOR_R(0b010, 2); }
-    static inline void XOR_E_2(Z80* ctx) { ctx->XOR_R(0b011, 2); }
-    static inline void XOR_A_2(Z80* ctx) { ctx->XOR_R(0b111, 2); }
+    static inline void XOR_B(Z80Core* ctx) { ctx->XOR_R(0b000); }
+    static inline void XOR_C(Z80Core* ctx) { ctx->XOR_R(0b001); }
+    static inline void XOR_D(Z80Core* ctx) { ctx->XOR_R(0b010); }
+    static inline void XOR_E(Z80Core* ctx) { ctx->XOR_R(0b011); }
+    static inline void XOR_H(Z80Core* ctx) { ctx->XOR_R(0b100); }
+    static inline void XOR_L(Z80Core* ctx) { ctx->XOR_R(0b101); }
+    static inline void XOR_A(Z80Core* ctx) { ctx->XOR_R(0b111); }
+    static inline void XOR_B_2(Z80Core* ctx) { ctx->XOR_R(0b000, 2); }
+    static inline void XOR_C_2(Z80Core* ctx) { ctx->XOR_R(0b001, 2); }
+    static inline void XOR_D_2(Z80Core* ctx) { ctx->XOR_R(0b010, 2); }
+    static inline void XOR_E_2(Z80Core* ctx) { ctx->XOR_R(0b011, 2); }
+    static inline void XOR_A_2(Z80Core* ctx) { ctx->XOR_R(0b111, 2); }
     inline void XOR_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4168,7 +5305,7 @@ class Z80
     }
 
     // XOR with register IXH
-    static inline void XOR_IXH_(Z80* ctx) { ctx->XOR_IXH(); }
+    static inline void XOR_IXH_(Z80Core* ctx) { ctx->XOR_IXH(); }
     inline void XOR_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4178,7 +5315,7 @@ class Z80
     }
 
     // XOR with register IXL
-    static inline void XOR_IXL_(Z80* ctx) { ctx->XOR_IXL(); }
+    static inline void XOR_IXL_(Z80Core* ctx) { ctx->XOR_IXL(); }
     inline void XOR_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4188,7 +5325,7 @@ class Z80
     }
 
     // XOR with register IYH
-    static inline void XOR_IYH_(Z80* ctx) { ctx->XOR_IYH(); }
+    static inline void XOR_IYH_(Z80Core* ctx) { ctx->XOR_IYH(); }
     inline void XOR_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4198,7 +5335,7 @@ class Z80
     }
 
     // XOR with register IYL
-    static inline void XOR_IYL_(Z80* ctx) { ctx->XOR_IYL(); }
+    static inline void XOR_IYL_(Z80Core* ctx) { ctx->XOR_IYL(); }
     inline void XOR_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4208,7 +5345,7 @@ class Z80
     }
 
     // XOR immediate
-    static inline void XOR_N(Z80* ctx)
+    static inline void XOR_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -4218,7 +5355,7 @@ class Z80
     }
 
     // XOR Memory
-    static inline void XOR_HL(Z80* ctx)
+    static inline void XOR_HL(Z80Core* ctx)
     {
         unsigned char n = ctx->readByte(ctx->getHL(), 3);
 #ifndef Z80_DISABLE_DEBUG
@@ -4228,7 +5365,7 @@ class Z80
     }
 
     // XOR Memory
-    static inline void XOR_IX_(Z80* ctx) { ctx->XOR_IX(); }
+    static inline void XOR_IX_(Z80Core* ctx) { ctx->XOR_IX(); }
     inline void XOR_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -4241,7 +5378,7 @@ class Z80
     }
 
     // XOR Memory
-    static inline void XOR_IY_(Z80* ctx) { ctx->XOR_IY(); }
+    static inline void XOR_IY_(Z80Core* ctx) { ctx->XOR_IY(); }
     inline void XOR_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -4254,7 +5391,7 @@ class Z80
     }
 
     // Complement acc. (1's Comp.)
-    static inline void CPL(Z80* ctx)
+    static inline void CPL(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] CPL %s", ctx->reg.PC - 1, ctx->registerDump(0b111));
@@ -4266,7 +5403,7 @@ class Z80
     }
 
     // Negate Acc. (2's Comp.)
-    static inline void NEG_(Z80* ctx) { ctx->NEG(); }
+    static inline void NEG_(Z80Core* ctx) { ctx->NEG(); }
     inline void NEG()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -4278,7 +5415,7 @@ class Z80
     }
 
     // 　Complement Carry Flag
-    static inline void CCF(Z80* ctx)
+    static inline void CCF(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] CCF <C:%s -> %s>", ctx->reg.PC - 1, ctx->isFlagC() ? "ON" : "OFF", !ctx->isFlagC() ? "ON" : "OFF");
@@ -4290,7 +5427,7 @@ class Z80
     }
 
     // Set Carry Flag
-    static inline void SCF(Z80* ctx)
+    static inline void SCF(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] SCF <C:%s -> ON>", ctx->reg.PC - 1, ctx->isFlagC() ? "ON" : "OFF");
@@ -4302,62 +5439,62 @@ class Z80
     }
 
     // Test BIT b of register r
-    static inline void BIT_B_0(Z80* ctx) { ctx->BIT_R(0b000, 0); }
-    static inline void BIT_B_1(Z80* ctx) { ctx->BIT_R(0b000, 1); }
-    static inline void BIT_B_2(Z80* ctx) { ctx->BIT_R(0b000, 2); }
-    static inline void BIT_B_3(Z80* ctx) { ctx->BIT_R(0b000, 3); }
-    static inline void BIT_B_4(Z80* ctx) { ctx->BIT_R(0b000, 4); }
-    static inline void BIT_B_5(Z80* ctx) { ctx->BIT_R(0b000, 5); }
-    static inline void BIT_B_6(Z80* ctx) { ctx->BIT_R(0b000, 6); }
-    static inline void BIT_B_7(Z80* ctx) { ctx->BIT_R(0b000, 7); }
-    static inline void BIT_C_0(Z80* ctx) { ctx->BIT_R(0b001, 0); }
-    static inline void BIT_C_1(Z80* ctx) { ctx->BIT_R(0b001, 1); }
-    static inline void BIT_C_2(Z80* ctx) { ctx->BIT_R(0b001, 2); }
-    static inline void BIT_C_3(Z80* ctx) { ctx->BIT_R(0b001, 3); }
-    static inline void BIT_C_4(Z80* ctx) { ctx->BIT_R(0b001, 4); }
-    static inline void BIT_C_5(Z80* ctx) { ctx->BIT_R(0b001, 5); }
-    static inline void BIT_C_6(Z80* ctx) { ctx->BIT_R(0b001, 6); }
-    static inline void BIT_C_7(Z80* ctx) { ctx->BIT_R(0b001, 7); }
-    static inline void BIT_D_0(Z80* ctx) { ctx->BIT_R(0b010, 0); }
-    static inline void BIT_D_1(Z80* ctx) { ctx->BIT_R(0b010, 1); }
-    static inline void BIT_D_2(Z80* ctx) { ctx->BIT_R(0b010, 2); }
-    static inline void BIT_D_3(Z80* ctx) { ctx->BIT_R(0b010, 3); }
-    static inline void BIT_D_4(Z80* ctx) { ctx->BIT_R(0b010, 4); }
-    static inline void BIT_D_5(Z80* ctx) { ctx->BIT_R(0b010, 5); }
-    static inline void BIT_D_6(Z80* ctx) { ctx->BIT_R(0b010, 6); }
-    static inline void BIT_D_7(Z80* ctx) { ctx->BIT_R(0b010, 7); }
-    static inline void BIT_E_0(Z80* ctx) { ctx->BIT_R(0b011, 0); }
-    static inline void BIT_E_1(Z80* ctx) { ctx->BIT_R(0b011, 1); }
-    static inline void BIT_E_2(Z80* ctx) { ctx->BIT_R(0b011, 2); }
-    static inline void BIT_E_3(Z80* ctx) { ctx->BIT_R(0b011, 3); }
-    static inline void BIT_E_4(Z80* ctx) { ctx->BIT_R(0b011, 4); }
-    static inline void BIT_E_5(Z80* ctx) { ctx->BIT_R(0b011, 5); }
-    static inline void BIT_E_6(Z80* ctx) { ctx->BIT_R(0b011, 6); }
-    static inline void BIT_E_7(Z80* ctx) { ctx->BIT_R(0b011, 7); }
-    static inline void BIT_H_0(Z80* ctx) { ctx->BIT_R(0b100, 0); }
-    static inline void BIT_H_1(Z80* ctx) { ctx->BIT_R(0b100, 1); }
-    static inline void BIT_H_2(Z80* ctx) { ctx->BIT_R(0b100, 2); }
-    static inline void BIT_H_3(Z80* ctx) { ctx->BIT_R(0b100, 3); }
-    static inline void BIT_H_4(Z80* ctx) { ctx->BIT_R(0b100, 4); }
-    static inline void BIT_H_5(Z80* ctx) { ctx->BIT_R(0b100, 5); }
-    static inline void BIT_H_6(Z80* ctx) { ctx->BIT_R(0b100, 6); }
-    static inline void BIT_H_7(Z80* ctx) { ctx->BIT_R(0b100, 7); }
-    static inline void BIT_L_0(Z80* ctx) { ctx->BIT_R(0b101, 0); }
-    static inline void BIT_L_1(Z80* ctx) { ctx->BIT_R(0b101, 1); }
-    static inline void BIT_L_2(Z80* ctx) { ctx->BIT_R(0b101, 2); }
-    static inline void BIT_L_3(Z80* ctx) { ctx->BIT_R(0b101, 3); }
-    static inline void BIT_L_4(Z80* ctx) { ctx->BIT_R(0b101, 4); }
-    static inline void BIT_L_5(Z80* ctx) { ctx->BIT_R(0b101, 5); }
-    static inline void BIT_L_6(Z80* ctx) { ctx->BIT_R(0b101, 6); }
-    static inline void BIT_L_7(Z80* ctx) { ctx->BIT_R(0b101, 7); }
-    static inline void BIT_A_0(Z80* ctx) { ctx->BIT_R(0b111, 0); }
-    static inline void BIT_A_1(Z80* ctx) { ctx->BIT_R(0b111, 1); }
-    static inline void BIT_A_2(Z80* ctx) { ctx->BIT_R(0b111, 2); }
-    static inline void BIT_A_3(Z80* ctx) { ctx->BIT_R(0b111, 3); }
-    static inline void BIT_A_4(Z80* ctx) { ctx->BIT_R(0b111, 4); }
-    static inline void BIT_A_5(Z80* ctx) { ctx->BIT_R(0b111, 5); }
-    static inline void BIT_A_6(Z80* ctx) { ctx->BIT_R(0b111, 6); }
-    static inline void BIT_A_7(Z80* ctx) { ctx->BIT_R(0b111, 7); }
+    static inline void BIT_B_0(Z80Core* ctx) { ctx->BIT_R(0b000, 0); }
+    static inline void BIT_B_1(Z80Core* ctx) { ctx->BIT_R(0b000, 1); }
+    static inline void BIT_B_2(Z80Core* ctx) { ctx->BIT_R(0b000, 2); }
+    static inline void BIT_B_3(Z80Core* ctx) { ctx->BIT_R(0b000, 3); }
+    static inline void BIT_B_4(Z80Core* ctx) { ctx->BIT_R(0b000, 4); }
+    static inline void BIT_B_5(Z80Core* ctx) { ctx->BIT_R(0b000, 5); }
+    static inline void BIT_B_6(Z80Core* ctx) { ctx->BIT_R(0b000, 6); }
+    static inline void BIT_B_7(Z80Core* ctx) { ctx->BIT_R(0b000, 7); }
+    static inline void BIT_C_0(Z80Core* ctx) { ctx->BIT_R(0b001, 0); }
+    static inline void BIT_C_1(Z80Core* ctx) { ctx->BIT_R(0b001, 1); }
+    static inline void BIT_C_2(Z80Core* ctx) { ctx->BIT_R(0b001, 2); }
+    static inline void BIT_C_3(Z80Core* ctx) { ctx->BIT_R(0b001, 3); }
+    static inline void BIT_C_4(Z80Core* ctx) { ctx->BIT_R(0b001, 4); }
+    static inline void BIT_C_5(Z80Core* ctx) { ctx->BIT_R(0b001, 5); }
+    static inline void BIT_C_6(Z80Core* ctx) { ctx->BIT_R(0b001, 6); }
+    static inline void BIT_C_7(Z80Core* ctx) { ctx->BIT_R(0b001, 7); }
+    static inline void BIT_D_0(Z80Core* ctx) { ctx->BIT_R(0b010, 0); }
+    static inline void BIT_D_1(Z80Core* ctx) { ctx->BIT_R(0b010, 1); }
+    static inline void BIT_D_2(Z80Core* ctx) { ctx->BIT_R(0b010, 2); }
+    static inline void BIT_D_3(Z80Core* ctx) { ctx->BIT_R(0b010, 3); }
+    static inline void BIT_D_4(Z80Core* ctx) { ctx->BIT_R(0b010, 4); }
+    static inline void BIT_D_5(Z80Core* ctx) { ctx->BIT_R(0b010, 5); }
+    static inline void BIT_D_6(Z80Core* ctx) { ctx->BIT_R(0b010, 6); }
+    static inline void BIT_D_7(Z80Core* ctx) { ctx->BIT_R(0b010, 7); }
+    static inline void BIT_E_0(Z80Core* ctx) { ctx->BIT_R(0b011, 0); }
+    static inline void BIT_E_1(Z80Core* ctx) { ctx->BIT_R(0b011, 1); }
+    static inline void BIT_E_2(Z80Core* ctx) { ctx->BIT_R(0b011, 2); }
+    static inline void BIT_E_3(Z80Core* ctx) { ctx->BIT_R(0b011, 3); }
+    static inline void BIT_E_4(Z80Core* ctx) { ctx->BIT_R(0b011, 4); }
+    static inline void BIT_E_5(Z80Core* ctx) { ctx->BIT_R(0b011, 5); }
+    static inline void BIT_E_6(Z80Core* ctx) { ctx->BIT_R(0b011, 6); }
+    static inline void BIT_E_7(Z80Core* ctx) { ctx->BIT_R(0b011, 7); }
+    static inline void BIT_H_0(Z80Core* ctx) { ctx->BIT_R(0b100, 0); }
+    static inline void BIT_H_1(Z80Core* ctx) { ctx->BIT_R(0b100, 1); }
+    static inline void BIT_H_2(Z80Core* ctx) { ctx->BIT_R(0b100, 2); }
+    static inline void BIT_H_3(Z80Core* ctx) { ctx->BIT_R(0b100, 3); }
+    static inline void BIT_H_4(Z80Core* ctx) { ctx->BIT_R(0b100, 4); }
+    static inline void BIT_H_5(Z80Core* ctx) { ctx->BIT_R(0b100, 5); }
+    static inline void BIT_H_6(Z80Core* ctx) { ctx->BIT_R(0b100, 6); }
+    static inline void BIT_H_7(Z80Core* ctx) { ctx->BIT_R(0b100, 7); }
+    static inline void BIT_L_0(Z80Core* ctx) { ctx->BIT_R(0b101, 0); }
+    static inline void BIT_L_1(Z80Core* ctx) { ctx->BIT_R(0b101, 1); }
+    static inline void BIT_L_2(Z80Core* ctx) { ctx->BIT_R(0b101, 2); }
+    static inline void BIT_L_3(Z80Core* ctx) { ctx->BIT_R(0b101, 3); }
+    static inline void BIT_L_4(Z80Core* ctx) { ctx->BIT_R(0b101, 4); }
+    static inline void BIT_L_5(Z80Core* ctx) { ctx->BIT_R(0b101, 5); }
+    static inline void BIT_L_6(Z80Core* ctx) { ctx->BIT_R(0b101, 6); }
+    static inline void BIT_L_7(Z80Core* ctx) { ctx->BIT_R(0b101, 7); }
+    static inline void BIT_A_0(Z80Core* ctx) { ctx->BIT_R(0b111, 0); }
+    static inline void BIT_A_1(Z80Core* ctx) { ctx->BIT_R(0b111, 1); }
+    static inline void BIT_A_2(Z80Core* ctx) { ctx->BIT_R(0b111, 2); }
+    static inline void BIT_A_3(Z80Core* ctx) { ctx->BIT_R(0b111, 3); }
+    static inline void BIT_A_4(Z80Core* ctx) { ctx->BIT_R(0b111, 4); }
+    static inline void BIT_A_5(Z80Core* ctx) { ctx->BIT_R(0b111, 5); }
+    static inline void BIT_A_6(Z80Core* ctx) { ctx->BIT_R(0b111, 6); }
+    static inline void BIT_A_7(Z80Core* ctx) { ctx->BIT_R(0b111, 7); }
     inline void BIT_R(unsigned char r, unsigned char bit)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4375,14 +5512,14 @@ class Z80
     }
 
     // Test BIT b of location (HL)
-    static inline void BIT_HL_0(Z80* ctx) { ctx->BIT_HL(0); }
-    static inline void BIT_HL_1(Z80* ctx) { ctx->BIT_HL(1); }
-    static inline void BIT_HL_2(Z80* ctx) { ctx->BIT_HL(2); }
-    static inline void BIT_HL_3(Z80* ctx) { ctx->BIT_HL(3); }
-    static inline void BIT_HL_4(Z80* ctx) { ctx->BIT_HL(4); }
-    static inline void BIT_HL_5(Z80* ctx) { ctx->BIT_HL(5); }
-    static inline void BIT_HL_6(Z80* ctx) { ctx->BIT_HL(6); }
-    static inline void BIT_HL_7(Z80* ctx) { ctx->BIT_HL(7); }
+    static inline void BIT_HL_0(Z80Core* ctx) { ctx->BIT_HL(0); }
+    static inline void BIT_HL_1(Z80Core* ctx) { ctx->BIT_HL(1); }
+    static inline void BIT_HL_2(Z80Core* ctx) { ctx->BIT_HL(2); }
+    static inline void BIT_HL_3(Z80Core* ctx) { ctx->BIT_HL(3); }
+    static inline void BIT_HL_4(Z80Core* ctx) { ctx->BIT_HL(4); }
+    static inline void BIT_HL_5(Z80Core* ctx) { ctx->BIT_HL(5); }
+    static inline void BIT_HL_6(Z80Core* ctx) { ctx->BIT_HL(6); }
+    static inline void BIT_HL_7(Z80Core* ctx) { ctx->BIT_HL(7); }
     inline void BIT_HL(unsigned char bit)
     {
         unsigned char n = readByte(getHL());
@@ -4399,14 +5536,14 @@ class Z80
     }
 
     // Test BIT b of location (IX+d)
-    static inline void BIT_IX_0(Z80* ctx, signed char d) { ctx->BIT_IX(d, 0); }
-    static inline void BIT_IX_1(Z80* ctx, signed char d) { ctx->BIT_IX(d, 1); }
-    static inline void BIT_IX_2(Z80* ctx, signed char d) { ctx->BIT_IX(d, 2); }
-    static inline void BIT_IX_3(Z80* ctx, signed char d) { ctx->BIT_IX(d, 3); }
-    static inline void BIT_IX_4(Z80* ctx, signed char d) { ctx->BIT_IX(d, 4); }
-    static inline void BIT_IX_5(Z80* ctx, signed char d) { ctx->BIT_IX(d, 5); }
-    static inline void BIT_IX_6(Z80* ctx, signed char d) { ctx->BIT_IX(d, 6); }
-    static inline void BIT_IX_7(Z80* ctx, signed char d) { ctx->BIT_IX(d, 7); }
+    static inline void BIT_IX_0(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 0); }
+    static inline void BIT_IX_1(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 1); }
+    static inline void BIT_IX_2(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 2); }
+    static inline void BIT_IX_3(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 3); }
+    static inline void BIT_IX_4(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 4); }
+    static inline void BIT_IX_5(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 5); }
+    static inline void BIT_IX_6(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 6); }
+    static inline void BIT_IX_7(Z80Core* ctx, signed char d) { ctx->BIT_IX(d, 7); }
     inline void BIT_IX(signed char d, unsigned char bit)
     {
         unsigned char n = readByte((unsigned short)(reg.IX + d));
@@ -4423,14 +5560,14 @@ class Z80
     }
 
     // Test BIT b of location (IY+d)
-    static inline void BIT_IY_0(Z80* ctx, signed char d) { ctx->BIT_IY(d, 0); }
-    static inline void BIT_IY_1(Z80* ctx, signed char d) { ctx->BIT_IY(d, 1); }
-    static inline void BIT_IY_2(Z80* ctx, signed char d) { ctx->BIT_IY(d, 2); }
-    static inline void BIT_IY_3(Z80* ctx, signed char d) { ctx->BIT_IY(d, 3); }
-    static inline void BIT_IY_4(Z80* ctx, signed char d) { ctx->BIT_IY(d, 4); }
-    static inline void BIT_IY_5(Z80* ctx, signed char d) { ctx->BIT_IY(d, 5); }
-    static inline void BIT_IY_6(Z80* ctx, signed char d) { ctx->BIT_IY(d, 6); }
-    static inline void BIT_IY_7(Z80* ctx, signed char d) { ctx->BIT_IY(d, 7); }
+    static inline void BIT_IY_0(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 0); }
+    static inline void BIT_IY_1(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 1); }
+    static inline void BIT_IY_2(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 2); }
+    static inline void BIT_IY_3(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 3); }
+    static inline void BIT_IY_4(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 4); }
+    static inline void BIT_IY_5(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 5); }
+    static inline void BIT_IY_6(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 6); }
+    static inline void BIT_IY_7(Z80Core* ctx, signed char d) { ctx->BIT_IY(d, 7); }
     inline void BIT_IY(signed char d, unsigned char bit)
     {
         unsigned char n = readByte((unsigned short)(reg.IY + d));
@@ -4447,62 +5584,62 @@ class Z80
     }
 
     // SET bit b of register r
-    static inline void SET_B_0(Z80* ctx) { ctx->SET_R(0b000, 0); }
-    static inline void SET_B_1(Z80* ctx) { ctx->SET_R(0b000, 1); }
-    static inline void SET_B_2(Z80* ctx) { ctx->SET_R(0b000, 2); }
-    static inline void SET_B_3(Z80* ctx) { ctx->SET_R(0b000, 3); }
-    static inline void SET_B_4(Z80* ctx) { ctx->SET_R(0b000, 4); }
-    static inline void SET_B_5(Z80* ctx) { ctx->SET_R(0b000, 5); }
-    static inline void SET_B_6(Z80* ctx) { ctx->SET_R(0b000, 6); }
-    static inline void SET_B_7(Z80* ctx) { ctx->SET_R(0b000, 7); }
-    static inline void SET_C_0(Z80* ctx) { ctx->SET_R(0b001, 0); }
-    static inline void SET_C_1(Z80* ctx) { ctx->SET_R(0b001, 1); }
-    static inline void SET_C_2(Z80* ctx) { ctx->SET_R(0b001, 2); }
-    static inline void SET_C_3(Z80* ctx) { ctx->SET_R(0b001, 3); }
-    static inline void SET_C_4(Z80* ctx) { ctx->SET_R(0b001, 4); }
-    static inline void SET_C_5(Z80* ctx) { ctx->SET_R(0b001, 5); }
-    static inline void SET_C_6(Z80* ctx) { ctx->SET_R(0b001, 6); }
-    static inline void SET_C_7(Z80* ctx) { ctx->SET_R(0b001, 7); }
-    static inline void SET_D_0(Z80* ctx) { ctx->SET_R(0b010, 0); }
-    static inline void SET_D_1(Z80* ctx) { ctx->SET_R(0b010, 1); }
-    static inline void SET_D_2(Z80* ctx) { ctx->SET_R(0b010, 2); }
-    static inline void SET_D_3(Z80* ctx) { ctx->SET_R(0b010, 3); }
-    static inline void SET_D_4(Z80* ctx) { ctx->SET_R(0b010, 4); }
-    static inline void SET_D_5(Z80* ctx) { ctx->SET_R(0b010, 5); }
-    static inline void SET_D_6(Z80* ctx) { ctx->SET_R(0b010, 6); }
-    static inline void SET_D_7(Z80* ctx) { ctx->SET_R(0b010, 7); }
-    static inline void SET_E_0(Z80* ctx) { ctx->SET_R(0b011, 0); }
-    static inline void SET_E_1(Z80* ctx) { ctx->SET_R(0b011, 1); }
-    static inline void SET_E_2(Z80* ctx) { ctx->SET_R(0b011, 2); }
-    static inline void SET_E_3(Z80* ctx) { ctx->SET_R(0b011, 3); }
-    static inline void SET_E_4(Z80* ctx) { ctx->SET_R(0b011, 4); }
-    static inline void SET_E_5(Z80* ctx) { ctx->SET_R(0b011, 5); }
-    static inline void SET_E_6(Z80* ctx) { ctx->SET_R(0b011, 6); }
-    static inline void SET_E_7(Z80* ctx) { ctx->SET_R(0b011, 7); }
-    static inline void SET_H_0(Z80* ctx) { ctx->SET_R(0b100, 0); }
-    static inline void SET_H_1(Z80* ctx) { ctx->SET_R(0b100, 1); }
-    static inline void SET_H_2(Z80* ctx) { ctx->SET_R(0b100, 2); }
-    static inline void SET_H_3(Z80* ctx) { ctx->SET_R(0b100, 3); }
-    static inline void SET_H_4(Z80* ctx) { ctx->SET_R(0b100, 4); }
-    static inline void SET_H_5(Z80* ctx) { ctx->SET_R(0b100, 5); }
-    static inline void SET_H_6(Z80* ctx) { ctx->SET_R(0b100, 6); }
-    static inline void SET_H_7(Z80* ctx) { ctx->SET_R(0b100, 7); }
-    static inline void SET_L_0(Z80* ctx) { ctx->SET_R(0b101, 0); }
-    static inline void SET_L_1(Z80* ctx) { ctx->SET_R(0b101, 1); }
-    static inline void SET_L_2(Z80* ctx) { ctx->SET_R(0b101, 2); }
-    static inline void SET_L_3(Z80* ctx) { ctx->SET_R(0b101, 3); }
-    static inline void SET_L_4(Z80* ctx) { ctx->SET_R(0b101, 4); }
-    static inline void SET_L_5(Z80* ctx) { ctx->SET_R(0b101, 5); }
-    static inline void SET_L_6(Z80* ctx) { ctx->SET_R(0b101, 6); }
-    static inline void SET_L_7(Z80* ctx) { ctx->SET_R(0b101, 7); }
-    static inline void SET_A_0(Z80* ctx) { ctx->SET_R(0b111, 0); }
-    static inline void SET_A_1(Z80* ctx) { ctx->SET_R(0b111, 1); }
-    static inline void SET_A_2(Z80* ctx) { ctx->SET_R(0b111, 2); }
-    static inline void SET_A_3(Z80* ctx) { ctx->SET_R(0b111, 3); }
-    static inline void SET_A_4(Z80* ctx) { ctx->SET_R(0b111, 4); }
-    static inline void SET_A_5(Z80* ctx) { ctx->SET_R(0b111, 5); }
-    static inline void SET_A_6(Z80* ctx) { ctx->SET_R(0b111, 6); }
-    static inline void SET_A_7(Z80* ctx) { ctx->SET_R(0b111, 7); }
+    static inline void SET_B_0(Z80Core* ctx) { ctx->SET_R(0b000, 0); }
+    static inline void SET_B_1(Z80Core* ctx) { ctx->SET_R(0b000, 1); }
+    static inline void SET_B_2(Z80Core* ctx) { ctx->SET_R(0b000, 2); }
+    static inline void SET_B_3(Z80Core* ctx) { ctx->SET_R(0b000, 3); }
+    static inline void SET_B_4(Z80Core* ctx) { ctx->SET_R(0b000, 4); }
+    static inline void SET_B_5(Z80Core* ctx) { ctx->SET_R(0b000, 5); }
+    static inline void SET_B_6(Z80Core* ctx) { ctx->SET_R(0b000, 6); }
+    static inline void SET_B_7(Z80Core* ctx) { ctx->SET_R(0b000, 7); }
+    static inline void SET_C_0(Z80Core* ctx) { ctx->SET_R(0b001, 0); }
+    static inline void SET_C_1(Z80Core* ctx) { ctx->SET_R(0b001, 1); }
+    static inline void SET_C_2(Z80Core* ctx) { ctx->SET_R(0b001, 2); }
+    static inline void SET_C_3(Z80Core* ctx) { ctx->SET_R(0b001, 3); }
+    static inline void SET_C_4(Z80Core* ctx) { ctx->SET_R(0b001, 4); }
+    static inline void SET_C_5(Z80Core* ctx) { ctx->SET_R(0b001, 5); }
+    static inline void SET_C_6(Z80Core* ctx) { ctx->SET_R(0b001, 6); }
+    static inline void SET_C_7(Z80Core* ctx) { ctx->SET_R(0b001, 7); }
+    static inline void SET_D_0(Z80Core* ctx) { ctx->SET_R(0b010, 0); }
+    static inline void SET_D_1(Z80Core* ctx) { ctx->SET_R(0b010, 1); }
+    static inline void SET_D_2(Z80Core* ctx) { ctx->SET_R(0b010, 2); }
+    static inline void SET_D_3(Z80Core* ctx) { ctx->SET_R(0b010, 3); }
+    static inline void SET_D_4(Z80Core* ctx) { ctx->SET_R(0b010, 4); }
+    static inline void SET_D_5(Z80Core* ctx) { ctx->SET_R(0b010, 5); }
+    static inline void SET_D_6(Z80Core* ctx) { ctx->SET_R(0b010, 6); }
+    static inline void SET_D_7(Z80Core* ctx) { ctx->SET_R(0b010, 7); }
+    static inline void SET_E_0(Z80Core* ctx) { ctx->SET_R(0b011, 0); }
+    static inline void SET_E_1(Z80Core* ctx) { ctx->SET_R(0b011, 1); }
+    static inline void SET_E_2(Z80Core* ctx) { ctx->SET_R(0b011, 2); }
+    static inline void SET_E_3(Z80Core* ctx) { ctx->SET_R(0b011, 3); }
+    static inline void SET_E_4(Z80Core* ctx) { ctx->SET_R(0b011, 4); }
+    static inline void SET_E_5(Z80Core* ctx) { ctx->SET_R(0b011, 5); }
+    static inline void SET_E_6(Z80Core* ctx) { ctx->SET_R(0b011, 6); }
+    static inline void SET_E_7(Z80Core* ctx) { ctx->SET_R(0b011, 7); }
+    static inline void SET_H_0(Z80Core* ctx) { ctx->SET_R(0b100, 0); }
+    static inline void SET_H_1(Z80Core* ctx) { ctx->SET_R(0b100, 1); }
+    static inline void SET_H_2(Z80Core* ctx) { ctx->SET_R(0b100, 2); }
+    static inline void SET_H_3(Z80Core* ctx) { ctx->SET_R(0b100, 3); }
+    static inline void SET_H_4(Z80Core* ctx) { ctx->SET_R(0b100, 4); }
+    static inline void SET_H_5(Z80Core* ctx) { ctx->SET_R(0b100, 5); }
+    static inline void SET_H_6(Z80Core* ctx) { ctx->SET_R(0b100, 6); }
+    static inline void SET_H_7(Z80Core* ctx) { ctx->SET_R(0b100, 7); }
+    static inline void SET_L_0(Z80Core* ctx) { ctx->SET_R(0b101, 0); }
+    static inline void SET_L_1(Z80Core* ctx) { ctx->SET_R(0b101, 1); }
+    static inline void SET_L_2(Z80Core* ctx) { ctx->SET_R(0b101, 2); }
+    static inline void SET_L_3(Z80Core* ctx) { ctx->SET_R(0b101, 3); }
+    static inline void SET_L_4(Z80Core* ctx) { ctx->SET_R(0b101, 4); }
+    static inline void SET_L_5(Z80Core* ctx) { ctx->SET_R(0b101, 5); }
+    static inline void SET_L_6(Z80Core* ctx) { ctx->SET_R(0b101, 6); }
+    static inline void SET_L_7(Z80Core* ctx) { ctx->SET_R(0b101, 7); }
+    static inline void SET_A_0(Z80Core* ctx) { ctx->SET_R(0b111, 0); }
+    static inline void SET_A_1(Z80Core* ctx) { ctx->SET_R(0b111, 1); }
+    static inline void SET_A_2(Z80Core* ctx) { ctx->SET_R(0b111, 2); }
+    static inline void SET_A_3(Z80Core* ctx) { ctx->SET_R(0b111, 3); }
+    static inline void SET_A_4(Z80Core* ctx) { ctx->SET_R(0b111, 4); }
+    static inline void SET_A_5(Z80Core* ctx) { ctx->SET_R(0b111, 5); }
+    static inline void SET_A_6(Z80Core* ctx) { ctx->SET_R(0b111, 6); }
+    static inline void SET_A_7(Z80Core* ctx) { ctx->SET_R(0b111, 7); }
     inline void SET_R(unsigned char r, unsigned char bit)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4513,14 +5650,14 @@ class Z80
     }
 
     // SET bit b of location (HL)
-    static inline void SET_HL_0(Z80* ctx) { ctx->SET_HL(0); }
-    static inline void SET_HL_1(Z80* ctx) { ctx->SET_HL(1); }
-    static inline void SET_HL_2(Z80* ctx) { ctx->SET_HL(2); }
-    static inline void SET_HL_3(Z80* ctx) { ctx->SET_HL(3); }
-    static inline void SET_HL_4(Z80* ctx) { ctx->SET_HL(4); }
-    static inline void SET_HL_5(Z80* ctx) { ctx->SET_HL(5); }
-    static inline void SET_HL_6(Z80* ctx) { ctx->SET_HL(6); }
-    static inline void SET_HL_7(Z80* ctx) { ctx->SET_HL(7); }
+    static inline void SET_HL_0(Z80Core* ctx) { ctx->SET_HL(0); }
+    static inline void SET_HL_1(Z80Core* ctx) { ctx->SET_HL(1); }
+    static inline void SET_HL_2(Z80Core* ctx) { ctx->SET_HL(2); }
+    static inline void SET_HL_3(Z80Core* ctx) { ctx->SET_HL(3); }
+    static inline void SET_HL_4(Z80Core* ctx) { ctx->SET_HL(4); }
+    static inline void SET_HL_5(Z80Core* ctx) { ctx->SET_HL(5); }
+    static inline void SET_HL_6(Z80Core* ctx) { ctx->SET_HL(6); }
+    static inline void SET_HL_7(Z80Core* ctx) { ctx->SET_HL(7); }
     inline void SET_HL(unsigned char bit)
     {
         unsigned short addr = getHL();
@@ -4533,14 +5670,14 @@ class Z80
     }
 
     // SET bit b of location (IX+d)
-    static inline void SET_IX_0(Z80* ctx, signed char d) { ctx->SET_IX(d, 0); }
-    static inline void SET_IX_1(Z80* ctx, signed char d) { ctx->SET_IX(d, 1); }
-    static inline void SET_IX_2(Z80* ctx, signed char d) { ctx->SET_IX(d, 2); }
-    static inline void SET_IX_3(Z80* ctx, signed char d) { ctx->SET_IX(d, 3); }
-    static inline void SET_IX_4(Z80* ctx, signed char d) { ctx->SET_IX(d, 4); }
-    static inline void SET_IX_5(Z80* ctx, signed char d) { ctx->SET_IX(d, 5); }
-    static inline void SET_IX_6(Z80* ctx, signed char d) { ctx->SET_IX(d, 6); }
-    static inline void SET_IX_7(Z80* ctx, signed char d) { ctx->SET_IX(d, 7); }
+    static inline void SET_IX_0(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 0); }
+    static inline void SET_IX_1(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 1); }
+    static inline void SET_IX_2(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 2); }
+    static inline void SET_IX_3(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 3); }
+    static inline void SET_IX_4(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 4); }
+    static inline void SET_IX_5(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 5); }
+    static inline void SET_IX_6(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 6); }
+    static inline void SET_IX_7(Z80Core* ctx, signed char d) { ctx->SET_IX(d, 7); }
     inline void SET_IX(signed char d, unsigned char bit, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -4554,62 +5691,62 @@ class Z80
     }
 
     // SET bit b of location (IX+d) with load Reg.
-    static inline void SET_IX_0_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b000); }
-    static inline void SET_IX_1_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b000); }
-    static inline void SET_IX_2_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b000); }
-    static inline void SET_IX_3_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b000); }
-    static inline void SET_IX_4_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b000); }
-    static inline void SET_IX_5_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b000); }
-    static inline void SET_IX_6_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b000); }
-    static inline void SET_IX_7_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b000); }
-    static inline void SET_IX_0_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b001); }
-    static inline void SET_IX_1_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b001); }
-    static inline void SET_IX_2_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b001); }
-    static inline void SET_IX_3_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b001); }
-    static inline void SET_IX_4_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b001); }
-    static inline void SET_IX_5_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b001); }
-    static inline void SET_IX_6_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b001); }
-    static inline void SET_IX_7_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b001); }
-    static inline void SET_IX_0_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b010); }
-    static inline void SET_IX_1_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b010); }
-    static inline void SET_IX_2_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b010); }
-    static inline void SET_IX_3_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b010); }
-    static inline void SET_IX_4_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b010); }
-    static inline void SET_IX_5_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b010); }
-    static inline void SET_IX_6_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b010); }
-    static inline void SET_IX_7_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b010); }
-    static inline void SET_IX_0_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b011); }
-    static inline void SET_IX_1_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b011); }
-    static inline void SET_IX_2_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b011); }
-    static inline void SET_IX_3_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b011); }
-    static inline void SET_IX_4_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b011); }
-    static inline void SET_IX_5_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b011); }
-    static inline void SET_IX_6_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b011); }
-    static inline void SET_IX_7_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b011); }
-    static inline void SET_IX_0_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b100); }
-    static inline void SET_IX_1_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b100); }
-    static inline void SET_IX_2_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b100); }
-    static inline void SET_IX_3_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b100); }
-    static inline void SET_IX_4_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b100); }
-    static inline void SET_IX_5_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b100); }
-    static inline void SET_IX_6_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b100); }
-    static inline void SET_IX_7_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b100); }
-    static inline void SET_IX_0_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b101); }
-    static inline void SET_IX_1_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b101); }
-    static inline void SET_IX_2_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b101); }
-    static inline void SET_IX_3_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b101); }
-    static inline void SET_IX_4_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b101); }
-    static inline void SET_IX_5_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b101); }
-    static inline void SET_IX_6_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b101); }
-    static inline void SET_IX_7_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b101); }
-    static inline void SET_IX_0_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b111); }
-    static inline void SET_IX_1_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b111); }
-    static inline void SET_IX_2_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b111); }
-    static inline void SET_IX_3_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b111); }
-    static inline void SET_IX_4_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b111); }
-    static inline void SET_IX_5_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b111); }
-    static inline void SET_IX_6_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b111); }
-    static inline void SET_IX_7_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b111); }
+    static inline void SET_IX_0_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b000); }
+    static inline void SET_IX_1_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b000); }
+    static inline void SET_IX_2_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b000); }
+    static inline void SET_IX_3_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b000); }
+    static inline void SET_IX_4_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b000); }
+    static inline void SET_IX_5_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b000); }
+    static inline void SET_IX_6_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b000); }
+    static inline void SET_IX_7_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b000); }
+    static inline void SET_IX_0_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b001); }
+    static inline void SET_IX_1_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b001); }
+    static inline void SET_IX_2_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b001); }
+    static inline void SET_IX_3_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b001); }
+    static inline void SET_IX_4_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b001); }
+    static inline void SET_IX_5_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b001); }
+    static inline void SET_IX_6_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b001); }
+    static inline void SET_IX_7_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b001); }
+    static inline void SET_IX_0_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b010); }
+    static inline void SET_IX_1_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b010); }
+    static inline void SET_IX_2_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b010); }
+    static inline void SET_IX_3_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b010); }
+    static inline void SET_IX_4_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b010); }
+    static inline void SET_IX_5_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b010); }
+    static inline void SET_IX_6_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b010); }
+    static inline void SET_IX_7_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b010); }
+    static inline void SET_IX_0_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b011); }
+    static inline void SET_IX_1_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b011); }
+    static inline void SET_IX_2_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b011); }
+    static inline void SET_IX_3_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b011); }
+    static inline void SET_IX_4_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b011); }
+    static inline void SET_IX_5_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b011); }
+    static inline void SET_IX_6_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b011); }
+    static inline void SET_IX_7_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b011); }
+    static inline void SET_IX_0_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b100); }
+    static inline void SET_IX_1_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b100); }
+    static inline void SET_IX_2_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b100); }
+    static inline void SET_IX_3_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b100); }
+    static inline void SET_IX_4_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b100); }
+    static inline void SET_IX_5_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b100); }
+    static inline void SET_IX_6_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b100); }
+    static inline void SET_IX_7_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b100); }
+    static inline void SET_IX_0_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b101); }
+    static inline void SET_IX_1_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b101); }
+    static inline void SET_IX_2_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b101); }
+    static inline void SET_IX_3_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b101); }
+    static inline void SET_IX_4_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b101); }
+    static inline void SET_IX_5_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b101); }
+    static inline void SET_IX_6_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b101); }
+    static inline void SET_IX_7_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b101); }
+    static inline void SET_IX_0_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 0, 0b111); }
+    static inline void SET_IX_1_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 1, 0b111); }
+    static inline void SET_IX_2_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 2, 0b111); }
+    static inline void SET_IX_3_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 3, 0b111); }
+    static inline void SET_IX_4_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 4, 0b111); }
+    static inline void SET_IX_5_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 5, 0b111); }
+    static inline void SET_IX_6_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 6, 0b111); }
+    static inline void SET_IX_7_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IX_with_LD(d, 7, 0b111); }
     inline void SET_IX_with_LD(signed char d, unsigned char bit, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4627,14 +5764,14 @@ class Z80
     }
 
     // SET bit b of location (IY+d)
-    static inline void SET_IY_0(Z80* ctx, signed char d) { ctx->SET_IY(d, 0); }
-    static inline void SET_IY_1(Z80* ctx, signed char d) { ctx->SET_IY(d, 1); }
-    static inline void SET_IY_2(Z80* ctx, signed char d) { ctx->SET_IY(d, 2); }
-    static inline void SET_IY_3(Z80* ctx, signed char d) { ctx->SET_IY(d, 3); }
-    static inline void SET_IY_4(Z80* ctx, signed char d) { ctx->SET_IY(d, 4); }
-    static inline void SET_IY_5(Z80* ctx, signed char d) { ctx->SET_IY(d, 5); }
-    static inline void SET_IY_6(Z80* ctx, signed char d) { ctx->SET_IY(d, 6); }
-    static inline void SET_IY_7(Z80* ctx, signed char d) { ctx->SET_IY(d, 7); }
+    static inline void SET_IY_0(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 0); }
+    static inline void SET_IY_1(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 1); }
+    static inline void SET_IY_2(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 2); }
+    static inline void SET_IY_3(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 3); }
+    static inline void SET_IY_4(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 4); }
+    static inline void SET_IY_5(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 5); }
+    static inline void SET_IY_6(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 6); }
+    static inline void SET_IY_7(Z80Core* ctx, signed char d) { ctx->SET_IY(d, 7); }
     inline void SET_IY(signed char d, unsigned char bit, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -4648,62 +5785,62 @@ class Z80
     }
 
     // SET bit b of location (IY+d) with load Reg.
-    static inline void SET_IY_0_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b000); }
-    static inline void SET_IY_1_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b000); }
-    static inline void SET_IY_2_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b000); }
-    static inline void SET_IY_3_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b000); }
-    static inline void SET_IY_4_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b000); }
-    static inline void SET_IY_5_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b000); }
-    static inline void SET_IY_6_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b000); }
-    static inline void SET_IY_7_with_LD_B(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b000); }
-    static inline void SET_IY_0_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b001); }
-    static inline void SET_IY_1_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b001); }
-    static inline void SET_IY_2_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b001); }
-    static inline void SET_IY_3_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b001); }
-    static inline void SET_IY_4_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b001); }
-    static inline void SET_IY_5_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b001); }
-    static inline void SET_IY_6_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b001); }
-    static inline void SET_IY_7_with_LD_C(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b001); }
-    static inline void SET_IY_0_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b010); }
-    static inline void SET_IY_1_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b010); }
-    static inline void SET_IY_2_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b010); }
-    static inline void SET_IY_3_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b010); }
-    static inline void SET_IY_4_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b010); }
-    static inline void SET_IY_5_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b010); }
-    static inline void SET_IY_6_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b010); }
-    static inline void SET_IY_7_with_LD_D(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b010); }
-    static inline void SET_IY_0_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b011); }
-    static inline void SET_IY_1_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b011); }
-    static inline void SET_IY_2_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b011); }
-    static inline void SET_IY_3_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b011); }
-    static inline void SET_IY_4_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b011); }
-    static inline void SET_IY_5_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b011); }
-    static inline void SET_IY_6_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b011); }
-    static inline void SET_IY_7_with_LD_E(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b011); }
-    static inline void SET_IY_0_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b100); }
-    static inline void SET_IY_1_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b100); }
-    static inline void SET_IY_2_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b100); }
-    static inline void SET_IY_3_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b100); }
-    static inline void SET_IY_4_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b100); }
-    static inline void SET_IY_5_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b100); }
-    static inline void SET_IY_6_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b100); }
-    static inline void SET_IY_7_with_LD_H(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b100); }
-    static inline void SET_IY_0_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b101); }
-    static inline void SET_IY_1_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b101); }
-    static inline void SET_IY_2_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b101); }
-    static inline void SET_IY_3_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b101); }
-    static inline void SET_IY_4_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b101); }
-    static inline void SET_IY_5_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b101); }
-    static inline void SET_IY_6_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b101); }
-    static inline void SET_IY_7_with_LD_L(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b101); }
-    static inline void SET_IY_0_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b111); }
-    static inline void SET_IY_1_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b111); }
-    static inline void SET_IY_2_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b111); }
-    static inline void SET_IY_3_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b111); }
-    static inline void SET_IY_4_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b111); }
-    static inline void SET_IY_5_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b111); }
-    static inline void SET_IY_6_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b111); }
-    static inline void SET_IY_7_with_LD_A(Z80* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b111); }
+    static inline void SET_IY_0_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b000); }
+    static inline void SET_IY_1_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b000); }
+    static inline void SET_IY_2_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b000); }
+    static inline void SET_IY_3_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b000); }
+    static inline void SET_IY_4_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b000); }
+    static inline void SET_IY_5_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b000); }
+    static inline void SET_IY_6_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b000); }
+    static inline void SET_IY_7_with_LD_B(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b000); }
+    static inline void SET_IY_0_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b001); }
+    static inline void SET_IY_1_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b001); }
+    static inline void SET_IY_2_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b001); }
+    static inline void SET_IY_3_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b001); }
+    static inline void SET_IY_4_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b001); }
+    static inline void SET_IY_5_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b001); }
+    static inline void SET_IY_6_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b001); }
+    static inline void SET_IY_7_with_LD_C(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b001); }
+    static inline void SET_IY_0_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b010); }
+    static inline void SET_IY_1_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b010); }
+    static inline void SET_IY_2_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b010); }
+    static inline void SET_IY_3_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b010); }
+    static inline void SET_IY_4_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b010); }
+    static inline void SET_IY_5_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b010); }
+    static inline void SET_IY_6_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b010); }
+    static inline void SET_IY_7_with_LD_D(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b010); }
+    static inline void SET_IY_0_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b011); }
+    static inline void SET_IY_1_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b011); }
+    static inline void SET_IY_2_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b011); }
+    static inline void SET_IY_3_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b011); }
+    static inline void SET_IY_4_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b011); }
+    static inline void SET_IY_5_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b011); }
+    static inline void SET_IY_6_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b011); }
+    static inline void SET_IY_7_with_LD_E(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b011); }
+    static inline void SET_IY_0_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b100); }
+    static inline void SET_IY_1_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b100); }
+    static inline void SET_IY_2_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b100); }
+    static inline void SET_IY_3_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b100); }
+    static inline void SET_IY_4_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b100); }
+    static inline void SET_IY_5_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b100); }
+    static inline void SET_IY_6_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b100); }
+    static inline void SET_IY_7_with_LD_H(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b100); }
+    static inline void SET_IY_0_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b101); }
+    static inline void SET_IY_1_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b101); }
+    static inline void SET_IY_2_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b101); }
+    static inline void SET_IY_3_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b101); }
+    static inline void SET_IY_4_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b101); }
+    static inline void SET_IY_5_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b101); }
+    static inline void SET_IY_6_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b101); }
+    static inline void SET_IY_7_with_LD_L(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b101); }
+    static inline void SET_IY_0_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 0, 0b111); }
+    static inline void SET_IY_1_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 1, 0b111); }
+    static inline void SET_IY_2_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 2, 0b111); }
+    static inline void SET_IY_3_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 3, 0b111); }
+    static inline void SET_IY_4_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 4, 0b111); }
+    static inline void SET_IY_5_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 5, 0b111); }
+    static inline void SET_IY_6_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 6, 0b111); }
+    static inline void SET_IY_7_with_LD_A(Z80Core* ctx, signed char d) { ctx->SET_IY_with_LD(d, 7, 0b111); }
     inline void SET_IY_with_LD(signed char d, unsigned char bit, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4721,62 +5858,62 @@ class Z80
     }
 
     // RESET bit b of register r
-    static inline void RES_B_0(Z80* ctx) { ctx->RES_R(0b000, 0); }
-    static inline void RES_B_1(Z80* ctx) { ctx->RES_R(0b000, 1); }
-    static inline void RES_B_2(Z80* ctx) { ctx->RES_R(0b000, 2); }
-    static inline void RES_B_3(Z80* ctx) { ctx->RES_R(0b000, 3); }
-    static inline void RES_B_4(Z80* ctx) { ctx->RES_R(0b000, 4); }
-    static inline void RES_B_5(Z80* ctx) { ctx->RES_R(0b000, 5); }
-    static inline void RES_B_6(Z80* ctx) { ctx->RES_R(0b000, 6); }
-    static inline void RES_B_7(Z80* ctx) { ctx->RES_R(0b000, 7); }
-    static inline void RES_C_0(Z80* ctx) { ctx->RES_R(0b001, 0); }
-    static inline void RES_C_1(Z80* ctx) { ctx->RES_R(0b001, 1); }
-    static inline void RES_C_2(Z80* ctx) { ctx->RES_R(0b001, 2); }
-    static inline void RES_C_3(Z80* ctx) { ctx->RES_R(0b001, 3); }
-    static inline void RES_C_4(Z80* ctx) { ctx->RES_R(0b001, 4); }
-    static inline void RES_C_5(Z80* ctx) { ctx->RES_R(0b001, 5); }
-    static inline void RES_C_6(Z80* ctx) { ctx->RES_R(0b001, 6); }
-    static inline void RES_C_7(Z80* ctx) { ctx->RES_R(0b001, 7); }
-    static inline void RES_D_0(Z80* ctx) { ctx->RES_R(0b010, 0); }
-    static inline void RES_D_1(Z80* ctx) { ctx->RES_R(0b010, 1); }
-    static inline void RES_D_2(Z80* ctx) { ctx->RES_R(0b010, 2); }
-    static inline void RES_D_3(Z80* ctx) { ctx->RES_R(0b010, 3); }
-    static inline void RES_D_4(Z80* ctx) { ctx->RES_R(0b010, 4); }
-    static inline void RES_D_5(Z80* ctx) { ctx->RES_R(0b010, 5); }
-    static inline void RES_D_6(Z80* ctx) { ctx->RES_R(0b010, 6); }
-    static inline void RES_D_7(Z80* ctx) { ctx->RES_R(0b010, 7); }
-    static inline void RES_E_0(Z80* ctx) { ctx->RES_R(0b011, 0); }
-    static inline void RES_E_1(Z80* ctx) { ctx->RES_R(0b011, 1); }
-    static inline void RES_E_2(Z80* ctx) { ctx->RES_R(0b011, 2); }
-    static inline void RES_E_3(Z80* ctx) { ctx->RES_R(0b011, 3); }
-    static inline void RES_E_4(Z80* ctx) { ctx->RES_R(0b011, 4); }
-    static inline void RES_E_5(Z80* ctx) { ctx->RES_R(0b011, 5); }
-    static inline void RES_E_6(Z80* ctx) { ctx->RES_R(0b011, 6); }
-    static inline void RES_E_7(Z80* ctx) { ctx->RES_R(0b011, 7); }
-    static inline void RES_H_0(Z80* ctx) { ctx->RES_R(0b100, 0); }
-    static inline void RES_H_1(Z80* ctx) { ctx->RES_R(0b100, 1); }
-    static inline void RES_H_2(Z80* ctx) { ctx->RES_R(0b100, 2); }
-    static inline void RES_H_3(Z80* ctx) { ctx->RES_R(0b100, 3); }
-    static inline void RES_H_4(Z80* ctx) { ctx->RES_R(0b100, 4); }
-    static inline void RES_H_5(Z80* ctx) { ctx->RES_R(0b100, 5); }
-    static inline void RES_H_6(Z80* ctx) { ctx->RES_R(0b100, 6); }
-    static inline void RES_H_7(Z80* ctx) { ctx->RES_R(0b100, 7); }
-    static inline void RES_L_0(Z80* ctx) { ctx->RES_R(0b101, 0); }
-    static inline void RES_L_1(Z80* ctx) { ctx->RES_R(0b101, 1); }
-    static inline void RES_L_2(Z80* ctx) { ctx->RES_R(0b101, 2); }
-    static inline void RES_L_3(Z80* ctx) { ctx->RES_R(0b101, 3); }
-    static inline void RES_L_4(Z80* ctx) { ctx->RES_R(0b101, 4); }
-    static inline void RES_L_5(Z80* ctx) { ctx->RES_R(0b101, 5); }
-    static inline void RES_L_6(Z80* ctx) { ctx->RES_R(0b101, 6); }
-    static inline void RES_L_7(Z80* ctx) { ctx->RES_R(0b101, 7); }
-    static inline void RES_A_0(Z80* ctx) { ctx->RES_R(0b111, 0); }
-    static inline void RES_A_1(Z80* ctx) { ctx->RES_R(0b111, 1); }
-    static inline void RES_A_2(Z80* ctx) { ctx->RES_R(0b111, 2); }
-    static inline void RES_A_3(Z80* ctx) { ctx->RES_R(0b111, 3); }
-    static inline void RES_A_4(Z80* ctx) { ctx->RES_R(0b111, 4); }
-    static inline void RES_A_5(Z80* ctx) { ctx->RES_R(0b111, 5); }
-    static inline void RES_A_6(Z80* ctx) { ctx->RES_R(0b111, 6); }
-    static inline void RES_A_7(Z80* ctx) { ctx->RES_R(0b111, 7); }
+    static inline void RES_B_0(Z80Core* ctx) { ctx->RES_R(0b000, 0); }
+    static inline void RES_B_1(Z80Core* ctx) { ctx->RES_R(0b000, 1); }
+    static inline void RES_B_2(Z80Core* ctx) { ctx->RES_R(0b000, 2); }
+    static inline void RES_B_3(Z80Core* ctx) { ctx->RES_R(0b000, 3); }
+    static inline void RES_B_4(Z80Core* ctx) { ctx->RES_R(0b000, 4); }
+    static inline void RES_B_5(Z80Core* ctx) { ctx->RES_R(0b000, 5); }
+    static inline void RES_B_6(Z80Core* ctx) { ctx->RES_R(0b000, 6); }
+    static inline void RES_B_7(Z80Core* ctx) { ctx->RES_R(0b000, 7); }
+    static inline void RES_C_0(Z80Core* ctx) { ctx->RES_R(0b001, 0); }
+    static inline void RES_C_1(Z80Core* ctx) { ctx->RES_R(0b001, 1); }
+    static inline void RES_C_2(Z80Core* ctx) { ctx->RES_R(0b001, 2); }
+    static inline void RES_C_3(Z80Core* ctx) { ctx->RES_R(0b001, 3); }
+    static inline void RES_C_4(Z80Core* ctx) { ctx->RES_R(0b001, 4); }
+    static inline void RES_C_5(Z80Core* ctx) { ctx->RES_R(0b001, 5); }
+    static inline void RES_C_6(Z80Core* ctx) { ctx->RES_R(0b001, 6); }
+    static inline void RES_C_7(Z80Core* ctx) { ctx->RES_R(0b001, 7); }
+    static inline void RES_D_0(Z80Core* ctx) { ctx->RES_R(0b010, 0); }
+    static inline void RES_D_1(Z80Core* ctx) { ctx->RES_R(0b010, 1); }
+    static inline void RES_D_2(Z80Core* ctx) { ctx->RES_R(0b010, 2); }
+    static inline void RES_D_3(Z80Core* ctx) { ctx->RES_R(0b010, 3); }
+    static inline void RES_D_4(Z80Core* ctx) { ctx->RES_R(0b010, 4); }
+    static inline void RES_D_5(Z80Core* ctx) { ctx->RES_R(0b010, 5); }
+    static inline void RES_D_6(Z80Core* ctx) { ctx->RES_R(0b010, 6); }
+    static inline void RES_D_7(Z80Core* ctx) { ctx->RES_R(0b010, 7); }
+    static inline void RES_E_0(Z80Core* ctx) { ctx->RES_R(0b011, 0); }
+    static inline void RES_E_1(Z80Core* ctx) { ctx->RES_R(0b011, 1); }
+    static inline void RES_E_2(Z80Core* ctx) { ctx->RES_R(0b011, 2); }
+    static inline void RES_E_3(Z80Core* ctx) { ctx->RES_R(0b011, 3); }
+    static inline void RES_E_4(Z80Core* ctx) { ctx->RES_R(0b011, 4); }
+    static inline void RES_E_5(Z80Core* ctx) { ctx->RES_R(0b011, 5); }
+    static inline void RES_E_6(Z80Core* ctx) { ctx->RES_R(0b011, 6); }
+    static inline void RES_E_7(Z80Core* ctx) { ctx->RES_R(0b011, 7); }
+    static inline void RES_H_0(Z80Core* ctx) { ctx->RES_R(0b100, 0); }
+    static inline void RES_H_1(Z80Core* ctx) { ctx->RES_R(0b100, 1); }
+    static inline void RES_H_2(Z80Core* ctx) { ctx->RES_R(0b100, 2); }
+    static inline void RES_H_3(Z80Core* ctx) { ctx->RES_R(0b100, 3); }
+    static inline void RES_H_4(Z80Core* ctx) { ctx->RES_R(0b100, 4); }
+    static inline void RES_H_5(Z80Core* ctx) { ctx->RES_R(0b100, 5); }
+    static inline void RES_H_6(Z80Core* ctx) { ctx->RES_R(0b100, 6); }
+    static inline void RES_H_7(Z80Core* ctx) { ctx->RES_R(0b100, 7); }
+    static inline void RES_L_0(Z80Core* ctx) { ctx->RES_R(0b101, 0); }
+    static inline void RES_L_1(Z80Core* ctx) { ctx->RES_R(0b101, 1); }
+    static inline void RES_L_2(Z80Core* ctx) { ctx->RES_R(0b101, 2); }
+    static inline void RES_L_3(Z80Core* ctx) { ctx->RES_R(0b101, 3); }
+    static inline void RES_L_4(Z80Core* ctx) { ctx->RES_R(0b101, 4); }
+    static inline void RES_L_5(Z80Core* ctx) { ctx->RES_R(0b101, 5); }
+    static inline void RES_L_6(Z80Core* ctx) { ctx->RES_R(0b101, 6); }
+    static inline void RES_L_7(Z80Core* ctx) { ctx->RES_R(0b101, 7); }
+    static inline void RES_A_0(Z80Core* ctx) { ctx->RES_R(0b111, 0); }
+    static inline void RES_A_1(Z80Core* ctx) { ctx->RES_R(0b111, 1); }
+    static inline void RES_A_2(Z80Core* ctx) { ctx->RES_R(0b111, 2); }
+    static inline void RES_A_3(Z80Core* ctx) { ctx->RES_R(0b111, 3); }
+    static inline void RES_A_4(Z80Core* ctx) { ctx->RES_R(0b111, 4); }
+    static inline void RES_A_5(Z80Core* ctx) { ctx->RES_R(0b111, 5); }
+    static inline void RES_A_6(Z80Core* ctx) { ctx->RES_R(0b111, 6); }
+    static inline void RES_A_7(Z80Core* ctx) { ctx->RES_R(0b111, 7); }
     inline void RES_R(unsigned char r, unsigned char bit)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4796,14 +5933,14 @@ class Z80
     }
 
     // RESET bit b of location (HL)
-    static inline void RES_HL_0(Z80* ctx) { ctx->RES_HL(0); }
-    static inline void RES_HL_1(Z80* ctx) { ctx->RES_HL(1); }
-    static inline void RES_HL_2(Z80* ctx) { ctx->RES_HL(2); }
-    static inline void RES_HL_3(Z80* ctx) { ctx->RES_HL(3); }
-    static inline void RES_HL_4(Z80* ctx) { ctx->RES_HL(4); }
-    static inline void RES_HL_5(Z80* ctx) { ctx->RES_HL(5); }
-    static inline void RES_HL_6(Z80* ctx) { ctx->RES_HL(6); }
-    static inline void RES_HL_7(Z80* ctx) { ctx->RES_HL(7); }
+    static inline void RES_HL_0(Z80Core* ctx) { ctx->RES_HL(0); }
+    static inline void RES_HL_1(Z80Core* ctx) { ctx->RES_HL(1); }
+    static inline void RES_HL_2(Z80Core* ctx) { ctx->RES_HL(2); }
+    static inline void RES_HL_3(Z80Core* ctx) { ctx->RES_HL(3); }
+    static inline void RES_HL_4(Z80Core* ctx) { ctx->RES_HL(4); }
+    static inline void RES_HL_5(Z80Core* ctx) { ctx->RES_HL(5); }
+    static inline void RES_HL_6(Z80Core* ctx) { ctx->RES_HL(6); }
+    static inline void RES_HL_7(Z80Core* ctx) { ctx->RES_HL(7); }
     inline void RES_HL(unsigned char bit)
     {
         unsigned short addr = getHL();
@@ -4825,14 +5962,14 @@ class Z80
     }
 
     // RESET bit b of location (IX+d)
-    static inline void RES_IX_0(Z80* ctx, signed char d) { ctx->RES_IX(d, 0); }
-    static inline void RES_IX_1(Z80* ctx, signed char d) { ctx->RES_IX(d, 1); }
-    static inline void RES_IX_2(Z80* ctx, signed char d) { ctx->RES_IX(d, 2); }
-    static inline void RES_IX_3(Z80* ctx, signed char d) { ctx->RES_IX(d, 3); }
-    static inline void RES_IX_4(Z80* ctx, signed char d) { ctx->RES_IX(d, 4); }
-    static inline void RES_IX_5(Z80* ctx, signed char d) { ctx->RES_IX(d, 5); }
-    static inline void RES_IX_6(Z80* ctx, signed char d) { ctx->RES_IX(d, 6); }
-    static inline void RES_IX_7(Z80* ctx, signed char d) { ctx->RES_IX(d, 7); }
+    static inline void RES_IX_0(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 0); }
+    static inline void RES_IX_1(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 1); }
+    static inline void RES_IX_2(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 2); }
+    static inline void RES_IX_3(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 3); }
+    static inline void RES_IX_4(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 4); }
+    static inline void RES_IX_5(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 5); }
+    static inline void RES_IX_6(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 6); }
+    static inline void RES_IX_7(Z80Core* ctx, signed char d) { ctx->RES_IX(d, 7); }
     inline void RES_IX(signed char d, unsigned char bit, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IX + d);
@@ -4855,62 +5992,62 @@ class Z80
     }
 
     // RESET bit b of location (IX+d) with load Reg.
-    static inline void RES_IX_0_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b000); }
-    static inline void RES_IX_1_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b000); }
-    static inline void RES_IX_2_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b000); }
-    static inline void RES_IX_3_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b000); }
-    static inline void RES_IX_4_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b000); }
-    static inline void RES_IX_5_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b000); }
-    static inline void RES_IX_6_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b000); }
-    static inline void RES_IX_7_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b000); }
-    static inline void RES_IX_0_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b001); }
-    static inline void RES_IX_1_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b001); }
-    static inline void RES_IX_2_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b001); }
-    static inline void RES_IX_3_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b001); }
-    static inline void RES_IX_4_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b001); }
-    static inline void RES_IX_5_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b001); }
-    static inline void RES_IX_6_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b001); }
-    static inline void RES_IX_7_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b001); }
-    static inline void RES_IX_0_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b010); }
-    static inline void RES_IX_1_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b010); }
-    static inline void RES_IX_2_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b010); }
-    static inline void RES_IX_3_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b010); }
-    static inline void RES_IX_4_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b010); }
-    static inline void RES_IX_5_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b010); }
-    static inline void RES_IX_6_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b010); }
-    static inline void RES_IX_7_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b010); }
-    static inline void RES_IX_0_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b011); }
-    static inline void RES_IX_1_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b011); }
-    static inline void RES_IX_2_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b011); }
-    static inline void RES_IX_3_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b011); }
-    static inline void RES_IX_4_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b011); }
-    static inline void RES_IX_5_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b011); }
-    static inline void RES_IX_6_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b011); }
-    static inline void RES_IX_7_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b011); }
-    static inline void RES_IX_0_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b100); }
-    static inline void RES_IX_1_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b100); }
-    static inline void RES_IX_2_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b100); }
-    static inline void RES_IX_3_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b100); }
-    static inline void RES_IX_4_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b100); }
-    static inline void RES_IX_5_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b100); }
-    static inline void RES_IX_6_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b100); }
-    static inline void RES_IX_7_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b100); }
-    static inline void RES_IX_0_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b101); }
-    static inline void RES_IX_1_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b101); }
-    static inline void RES_IX_2_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b101); }
-    static inline void RES_IX_3_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b101); }
-    static inline void RES_IX_4_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b101); }
-    static inline void RES_IX_5_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b101); }
-    static inline void RES_IX_6_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b101); }
-    static inline void RES_IX_7_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b101); }
-    static inline void RES_IX_0_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b111); }
-    static inline void RES_IX_1_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b111); }
-    static inline void RES_IX_2_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b111); }
-    static inline void RES_IX_3_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b111); }
-    static inline void RES_IX_4_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b111); }
-    static inline void RES_IX_5_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b111); }
-    static inline void RES_IX_6_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b111); }
-    static inline void RES_IX_7_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b111); }
+    static inline void RES_IX_0_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b000); }
+    static inline void RES_IX_1_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b000); }
+    static inline void RES_IX_2_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b000); }
+    static inline void RES_IX_3_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b000); }
+    static inline void RES_IX_4_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b000); }
+    static inline void RES_IX_5_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b000); }
+    static inline void RES_IX_6_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b000); }
+    static inline void RES_IX_7_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b000); }
+    static inline void RES_IX_0_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b001); }
+    static inline void RES_IX_1_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b001); }
+    static inline void RES_IX_2_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b001); }
+    static inline void RES_IX_3_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b001); }
+    static inline void RES_IX_4_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b001); }
+    static inline void RES_IX_5_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b001); }
+    static inline void RES_IX_6_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b001); }
+    static inline void RES_IX_7_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b001); }
+    static inline void RES_IX_0_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b010); }
+    static inline void RES_IX_1_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b010); }
+    static inline void RES_IX_2_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b010); }
+    static inline void RES_IX_3_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b010); }
+    static inline void RES_IX_4_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b010); }
+    static inline void RES_IX_5_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b010); }
+    static inline void RES_IX_6_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b010); }
+    static inline void RES_IX_7_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b010); }
+    static inline void RES_IX_0_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b011); }
+    static inline void RES_IX_1_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b011); }
+    static inline void RES_IX_2_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b011); }
+    static inline void RES_IX_3_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b011); }
+    static inline void RES_IX_4_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b011); }
+    static inline void RES_IX_5_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b011); }
+    static inline void RES_IX_6_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b011); }
+    static inline void RES_IX_7_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b011); }
+    static inline void RES_IX_0_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b100); }
+    static inline void RES_IX_1_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b100); }
+    static inline void RES_IX_2_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b100); }
+    static inline void RES_IX_3_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b100); }
+    static inline void RES_IX_4_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b100); }
+    static inline void RES_IX_5_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b100); }
+    static inline void RES_IX_6_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b100); }
+    static inline void RES_IX_7_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b100); }
+    static inline void RES_IX_0_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b101); }
+    static inline void RES_IX_1_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b101); }
+    static inline void RES_IX_2_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b101); }
+    static inline void RES_IX_3_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b101); }
+    static inline void RES_IX_4_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b101); }
+    static inline void RES_IX_5_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b101); }
+    static inline void RES_IX_6_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b101); }
+    static inline void RES_IX_7_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b101); }
+    static inline void RES_IX_0_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 0, 0b111); }
+    static inline void RES_IX_1_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 1, 0b111); }
+    static inline void RES_IX_2_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 2, 0b111); }
+    static inline void RES_IX_3_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 3, 0b111); }
+    static inline void RES_IX_4_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 4, 0b111); }
+    static inline void RES_IX_5_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 5, 0b111); }
+    static inline void RES_IX_6_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 6, 0b111); }
+    static inline void RES_IX_7_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IX_with_LD(d, 7, 0b111); }
     inline void RES_IX_with_LD(signed char d, unsigned char bit, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -4928,62 +6065,62 @@ class Z80
     }
 
     // RESET bit b of location (IY+d) with load Reg.
-    static inline void RES_IY_0_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b000); }
-    static inline void RES_IY_1_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b000); }
-    static inline void RES_IY_2_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b000); }
-    static inline void RES_IY_3_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b000); }
-    static inline void RES_IY_4_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b000); }
-    static inline void RES_IY_5_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b000); }
-    static inline void RES_IY_6_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b000); }
-    static inline void RES_IY_7_with_LD_B(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b000); }
-    static inline void RES_IY_0_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b001); }
-    static inline void RES_IY_1_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b001); }
-    static inline void RES_IY_2_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b001); }
-    static inline void RES_IY_3_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b001); }
-    static inline void RES_IY_4_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b001); }
-    static inline void RES_IY_5_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b001); }
-    static inline void RES_IY_6_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b001); }
-    static inline void RES_IY_7_with_LD_C(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b001); }
-    static inline void RES_IY_0_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b010); }
-    static inline void RES_IY_1_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b010); }
-    static inline void RES_IY_2_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b010); }
-    static inline void RES_IY_3_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b010); }
-    static inline void RES_IY_4_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b010); }
-    static inline void RES_IY_5_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b010); }
-    static inline void RES_IY_6_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b010); }
-    static inline void RES_IY_7_with_LD_D(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b010); }
-    static inline void RES_IY_0_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b011); }
-    static inline void RES_IY_1_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b011); }
-    static inline void RES_IY_2_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b011); }
-    static inline void RES_IY_3_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b011); }
-    static inline void RES_IY_4_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b011); }
-    static inline void RES_IY_5_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b011); }
-    static inline void RES_IY_6_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b011); }
-    static inline void RES_IY_7_with_LD_E(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b011); }
-    static inline void RES_IY_0_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b100); }
-    static inline void RES_IY_1_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b100); }
-    static inline void RES_IY_2_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b100); }
-    static inline void RES_IY_3_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b100); }
-    static inline void RES_IY_4_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b100); }
-    static inline void RES_IY_5_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b100); }
-    static inline void RES_IY_6_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b100); }
-    static inline void RES_IY_7_with_LD_H(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b100); }
-    static inline void RES_IY_0_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b101); }
-    static inline void RES_IY_1_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b101); }
-    static inline void RES_IY_2_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b101); }
-    static inline void RES_IY_3_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b101); }
-    static inline void RES_IY_4_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b101); }
-    static inline void RES_IY_5_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b101); }
-    static inline void RES_IY_6_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b101); }
-    static inline void RES_IY_7_with_LD_L(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b101); }
-    static inline void RES_IY_0_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b111); }
-    static inline void RES_IY_1_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b111); }
-    static inline void RES_IY_2_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b111); }
-    static inline void RES_IY_3_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b111); }
-    static inline void RES_IY_4_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b111); }
-    static inline void RES_IY_5_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b111); }
-    static inline void RES_IY_6_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b111); }
-    static inline void RES_IY_7_with_LD_A(Z80* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b111); }
+    static inline void RES_IY_0_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b000); }
+    static inline void RES_IY_1_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b000); }
+    static inline void RES_IY_2_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b000); }
+    static inline void RES_IY_3_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b000); }
+    static inline void RES_IY_4_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b000); }
+    static inline void RES_IY_5_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b000); }
+    static inline void RES_IY_6_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b000); }
+    static inline void RES_IY_7_with_LD_B(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b000); }
+    static inline void RES_IY_0_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b001); }
+    static inline void RES_IY_1_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b001); }
+    static inline void RES_IY_2_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b001); }
+    static inline void RES_IY_3_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b001); }
+    static inline void RES_IY_4_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b001); }
+    static inline void RES_IY_5_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b001); }
+    static inline void RES_IY_6_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b001); }
+    static inline void RES_IY_7_with_LD_C(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b001); }
+    static inline void RES_IY_0_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b010); }
+    static inline void RES_IY_1_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b010); }
+    static inline void RES_IY_2_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b010); }
+    static inline void RES_IY_3_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b010); }
+    static inline void RES_IY_4_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b010); }
+    static inline void RES_IY_5_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b010); }
+    static inline void RES_IY_6_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b010); }
+    static inline void RES_IY_7_with_LD_D(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b010); }
+    static inline void RES_IY_0_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b011); }
+    static inline void RES_IY_1_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b011); }
+    static inline void RES_IY_2_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b011); }
+    static inline void RES_IY_3_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b011); }
+    static inline void RES_IY_4_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b011); }
+    static inline void RES_IY_5_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b011); }
+    static inline void RES_IY_6_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b011); }
+    static inline void RES_IY_7_with_LD_E(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b011); }
+    static inline void RES_IY_0_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b100); }
+    static inline void RES_IY_1_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b100); }
+    static inline void RES_IY_2_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b100); }
+    static inline void RES_IY_3_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b100); }
+    static inline void RES_IY_4_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b100); }
+    static inline void RES_IY_5_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b100); }
+    static inline void RES_IY_6_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b100); }
+    static inline void RES_IY_7_with_LD_H(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b100); }
+    static inline void RES_IY_0_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b101); }
+    static inline void RES_IY_1_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b101); }
+    static inline void RES_IY_2_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b101); }
+    static inline void RES_IY_3_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b101); }
+    static inline void RES_IY_4_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b101); }
+    static inline void RES_IY_5_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b101); }
+    static inline void RES_IY_6_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b101); }
+    static inline void RES_IY_7_with_LD_L(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b101); }
+    static inline void RES_IY_0_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 0, 0b111); }
+    static inline void RES_IY_1_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 1, 0b111); }
+    static inline void RES_IY_2_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 2, 0b111); }
+    static inline void RES_IY_3_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 3, 0b111); }
+    static inline void RES_IY_4_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 4, 0b111); }
+    static inline void RES_IY_5_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 5, 0b111); }
+    static inline void RES_IY_6_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 6, 0b111); }
+    static inline void RES_IY_7_with_LD_A(Z80Core* ctx, signed char d) { ctx->RES_IY_with_LD(d, 7, 0b111); }
     inline void RES_IY_with_LD(signed char d, unsigned char bit, unsigned char r)
     {
         unsigned char* rp = getRegisterPointer(r);
@@ -5001,14 +6138,14 @@ class Z80
     }
 
     // RESET bit b of location (IY+d)
-    static inline void RES_IY_0(Z80* ctx, signed char d) { ctx->RES_IY(d, 0); }
-    static inline void RES_IY_1(Z80* ctx, signed char d) { ctx->RES_IY(d, 1); }
-    static inline void RES_IY_2(Z80* ctx, signed char d) { ctx->RES_IY(d, 2); }
-    static inline void RES_IY_3(Z80* ctx, signed char d) { ctx->RES_IY(d, 3); }
-    static inline void RES_IY_4(Z80* ctx, signed char d) { ctx->RES_IY(d, 4); }
-    static inline void RES_IY_5(Z80* ctx, signed char d) { ctx->RES_IY(d, 5); }
-    static inline void RES_IY_6(Z80* ctx, signed char d) { ctx->RES_IY(d, 6); }
-    static inline void RES_IY_7(Z80* ctx, signed char d) { ctx->RES_IY(d, 7); }
+    static inline void RES_IY_0(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 0); }
+    static inline void RES_IY_1(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 1); }
+    static inline void RES_IY_2(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 2); }
+    static inline void RES_IY_3(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 3); }
+    static inline void RES_IY_4(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 4); }
+    static inline void RES_IY_5(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 5); }
+    static inline void RES_IY_6(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 6); }
+    static inline void RES_IY_7(Z80Core* ctx, signed char d) { ctx->RES_IY(d, 7); }
     inline void RES_IY(signed char d, unsigned char bit, unsigned char* rp = nullptr, const char* extraLog = nullptr)
     {
         unsigned short addr = (unsigned short)(reg.IY + d);
@@ -5033,6 +6170,11 @@ class Z80
     // Compare location (HL) and A, increment/decrement HL and decrement BC
     inline void repeatCP(bool isIncHL, bool isRepeat)
     {
+        if (isRepeat && isRepeatFastPathAvailable()) {
+            int clocks = repeatClocks(wtc.read + 4 + 4);
+            int count = repeatCount(clocks) - 1;
+            if (0 < count) skipClocks(repeatCPNative(isIncHL, count) * clocks);
+        }
         unsigned short hl = getHL();
         unsigned short bc = getBC();
         unsigned char n = readByte(hl);
@@ -5062,24 +6204,24 @@ class Z80
         }
         reg.WZ += isIncHL ? 1 : -1;
     }
-    static inline void CPI(Z80* ctx) { ctx->repeatCP(true, false); }
-    static inline void CPIR(Z80* ctx) { ctx->repeatCP(true, true); }
-    static inline void CPD(Z80* ctx) { ctx->repeatCP(false, false); }
-    static inline void CPDR(Z80* ctx) { ctx->repeatCP(false, true); }
+    static inline void CPI(Z80Core* ctx) { ctx->repeatCP(true, false); }
+    static inline void CPIR(Z80Core* ctx) { ctx->repeatCP(true, true); }
+    static inline void CPD(Z80Core* ctx) { ctx->repeatCP(false, false); }
+    static inline void CPDR(Z80Core* ctx) { ctx->repeatCP(false, true); }
 
     // Compare Register
-    static inline void CP_B(Z80* ctx) { ctx->CP_R(0b000); }
-    static inline void CP_C(Z80* ctx) { ctx->CP_R(0b001); }
-    static inline void CP_D(Z80* ctx) { ctx->CP_R(0b010); }
-    static inline void CP_E(Z80* ctx) { ctx->CP_R(0b011); }
-    static inline void CP_H(Z80* ctx) { ctx->CP_R(0b100); }
-    static inline void CP_L(Z80* ctx) { ctx->CP_R(0b101); }
-    static inline void CP_A(Z80* ctx) { ctx->CP_R(0b111); }
-    static inline void CP_B_2(Z80* ctx) { ctx->CP_R(0b000, 2); }
-    static inline void CP_C_2(Z80* ctx) { ctx->CP_R(0b001, 2); }
-    static inline void CP_D_2(Z80* ctx) { ctx->CP_R(0b010, 2); }
-    static inline void CP_E_2(Z80* ctx) { ctx->CP_R(0b011, 2); }
-    static inline void CP_A_2(Z80* ctx) { ctx->CP_R(0b111, 2); }
+    static inline void CP_B(Z80Core* ctx) { ctx->CP_R(0b000); }
+    static inline void CP_C(Z80Core* ctx) { ctx->CP_R(0b001); }
+    static inline void CP_D(Z80Core* ctx) { ctx->CP_R(0b010); }
+    static inline void CP_E(Z80Core* ctx) { ctx->CP_R(0b011); }
+    static inline void CP_H(Z80Core* ctx) { ctx->CP_R(0b100); }
+    static inline void CP_L(Z80Core* ctx) { ctx->CP_R(0b101); }
+    static inline void CP_A(Z80Core* ctx) { ctx->CP_R(0b111); }
+    static inline void CP_B_2(Z80Core* ctx) { ctx->CP_R(0b000, 2); }
+    static inline void CP_C_2(Z80Core* ctx) { ctx->CP_R(0b001, 2); }
+    static inline void CP_D_2(Z80Core* ctx) { ctx->CP_R(0b010, 2); }
+    static inline void CP_E_2(Z80Core* ctx) { ctx->CP_R(0b011, 2); }
+    static inline void CP_A_2(Z80Core* ctx) { ctx->CP_R(0b111, 2); }
     inline void CP_R(unsigned char r, int pc = 1)
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -5090,7 +6232,7 @@ class Z80
     }
 
     // Compare Register IXH
-    static inline void CP_IXH_(Z80* ctx) { ctx->CP_IXH(); }
+    static inline void CP_IXH_(Z80Core* ctx) { ctx->CP_IXH(); }
     inline void CP_IXH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -5100,7 +6242,7 @@ class Z80
     }
 
     // Compare Register IXL
-    static inline void CP_IXL_(Z80* ctx) { ctx->CP_IXL(); }
+    static inline void CP_IXL_(Z80Core* ctx) { ctx->CP_IXL(); }
     inline void CP_IXL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -5110,7 +6252,7 @@ class Z80
     }
 
     // Compare Register IYH
-    static inline void CP_IYH_(Z80* ctx) { ctx->CP_IYH(); }
+    static inline void CP_IYH_(Z80Core* ctx) { ctx->CP_IYH(); }
     inline void CP_IYH()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -5120,7 +6262,7 @@ class Z80
     }
 
     // Compare Register IYL
-    static inline void CP_IYL_(Z80* ctx) { ctx->CP_IYL(); }
+    static inline void CP_IYL_(Z80Core* ctx) { ctx->CP_IYL(); }
     inline void CP_IYL()
     {
 #ifndef Z80_DISABLE_DEBUG
@@ -5130,7 +6272,7 @@ class Z80
     }
 
     // Compare immediate
-    static inline void CP_N(Z80* ctx)
+    static inline void CP_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -5140,7 +6282,7 @@ class Z80
     }
 
     // Compare memory
-    static inline void CP_HL(Z80* ctx)
+    static inline void CP_HL(Z80Core* ctx)
     {
         unsigned char n = ctx->readByte(ctx->getHL(), 3);
 #ifndef Z80_DISABLE_DEBUG
@@ -5150,7 +6292,7 @@ class Z80
     }
 
     // Compare memory
-    static inline void CP_IX_(Z80* ctx) { ctx->CP_IX(); }
+    static inline void CP_IX_(Z80Core* ctx) { ctx->CP_IX(); }
     inline void CP_IX()
     {
         signed char d = (signed char)fetch(4);
@@ -5163,7 +6305,7 @@ class Z80
     }
 
     // Compare memory
-    static inline void CP_IY_(Z80* ctx) { ctx->CP_IY(); }
+    static inline void CP_IY_(Z80Core* ctx) { ctx->CP_IY(); }
     inline void CP_IY()
     {
         signed char d = (signed char)fetch(4);
@@ -5176,7 +6318,7 @@ class Z80
     }
 
     // Jump
-    static inline void JP_NN(Z80* ctx)
+    static inline void JP_NN(Z80Core* ctx)
     {
         unsigned char l = ctx->fetch(3);
         unsigned char h = ctx->fetch(3);
@@ -5189,14 +6331,14 @@ class Z80
     }
 
     // Conditional Jump
-    static inline void JP_C0_NN(Z80* ctx) { ctx->JP_C_NN(Condition::NZ); }
-    static inline void JP_C1_NN(Z80* ctx) { ctx->JP_C_NN(Condition::Z); }
-    static inline void JP_C2_NN(Z80* ctx) { ctx->JP_C_NN(Condition::NC); }
-    static inline void JP_C3_NN(Z80* ctx) { ctx->JP_C_NN(Condition::C); }
-    static inline void JP_C4_NN(Z80* ctx) { ctx->JP_C_NN(Condition::NPV); }
-    static inline void JP_C5_NN(Z80* ctx) { ctx->JP_C_NN(Condition::PV); }
-    static inline void JP_C6_NN(Z80* ctx) { ctx->JP_C_NN(Condition::NS); }
-    static inline void JP_C7_NN(Z80* ctx) { ctx->JP_C_NN(Condition::S); }
+    static inline void JP_C0_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::NZ); }
+    static inline void JP_C1_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::Z); }
+    static inline void JP_C2_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::NC); }
+    static inline void JP_C3_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::C); }
+    static inline void JP_C4_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::NPV); }
+    static inline void JP_C5_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::PV); }
+    static inline void JP_C6_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::NS); }
+    static inline void JP_C7_NN(Z80Core* ctx) { ctx->JP_C_NN(Condition::S); }
     inline void JP_C_NN(Condition c)
     {
         unsigned char l = fetch(3);
@@ -5210,7 +6352,7 @@ class Z80
     }
 
     // Jump Relative to PC+e
-    static inline void JR_E(Z80* ctx)
+    static inline void JR_E(Z80Core* ctx)
     {
         signed char e = (signed char)ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -5218,13 +6360,18 @@ class Z80
 #endif
         ctx->reg.PC += e;
         ctx->consumeClock(5);
+        // JR $ (loops until an interrupt)
+        if (-2 == e && ctx->isRepeatFastPathAvailable() && ctx->isIdleLoopMapped(ctx->reg.PC, 2)) {
+            int clocks = ctx->immediateClocks(5);
+            ctx->skipIdleLoop(ctx->idleCount(clocks, INT_MAX), clocks, 1);
+        }
     }
 
     // Jump Relative to PC+e, if condition
-    static inline void JR_NZ_E(Z80* ctx) { ctx->JR_CND_E(Condition::NZ); }
-    static inline void JR_Z_E(Z80* ctx) { ctx->JR_CND_E(Condition::Z); }
-    static inline void JR_NC_E(Z80* ctx) { ctx->JR_CND_E(Condition::NC); }
-    static inline void JR_C_E(Z80* ctx) { ctx->JR_CND_E(Condition::C); }
+    static inline void JR_NZ_E(Z80Core* ctx) { ctx->JR_CND_E(Condition::NZ); }
+    static inline void JR_Z_E(Z80Core* ctx) { ctx->JR_CND_E(Condition::Z); }
+    static inline void JR_NC_E(Z80Core* ctx) { ctx->JR_CND_E(Condition::NC); }
+    static inline void JR_C_E(Z80Core* ctx) { ctx->JR_CND_E(Condition::C); }
     inline void JR_CND_E(Condition cnd)
     {
         signed char e = (signed char)fetch(3);
@@ -5234,11 +6381,12 @@ class Z80
         if (checkConditionFlag(cnd)) {
             reg.PC += e;
             consumeClock(5);
+            if (-6 == e && Condition::Z == cnd) skipPollingLoop();
         }
     }
 
     // Jump to HL
-    static inline void JP_HL(Z80* ctx)
+    static inline void JP_HL(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] JP %s", ctx->reg.PC - 1, ctx->registerPairDump(0b10));
@@ -5247,7 +6395,7 @@ class Z80
     }
 
     // Jump to IX
-    static inline void JP_IX(Z80* ctx)
+    static inline void JP_IX(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] JP IX<$%04X>", ctx->reg.PC - 2, ctx->reg.IX);
@@ -5256,7 +6404,7 @@ class Z80
     }
 
     // Jump to IY
-    static inline void JP_IY(Z80* ctx)
+    static inline void JP_IY(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_DEBUG
         if (ctx->isDebug()) ctx->log("[%04X] JP IY<$%04X>", ctx->reg.PC - 2, ctx->reg.IY);
@@ -5265,7 +6413,7 @@ class Z80
     }
 
     // 	Decrement B and Jump relative if B=0
-    static inline void DJNZ_E(Z80* ctx)
+    static inline void DJNZ_E(Z80Core* ctx)
     {
         signed char e = (signed char)ctx->fetch(4);
 #ifndef Z80_DISABLE_DEBUG
@@ -5275,11 +6423,18 @@ class Z80
         if (ctx->reg.pair.B) {
             ctx->reg.PC += e;
             ctx->consumeClock(5);
+            // DJNZ $ (loops until B = 0: the last iteration is executed as usual)
+            if (-2 == e && ctx->isRepeatFastPathAvailable() && ctx->isIdleLoopMapped(ctx->reg.PC, 2)) {
+                int clocks = ctx->immediateClocks(1 + 5);
+                int count = ctx->idleCount(clocks, ctx->reg.pair.B - 1);
+                ctx->reg.pair.B -= count;
+                ctx->skipIdleLoop(count, clocks, 1);
+            }
         }
     }
 
     // Call
-    static inline void CALL_NN(Z80* ctx)
+    static inline void CALL_NN(Z80Core* ctx)
     {
         unsigned short addrL = ctx->fetch(4);
         unsigned short addrH = ctx->fetch(3);
@@ -5297,7 +6452,7 @@ class Z80
     }
 
     // Return
-    static inline void RET(Z80* ctx)
+    static inline void RET(Z80Core* ctx)
     {
 #ifndef Z80_DISABLE_NESTCHECK
         ctx->invokeReturnHandlers();
@@ -5315,14 +6470,14 @@ class Z80
     }
 
     // Call with condition
-    static inline void CALL_C0_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::NZ); }
-    static inline void CALL_C1_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::Z); }
-    static inline void CALL_C2_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::NC); }
-    static inline void CALL_C3_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::C); }
-    static inline void CALL_C4_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::NPV); }
-    static inline void CALL_C5_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::PV); }
-    static inline void CALL_C6_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::NS); }
-    static inline void CALL_C7_NN(Z80* ctx) { ctx->CALL_C_NN(Condition::S); }
+    static inline void CALL_C0_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::NZ); }
+    static inline void CALL_C1_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::Z); }
+    static inline void CALL_C2_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::NC); }
+    static inline void CALL_C3_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::C); }
+    static inline void CALL_C4_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::NPV); }
+    static inline void CALL_C5_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::PV); }
+    static inline void CALL_C6_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::NS); }
+    static inline void CALL_C7_NN(Z80Core* ctx) { ctx->CALL_C_NN(Condition::S); }
     inline void CALL_C_NN(Condition c)
     {
         bool execute = checkConditionFlag(c);
@@ -5344,14 +6499,14 @@ class Z80
     }
 
     //  with condition
-    static inline void RET_C0(Z80* ctx) { ctx->RET_C(Condition::NZ); }
-    static inline void RET_C1(Z80* ctx) { ctx->RET_C(Condition::Z); }
-    static inline void RET_C2(Z80* ctx) { ctx->RET_C(Condition::NC); }
-    static inline void RET_C3(Z80* ctx) { ctx->RET_C(Condition::C); }
-    static inline void RET_C4(Z80* ctx) { ctx->RET_C(Condition::NPV); }
-    static inline void RET_C5(Z80* ctx) { ctx->RET_C(Condition::PV); }
-    static inline void RET_C6(Z80* ctx) { ctx->RET_C(Condition::NS); }
-    static inline void RET_C7(Z80* ctx) { ctx->RET_C(Condition::S); }
+    static inline void RET_C0(Z80Core* ctx) { ctx->RET_C(Condition::NZ); }
+    static inline void RET_C1(Z80Core* ctx) { ctx->RET_C(Condition::Z); }
+    static inline void RET_C2(Z80Core* ctx) { ctx->RET_C(Condition::NC); }
+    static inline void RET_C3(Z80Core* ctx) { ctx->RET_C(Condition::C); }
+    static inline void RET_C4(Z80Core* ctx) { ctx->RET_C(Condition::NPV); }
+    static inline void RET_C5(Z80Core* ctx) { ctx->RET_C(Condition::PV); }
+    static inline void RET_C6(Z80Core* ctx) { ctx->RET_C(Condition::NS); }
+    static inline void RET_C7(Z80Core* ctx) { ctx->RET_C(Condition::S); }
     inline void RET_C(Condition c)
     {
         if (!checkConditionFlag(c)) {
@@ -5377,7 +6532,7 @@ class Z80
     }
 
     // Return from interrupt
-    static inline void RETI_(Z80* ctx) { ctx->RETI(); }
+    static inline void RETI_(Z80Core* ctx) { ctx->RETI(); }
     inline void RETI()
     {
 #ifndef Z80_DISABLE_NESTCHECK
@@ -5397,7 +6552,7 @@ class Z80
     }
 
     // Return from non maskable interrupt
-    static inline void RETN_(Z80* ctx) { ctx->RETN(); }
+    static inline void RETN_(Z80Core* ctx) { ctx->RETN(); }
     inline void RETN()
     {
 #ifndef Z80_DISABLE_NESTCHECK
@@ -5426,14 +6581,14 @@ class Z80
     }
 
     // Interrupt
-    static inline void RST00(Z80* ctx) { ctx->RST(0, true); }
-    static inline void RST08(Z80* ctx) { ctx->RST(1, true); }
-    static inline void RST10(Z80* ctx) { ctx->RST(2, true); }
-    static inline void RST18(Z80* ctx) { ctx->RST(3, true); }
-    static inline void RST20(Z80* ctx) { ctx->RST(4, true); }
-    static inline void RST28(Z80* ctx) { ctx->RST(5, true); }
-    static inline void RST30(Z80* ctx) { ctx->RST(6, true); }
-    static inline void RST38(Z80* ctx) { ctx->RST(7, true); }
+    static inline void RST00(Z80Core* ctx) { ctx->RST(0, true); }
+    static inline void RST08(Z80Core* ctx) { ctx->RST(1, true); }
+    static inline void RST10(Z80Core* ctx) { ctx->RST(2, true); }
+    static inline void RST18(Z80Core* ctx) { ctx->RST(3, true); }
+    static inline void RST20(Z80Core* ctx) { ctx->RST(4, true); }
+    static inline void RST28(Z80Core* ctx) { ctx->RST(5, true); }
+    static inline void RST30(Z80Core* ctx) { ctx->RST(6, true); }
+    static inline void RST38(Z80Core* ctx) { ctx->RST(7, true); }
     inline void RST(unsigned char t, bool isOperand)
     {
         unsigned short addr = t * 8;
@@ -5455,7 +6610,7 @@ class Z80
     }
 
     // Input a byte form device n to accu.
-    static inline void IN_A_N(Z80* ctx)
+    static inline void IN_A_N(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
         unsigned char i = ctx->inPortWithA(n);
@@ -5466,14 +6621,14 @@ class Z80
     }
 
     // Input a byte form device (C) to register.
-    static inline void IN_B_C(Z80* ctx) { ctx->IN_R_C(0b000); }
-    static inline void IN_C_C(Z80* ctx) { ctx->IN_R_C(0b001); }
-    static inline void IN_D_C(Z80* ctx) { ctx->IN_R_C(0b010); }
-    static inline void IN_E_C(Z80* ctx) { ctx->IN_R_C(0b011); }
-    static inline void IN_H_C(Z80* ctx) { ctx->IN_R_C(0b100); }
-    static inline void IN_L_C(Z80* ctx) { ctx->IN_R_C(0b101); }
-    static inline void IN_C(Z80* ctx) { ctx->IN_R_C(0, false); }
-    static inline void IN_A_C(Z80* ctx) { ctx->IN_R_C(0b111); }
+    static inline void IN_B_C(Z80Core* ctx) { ctx->IN_R_C(0b000); }
+    static inline void IN_C_C(Z80Core* ctx) { ctx->IN_R_C(0b001); }
+    static inline void IN_D_C(Z80Core* ctx) { ctx->IN_R_C(0b010); }
+    static inline void IN_E_C(Z80Core* ctx) { ctx->IN_R_C(0b011); }
+    static inline void IN_H_C(Z80Core* ctx) { ctx->IN_R_C(0b100); }
+    static inline void IN_L_C(Z80Core* ctx) { ctx->IN_R_C(0b101); }
+    static inline void IN_C(Z80Core* ctx) { ctx->IN_R_C(0, false); }
+    static inline void IN_A_C(Z80Core* ctx) { ctx->IN_R_C(0b111); }
     inline void IN_R_C(unsigned char r, bool setRegister = true)
     {
         unsigned char* rp = setRegister ? getRegisterPointer(r) : nullptr;
@@ -5488,18 +6643,13 @@ class Z80
 #else
         if (rp) *rp = i;
 #endif
-        setFlagS(i & 0x80);
-        setFlagZ(i == 0);
-        resetFlagH();
-        setFlagPV(isEvenNumberBits(i));
-        resetFlagN();
-        setFlagXY(i);
+        regF() = (regF() & flagC()) | flagTableSZ53P[i];
     }
 
     inline void decrementB_forRepeatIO()
     {
         reg.pair.B--;
-        reg.pair.F = 0;
+        regF() = 0;
         setFlagC(isFlagC());
         setFlagN();
         setFlagZ(reg.pair.B == 0);
@@ -5538,13 +6688,13 @@ class Z80
             consumeClock(5);
         }
     }
-    static inline void INI(Z80* ctx) { ctx->repeatIN(true, false); }
-    static inline void INIR(Z80* ctx) { ctx->repeatIN(true, true); }
-    static inline void IND(Z80* ctx) { ctx->repeatIN(false, false); }
-    static inline void INDR(Z80* ctx) { ctx->repeatIN(false, true); }
+    static inline void INI(Z80Core* ctx) { ctx->repeatIN(true, false); }
+    static inline void INIR(Z80Core* ctx) { ctx->repeatIN(true, true); }
+    static inline void IND(Z80Core* ctx) { ctx->repeatIN(false, false); }
+    static inline void INDR(Z80Core* ctx) { ctx->repeatIN(false, true); }
 
     // Load Output port (n) with Acc.
-    static inline void OUT_N_A(Z80* ctx)
+    static inline void OUT_N_A(Z80Core* ctx)
     {
         unsigned char n = ctx->fetch(3);
 #ifndef Z80_DISABLE_DEBUG
@@ -5554,14 +6704,14 @@ class Z80
     }
 
     // Output a byte to device (C) form register.
-    static inline void OUT_C_B(Z80* ctx) { ctx->OUT_C_R(0b000); }
-    static inline void OUT_C_C(Z80* ctx) { ctx->OUT_C_R(0b001); }
-    static inline void OUT_C_D(Z80* ctx) { ctx->OUT_C_R(0b010); }
-    static inline void OUT_C_E(Z80* ctx) { ctx->OUT_C_R(0b011); }
-    static inline void OUT_C_H(Z80* ctx) { ctx->OUT_C_R(0b100); }
-    static inline void OUT_C_L(Z80* ctx) { ctx->OUT_C_R(0b101); }
-    static inline void OUT_C_0(Z80* ctx) { ctx->OUT_C_R(0, true); }
-    static inline void OUT_C_A(Z80* ctx) { ctx->OUT_C_R(0b111); }
+    static inline void OUT_C_B(Z80Core* ctx) { ctx->OUT_C_R(0b000); }
+    static inline void OUT_C_C(Z80Core* ctx) { ctx->OUT_C_R(0b001); }
+    static inline void OUT_C_D(Z80Core* ctx) { ctx->OUT_C_R(0b010); }
+    static inline void OUT_C_E(Z80Core* ctx) { ctx->OUT_C_R(0b011); }
+    static inline void OUT_C_H(Z80Core* ctx) { ctx->OUT_C_R(0b100); }
+    static inline void OUT_C_L(Z80Core* ctx) { ctx->OUT_C_R(0b101); }
+    static inline void OUT_C_0(Z80Core* ctx) { ctx->OUT_C_R(0, true); }
+    static inline void OUT_C_A(Z80Core* ctx) { ctx->OUT_C_R(0b111); }
     inline void OUT_C_R(unsigned char r, bool zero = false)
     {
         if (zero) {
@@ -5604,27 +6754,19 @@ class Z80
             consumeClock(5);
         }
     }
-    static inline void OUTI(Z80* ctx) { ctx->repeatOUT(true, false); }
-    static inline void OUTIR(Z80* ctx) { ctx->repeatOUT(true, true); }
-    static inline void OUTD(Z80* ctx) { ctx->repeatOUT(false, false); }
-    static inline void OUTDR(Z80* ctx) { ctx->repeatOUT(false, true); }
+    static inline void OUTI(Z80Core* ctx) { ctx->repeatOUT(true, false); }
+    static inline void OUTIR(Z80Core* ctx) { ctx->repeatOUT(true, true); }
+    static inline void OUTD(Z80Core* ctx) { ctx->repeatOUT(false, false); }
+    static inline void OUTDR(Z80Core* ctx) { ctx->repeatOUT(false, true); }
 
     // Decimal Adjust Accumulator
-    static inline void DAA(Z80* ctx) { ctx->daa(); }
+    static inline void DAA(Z80Core* ctx) { ctx->daa(); }
     inline void daa()
     {
-        int a = reg.pair.A;
-        bool c = isFlagC();
-        bool ac = reg.pair.A > 0x99;
-        int add = (isFlagH() || (a & 0x0F) > 9 ? 0x06 : 0x00) + (c || ac ? 0x60 : 0x00);
-        a += isFlagN() ? -add : add;
-        a &= 0xFF;
-        setFlagS(a & 0x80);
-        setFlagXY(a);
-        setFlagZ(0 == a);
-        setFlagH((a ^ reg.pair.A) & flagH());
-        setFlagPV(isEvenNumberBits(a));
-        setFlagC(c | ac);
+        unsigned char f = regF();
+        unsigned short af = daaTable[reg.pair.A | (f & flagC()) << 8 | (f & flagH()) << 5 | (f & flagN()) << 9];
+        unsigned char a = af >> 8;
+        regF() = af & 0xFF;
 #ifndef Z80_DISABLE_DEBUG
         if (isDebug()) log("[%04X] DAA ... A: $%02X -> $%02X", reg.PC - 1, reg.pair.A, a);
 #endif
@@ -5632,7 +6774,7 @@ class Z80
     }
 
     // Rotate digit Left and right between Acc. and location (HL)
-    static inline void RLD_(Z80* ctx) { ctx->RLD(); }
+    static inline void RLD_(Z80Core* ctx) { ctx->RLD(); }
     inline void RLD()
     {
         unsigned short hl = getHL();
@@ -5651,17 +6793,12 @@ class Z80
 #endif
         reg.pair.A = afterA;
         writeByte(hl, afterN);
-        setFlagS(reg.pair.A & 0x80);
-        setFlagXY(reg.pair.A);
-        setFlagZ(reg.pair.A == 0);
-        resetFlagH();
-        setFlagPV(isEvenNumberBits(reg.pair.A));
-        resetFlagN();
+        regF() = (regF() & flagC()) | flagTableSZ53P[reg.pair.A];
         consumeClock(2);
     }
 
     // Rotate digit Right and right between Acc. and location (HL)
-    static inline void RRD_(Z80* ctx) { ctx->RRD(); }
+    static inline void RRD_(Z80Core* ctx) { ctx->RRD(); }
     inline void RRD()
     {
         unsigned short hl = getHL();
@@ -5680,72 +6817,607 @@ class Z80
 #endif
         reg.pair.A = afterA;
         writeByte(hl, afterN);
-        setFlagS(reg.pair.A & 0x80);
-        setFlagXY(reg.pair.A);
-        setFlagZ(reg.pair.A == 0);
-        resetFlagH();
-        setFlagPV(isEvenNumberBits(reg.pair.A));
-        resetFlagN();
+        regF() = (regF() & flagC()) | flagTableSZ53P[reg.pair.A];
         consumeClock(2);
     }
 
-#ifndef Z80_DISABLE_BREAKPOINT
-    int opLength1[256] = {
-        1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, // 00 ~ 0F
-        2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1, // 10 ~ 1F
-        2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1, // 20 ~ 2F
-        2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1, // 30 ~ 3F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 40 ~ 4F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 50 ~ 5F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 60 ~ 6F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 70 ~ 7F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 80 ~ 8F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 90 ~ 9F
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // A0 ~ AF
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // B0 ~ BF
-        1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1, // C0 ~ CF
-        1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 0, 2, 1, // D0 ~ DF
-        1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1, // E0 ~ EF
-        1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1  // F0 ~ FF
+    // S, Z, Y, X and P/V flags of the value (P/V is the parity)
+    static constexpr unsigned char flagTableSZ53P[256] = {
+        0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0C, 0x0C, 0x08, 0x0C, 0x08, 0x08, 0x0C, // 00 ~ 0F
+        0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0C, 0x08, 0x08, 0x0C, 0x08, 0x0C, 0x0C, 0x08, // 10 ~ 1F
+        0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2C, 0x28, 0x28, 0x2C, 0x28, 0x2C, 0x2C, 0x28, // 20 ~ 2F
+        0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2C, 0x2C, 0x28, 0x2C, 0x28, 0x28, 0x2C, // 30 ~ 3F
+        0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0C, 0x08, 0x08, 0x0C, 0x08, 0x0C, 0x0C, 0x08, // 40 ~ 4F
+        0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0C, 0x0C, 0x08, 0x0C, 0x08, 0x08, 0x0C, // 50 ~ 5F
+        0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2C, 0x2C, 0x28, 0x2C, 0x28, 0x28, 0x2C, // 60 ~ 6F
+        0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2C, 0x28, 0x28, 0x2C, 0x28, 0x2C, 0x2C, 0x28, // 70 ~ 7F
+        0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8C, 0x88, 0x88, 0x8C, 0x88, 0x8C, 0x8C, 0x88, // 80 ~ 8F
+        0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8C, 0x8C, 0x88, 0x8C, 0x88, 0x88, 0x8C, // 90 ~ 9F
+        0xA4, 0xA0, 0xA0, 0xA4, 0xA0, 0xA4, 0xA4, 0xA0, 0xA8, 0xAC, 0xAC, 0xA8, 0xAC, 0xA8, 0xA8, 0xAC, // A0 ~ AF
+        0xA0, 0xA4, 0xA4, 0xA0, 0xA4, 0xA0, 0xA0, 0xA4, 0xAC, 0xA8, 0xA8, 0xAC, 0xA8, 0xAC, 0xAC, 0xA8, // B0 ~ BF
+        0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8C, 0x8C, 0x88, 0x8C, 0x88, 0x88, 0x8C, // C0 ~ CF
+        0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8C, 0x88, 0x88, 0x8C, 0x88, 0x8C, 0x8C, 0x88, // D0 ~ DF
+        0xA0, 0xA4, 0xA4, 0xA0, 0xA4, 0xA0, 0xA0, 0xA4, 0xAC, 0xA8, 0xA8, 0xAC, 0xA8, 0xAC, 0xAC, 0xA8, // E0 ~ EF
+        0xA4, 0xA0, 0xA0, 0xA4, 0xA0, 0xA4, 0xA4, 0xA0, 0xA8, 0xAC, 0xAC, 0xA8, 0xAC, 0xA8, 0xA8, 0xAC  // F0 ~ FF
     };
-    int opLengthED[256] = {
-        3, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 0, // 00 ~ 0F
-        3, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 0, // 10 ~ 1F
-        3, 3, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 0, // 20 ~ 2F
-        0, 0, 0, 0, 2, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 0, // 30 ~ 3F
-        2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 0, 2, // 40 ~ 4F
-        2, 2, 2, 4, 0, 0, 2, 2, 2, 2, 2, 4, 2, 0, 2, 2, // 50 ~ 5F
-        2, 2, 2, 4, 3, 0, 0, 2, 2, 2, 2, 4, 2, 0, 0, 2, // 60 ~ 6F
-        2, 2, 2, 4, 3, 0, 2, 0, 2, 2, 2, 4, 2, 0, 0, 0, // 70 ~ 7F
-        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, // 80 ~ 8F
-        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, // 90 ~ 9F
-        2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, // A0 ~ AF
-        2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, // B0 ~ BF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // C0 ~ CF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // D0 ~ DF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // E0 ~ EF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // F0 ~ FF
+
+    // S, Z, Y, H, X, P/V and N flags of the result of 8-bit INC
+    static constexpr unsigned char flagTableInc[256] = {
+        0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 00 ~ 0F
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 10 ~ 1F
+        0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, // 20 ~ 2F
+        0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, // 30 ~ 3F
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 40 ~ 4F
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, // 50 ~ 5F
+        0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, // 60 ~ 6F
+        0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, // 70 ~ 7F
+        0x94, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, // 80 ~ 8F
+        0x90, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, // 90 ~ 9F
+        0xB0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, // A0 ~ AF
+        0xB0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, // B0 ~ BF
+        0x90, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, // C0 ~ CF
+        0x90, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, // D0 ~ DF
+        0xB0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, // E0 ~ EF
+        0xB0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8  // F0 ~ FF
     };
-    int opLengthIXY[256] = {
-        0, 0, 0, 0, 2, 2, 3, 0, 0, 2, 0, 0, 2, 2, 3, 0, // 00 ~ 0F
-        0, 0, 0, 0, 2, 2, 3, 0, 0, 2, 0, 0, 2, 2, 3, 0, // 10 ~ 1F
-        0, 4, 4, 2, 2, 2, 3, 0, 0, 2, 4, 2, 2, 2, 3, 0, // 20 ~ 2F
-        0, 0, 0, 0, 3, 3, 4, 0, 0, 2, 0, 0, 2, 2, 3, 0, // 30 ~ 3F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // 40 ~ 4F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // 50 ~ 5F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // 60 ~ 6F
-        3, 3, 3, 3, 3, 3, 0, 3, 2, 2, 2, 2, 2, 2, 3, 2, // 70 ~ 7F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // 80 ~ 8F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // 90 ~ 9F
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // A0 ~ AF
-        2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2, // B0 ~ BF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, // C0 ~ CF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // D0 ~ DF
-        0, 2, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, // E0 ~ EF
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0  // F0 ~ FF
+
+    // S, Z, Y, H, X, P/V and N flags of the result of 8-bit DEC
+    static constexpr unsigned char flagTableDec[256] = {
+        0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x1A, // 00 ~ 0F
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x1A, // 10 ~ 1F
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3A, // 20 ~ 2F
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3A, // 30 ~ 3F
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x1A, // 40 ~ 4F
+        0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x1A, // 50 ~ 5F
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3A, // 60 ~ 6F
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x3E, // 70 ~ 7F
+        0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x9A, // 80 ~ 8F
+        0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x9A, // 90 ~ 9F
+        0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, // A0 ~ AF
+        0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, // B0 ~ BF
+        0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x9A, // C0 ~ CF
+        0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x9A, // D0 ~ DF
+        0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, // E0 ~ EF
+        0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA  // F0 ~ FF
     };
-#endif
-    void (*opSet1[256])(Z80* ctx) = {
+
+    // result of DAA: index = A | C << 8 | H << 9 | N << 10, value = A << 8 | F
+    static constexpr unsigned short daaTable[2048] = {
+        0x0044, 0x0100, 0x0200, 0x0304, 0x0400, 0x0504, 0x0604, 0x0700, 0x0808, 0x090C, 0x1010, 0x1114, 0x1214, 0x1310, 0x1414, 0x1510, // 000 ~ 00F
+        0x1000, 0x1104, 0x1204, 0x1300, 0x1404, 0x1500, 0x1600, 0x1704, 0x180C, 0x1908, 0x2030, 0x2134, 0x2234, 0x2330, 0x2434, 0x2530, // 010 ~ 01F
+        0x2020, 0x2124, 0x2224, 0x2320, 0x2424, 0x2520, 0x2620, 0x2724, 0x282C, 0x2928, 0x3034, 0x3130, 0x3230, 0x3334, 0x3430, 0x3534, // 020 ~ 02F
+        0x3024, 0x3120, 0x3220, 0x3324, 0x3420, 0x3524, 0x3624, 0x3720, 0x3828, 0x392C, 0x4010, 0x4114, 0x4214, 0x4310, 0x4414, 0x4510, // 030 ~ 03F
+        0x4000, 0x4104, 0x4204, 0x4300, 0x4404, 0x4500, 0x4600, 0x4704, 0x480C, 0x4908, 0x5014, 0x5110, 0x5210, 0x5314, 0x5410, 0x5514, // 040 ~ 04F
+        0x5004, 0x5100, 0x5200, 0x5304, 0x5400, 0x5504, 0x5604, 0x5700, 0x5808, 0x590C, 0x6034, 0x6130, 0x6230, 0x6334, 0x6430, 0x6534, // 050 ~ 05F
+        0x6024, 0x6120, 0x6220, 0x6324, 0x6420, 0x6524, 0x6624, 0x6720, 0x6828, 0x692C, 0x7030, 0x7134, 0x7234, 0x7330, 0x7434, 0x7530, // 060 ~ 06F
+        0x7020, 0x7124, 0x7224, 0x7320, 0x7424, 0x7520, 0x7620, 0x7724, 0x782C, 0x7928, 0x8090, 0x8194, 0x8294, 0x8390, 0x8494, 0x8590, // 070 ~ 07F
+        0x8080, 0x8184, 0x8284, 0x8380, 0x8484, 0x8580, 0x8680, 0x8784, 0x888C, 0x8988, 0x9094, 0x9190, 0x9290, 0x9394, 0x9490, 0x9594, // 080 ~ 08F
+        0x9084, 0x9180, 0x9280, 0x9384, 0x9480, 0x9584, 0x9684, 0x9780, 0x9888, 0x998C, 0x0055, 0x0111, 0x0211, 0x0315, 0x0411, 0x0515, // 090 ~ 09F
+        0x0045, 0x0101, 0x0201, 0x0305, 0x0401, 0x0505, 0x0605, 0x0701, 0x0809, 0x090D, 0x1011, 0x1115, 0x1215, 0x1311, 0x1415, 0x1511, // 0A0 ~ 0AF
+        0x1001, 0x1105, 0x1205, 0x1301, 0x1405, 0x1501, 0x1601, 0x1705, 0x180D, 0x1909, 0x2031, 0x2135, 0x2235, 0x2331, 0x2435, 0x2531, // 0B0 ~ 0BF
+        0x2021, 0x2125, 0x2225, 0x2321, 0x2425, 0x2521, 0x2621, 0x2725, 0x282D, 0x2929, 0x3035, 0x3131, 0x3231, 0x3335, 0x3431, 0x3535, // 0C0 ~ 0CF
+        0x3025, 0x3121, 0x3221, 0x3325, 0x3421, 0x3525, 0x3625, 0x3721, 0x3829, 0x392D, 0x4011, 0x4115, 0x4215, 0x4311, 0x4415, 0x4511, // 0D0 ~ 0DF
+        0x4001, 0x4105, 0x4205, 0x4301, 0x4405, 0x4501, 0x4601, 0x4705, 0x480D, 0x4909, 0x5015, 0x5111, 0x5211, 0x5315, 0x5411, 0x5515, // 0E0 ~ 0EF
+        0x5005, 0x5101, 0x5201, 0x5305, 0x5401, 0x5505, 0x5605, 0x5701, 0x5809, 0x590D, 0x6035, 0x6131, 0x6231, 0x6335, 0x6431, 0x6535, // 0F0 ~ 0FF
+        0x6025, 0x6121, 0x6221, 0x6325, 0x6421, 0x6525, 0x6625, 0x6721, 0x6829, 0x692D, 0x7031, 0x7135, 0x7235, 0x7331, 0x7435, 0x7531, // 100 ~ 10F
+        0x7021, 0x7125, 0x7225, 0x7321, 0x7425, 0x7521, 0x7621, 0x7725, 0x782D, 0x7929, 0x8091, 0x8195, 0x8295, 0x8391, 0x8495, 0x8591, // 110 ~ 11F
+        0x8081, 0x8185, 0x8285, 0x8381, 0x8485, 0x8581, 0x8681, 0x8785, 0x888D, 0x8989, 0x9095, 0x9191, 0x9291, 0x9395, 0x9491, 0x9595, // 120 ~ 12F
+        0x9085, 0x9181, 0x9281, 0x9385, 0x9481, 0x9585, 0x9685, 0x9781, 0x9889, 0x998D, 0xA0B5, 0xA1B1, 0xA2B1, 0xA3B5, 0xA4B1, 0xA5B5, // 130 ~ 13F
+        0xA0A5, 0xA1A1, 0xA2A1, 0xA3A5, 0xA4A1, 0xA5A5, 0xA6A5, 0xA7A1, 0xA8A9, 0xA9AD, 0xB0B1, 0xB1B5, 0xB2B5, 0xB3B1, 0xB4B5, 0xB5B1, // 140 ~ 14F
+        0xB0A1, 0xB1A5, 0xB2A5, 0xB3A1, 0xB4A5, 0xB5A1, 0xB6A1, 0xB7A5, 0xB8AD, 0xB9A9, 0xC095, 0xC191, 0xC291, 0xC395, 0xC491, 0xC595, // 150 ~ 15F
+        0xC085, 0xC181, 0xC281, 0xC385, 0xC481, 0xC585, 0xC685, 0xC781, 0xC889, 0xC98D, 0xD091, 0xD195, 0xD295, 0xD391, 0xD495, 0xD591, // 160 ~ 16F
+        0xD081, 0xD185, 0xD285, 0xD381, 0xD485, 0xD581, 0xD681, 0xD785, 0xD88D, 0xD989, 0xE0B1, 0xE1B5, 0xE2B5, 0xE3B1, 0xE4B5, 0xE5B1, // 170 ~ 17F
+        0xE0A1, 0xE1A5, 0xE2A5, 0xE3A1, 0xE4A5, 0xE5A1, 0xE6A1, 0xE7A5, 0xE8AD, 0xE9A9, 0xF0B5, 0xF1B1, 0xF2B1, 0xF3B5, 0xF4B1, 0xF5B5, // 180 ~ 18F
+        0xF0A5, 0xF1A1, 0xF2A1, 0xF3A5, 0xF4A1, 0xF5A5, 0xF6A5, 0xF7A1, 0xF8A9, 0xF9AD, 0x0055, 0x0111, 0x0211, 0x0315, 0x0411, 0x0515, // 190 ~ 19F
+        0x0045, 0x0101, 0x0201, 0x0305, 0x0401, 0x0505, 0x0605, 0x0701, 0x0809, 0x090D, 0x1011, 0x1115, 0x1215, 0x1311, 0x1415, 0x1511, // 1A0 ~ 1AF
+        0x1001, 0x1105, 0x1205, 0x1301, 0x1405, 0x1501, 0x1601, 0x1705, 0x180D, 0x1909, 0x2031, 0x2135, 0x2235, 0x2331, 0x2435, 0x2531, // 1B0 ~ 1BF
+        0x2021, 0x2125, 0x2225, 0x2321, 0x2425, 0x2521, 0x2621, 0x2725, 0x282D, 0x2929, 0x3035, 0x3131, 0x3231, 0x3335, 0x3431, 0x3535, // 1C0 ~ 1CF
+        0x3025, 0x3121, 0x3221, 0x3325, 0x3421, 0x3525, 0x3625, 0x3721, 0x3829, 0x392D, 0x4011, 0x4115, 0x4215, 0x4311, 0x4415, 0x4511, // 1D0 ~ 1DF
+        0x4001, 0x4105, 0x4205, 0x4301, 0x4405, 0x4501, 0x4601, 0x4705, 0x480D, 0x4909, 0x5015, 0x5111, 0x5211, 0x5315, 0x5411, 0x5515, // 1E0 ~ 1EF
+        0x5005, 0x5101, 0x5201, 0x5305, 0x5401, 0x5505, 0x5605, 0x5701, 0x5809, 0x590D, 0x6035, 0x6131, 0x6231, 0x6335, 0x6431, 0x6535, // 1F0 ~ 1FF
+        0x0604, 0x0700, 0x0808, 0x090C, 0x0A0C, 0x0B08, 0x0C0C, 0x0D08, 0x0E08, 0x0F0C, 0x1010, 0x1114, 0x1214, 0x1310, 0x1414, 0x1510, // 200 ~ 20F
+        0x1600, 0x1704, 0x180C, 0x1908, 0x1A08, 0x1B0C, 0x1C08, 0x1D0C, 0x1E0C, 0x1F08, 0x2030, 0x2134, 0x2234, 0x2330, 0x2434, 0x2530, // 210 ~ 21F
+        0x2620, 0x2724, 0x282C, 0x2928, 0x2A28, 0x2B2C, 0x2C28, 0x2D2C, 0x2E2C, 0x2F28, 0x3034, 0x3130, 0x3230, 0x3334, 0x3430, 0x3534, // 220 ~ 22F
+        0x3624, 0x3720, 0x3828, 0x392C, 0x3A2C, 0x3B28, 0x3C2C, 0x3D28, 0x3E28, 0x3F2C, 0x4010, 0x4114, 0x4214, 0x4310, 0x4414, 0x4510, // 230 ~ 23F
+        0x4600, 0x4704, 0x480C, 0x4908, 0x4A08, 0x4B0C, 0x4C08, 0x4D0C, 0x4E0C, 0x4F08, 0x5014, 0x5110, 0x5210, 0x5314, 0x5410, 0x5514, // 240 ~ 24F
+        0x5604, 0x5700, 0x5808, 0x590C, 0x5A0C, 0x5B08, 0x5C0C, 0x5D08, 0x5E08, 0x5F0C, 0x6034, 0x6130, 0x6230, 0x6334, 0x6430, 0x6534, // 250 ~ 25F
+        0x6624, 0x6720, 0x6828, 0x692C, 0x6A2C, 0x6B28, 0x6C2C, 0x6D28, 0x6E28, 0x6F2C, 0x7030, 0x7134, 0x7234, 0x7330, 0x7434, 0x7530, // 260 ~ 26F
+        0x7620, 0x7724, 0x782C, 0x7928, 0x7A28, 0x7B2C, 0x7C28, 0x7D2C, 0x7E2C, 0x7F28, 0x8090, 0x8194, 0x8294, 0x8390, 0x8494, 0x8590, // 270 ~ 27F
+        0x8680, 0x8784, 0x888C, 0x8988, 0x8A88, 0x8B8C, 0x8C88, 0x8D8C, 0x8E8C, 0x8F88, 0x9094, 0x9190, 0x9290, 0x9394, 0x9490, 0x9594, // 280 ~ 28F
+        0x9684, 0x9780, 0x9888, 0x998C, 0x9A8C, 0x9B88, 0x9C8C, 0x9D88, 0x9E88, 0x9F8C, 0x0055, 0x0111, 0x0211, 0x0315, 0x0411, 0x0515, // 290 ~ 29F
+        0x0605, 0x0701, 0x0809, 0x090D, 0x0A0D, 0x0B09, 0x0C0D, 0x0D09, 0x0E09, 0x0F0D, 0x1011, 0x1115, 0x1215, 0x1311, 0x1415, 0x1511, // 2A0 ~ 2AF
+        0x1601, 0x1705, 0x180D, 0x1909, 0x1A09, 0x1B0D, 0x1C09, 0x1D0D, 0x1E0D, 0x1F09, 0x2031, 0x2135, 0x2235, 0x2331, 0x2435, 0x2531, // 2B0 ~ 2BF
+        0x2621, 0x2725, 0x282D, 0x2929, 0x2A29, 0x2B2D, 0x2C29, 0x2D2D, 0x2E2D, 0x2F29, 0x3035, 0x3131, 0x3231, 0x3335, 0x3431, 0x3535, // 2C0 ~ 2CF
+        0x3625, 0x3721, 0x3829, 0x392D, 0x3A2D, 0x3B29, 0x3C2D, 0x3D29, 0x3E29, 0x3F2D, 0x4011, 0x4115, 0x4215, 0x4311, 0x4415, 0x4511, // 2D0 ~ 2DF
+        0x4601, 0x4705, 0x480D, 0x4909, 0x4A09, 0x4B0D, 0x4C09, 0x4D0D, 0x4E0D, 0x4F09, 0x5015, 0x5111, 0x5211, 0x5315, 0x5411, 0x5515, // 2E0 ~ 2EF
+        0x5605, 0x5701, 0x5809, 0x590D, 0x5A0D, 0x5B09, 0x5C0D, 0x5D09, 0x5E09, 0x5F0D, 0x6035, 0x6131, 0x6231, 0x6335, 0x6431, 0x6535, // 2F0 ~ 2FF
+        0x6625, 0x6721, 0x6829, 0x692D, 0x6A2D, 0x6B29, 0x6C2D, 0x6D29, 0x6E29, 0x6F2D, 0x7031, 0x7135, 0x7235, 0x7331, 0x7435, 0x7531, // 300 ~ 30F
+        0x7621, 0x7725, 0x782D, 0x7929, 0x7A29, 0x7B2D, 0x7C29, 0x7D2D, 0x7E2D, 0x7F29, 0x8091, 0x8195, 0x8295, 0x8391, 0x8495, 0x8591, // 310 ~ 31F
+        0x8681, 0x8785, 0x888D, 0x8989, 0x8A89, 0x8B8D, 0x8C89, 0x8D8D, 0x8E8D, 0x8F89, 0x9095, 0x9191, 0x9291, 0x9395, 0x9491, 0x9595, // 320 ~ 32F
+        0x9685, 0x9781, 0x9889, 0x998D, 0x9A8D, 0x9B89, 0x9C8D, 0x9D89, 0x9E89, 0x9F8D, 0xA0B5, 0xA1B1, 0xA2B1, 0xA3B5, 0xA4B1, 0xA5B5, // 330 ~ 33F
+        0xA6A5, 0xA7A1, 0xA8A9, 0xA9AD, 0xAAAD, 0xABA9, 0xACAD, 0xADA9, 0xAEA9, 0xAFAD, 0xB0B1, 0xB1B5, 0xB2B5, 0xB3B1, 0xB4B5, 0xB5B1, // 340 ~ 34F
+        0xB6A1, 0xB7A5, 0xB8AD, 0xB9A9, 0xBAA9, 0xBBAD, 0xBCA9, 0xBDAD, 0xBEAD, 0xBFA9, 0xC095, 0xC191, 0xC291, 0xC395, 0xC491, 0xC595, // 350 ~ 35F
+        0xC685, 0xC781, 0xC889, 0xC98D, 0xCA8D, 0xCB89, 0xCC8D, 0xCD89, 0xCE89, 0xCF8D, 0xD091, 0xD195, 0xD295, 0xD391, 0xD495, 0xD591, // 360 ~ 36F
+        0xD681, 0xD785, 0xD88D, 0xD989, 0xDA89, 0xDB8D, 0xDC89, 0xDD8D, 0xDE8D, 0xDF89, 0xE0B1, 0xE1B5, 0xE2B5, 0xE3B1, 0xE4B5, 0xE5B1, // 370 ~ 37F
+        0xE6A1, 0xE7A5, 0xE8AD, 0xE9A9, 0xEAA9, 0xEBAD, 0xECA9, 0xEDAD, 0xEEAD, 0xEFA9, 0xF0B5, 0xF1B1, 0xF2B1, 0xF3B5, 0xF4B1, 0xF5B5, // 380 ~ 38F
+        0xF6A5, 0xF7A1, 0xF8A9, 0xF9AD, 0xFAAD, 0xFBA9, 0xFCAD, 0xFDA9, 0xFEA9, 0xFFAD, 0x0055, 0x0111, 0x0211, 0x0315, 0x0411, 0x0515, // 390 ~ 39F
+        0x0605, 0x0701, 0x0809, 0x090D, 0x0A0D, 0x0B09, 0x0C0D, 0x0D09, 0x0E09, 0x0F0D, 0x1011, 0x1115, 0x1215, 0x1311, 0x1415, 0x1511, // 3A0 ~ 3AF
+        0x1601, 0x1705, 0x180D, 0x1909, 0x1A09, 0x1B0D, 0x1C09, 0x1D0D, 0x1E0D, 0x1F09, 0x2031, 0x2135, 0x2235, 0x2331, 0x2435, 0x2531, // 3B0 ~ 3BF
+        0x2621, 0x2725, 0x282D, 0x2929, 0x2A29, 0x2B2D, 0x2C29, 0x2D2D, 0x2E2D, 0x2F29, 0x3035, 0x3131, 0x3231, 0x3335, 0x3431, 0x3535, // 3C0 ~ 3CF
+        0x3625, 0x3721, 0x3829, 0x392D, 0x3A2D, 0x3B29, 0x3C2D, 0x3D29, 0x3E29, 0x3F2D, 0x4011, 0x4115, 0x4215, 0x4311, 0x4415, 0x4511, // 3D0 ~ 3DF
+        0x4601, 0x4705, 0x480D, 0x4909, 0x4A09, 0x4B0D, 0x4C09, 0x4D0D, 0x4E0D, 0x4F09, 0x5015, 0x5111, 0x5211, 0x5315, 0x5411, 0x5515, // 3E0 ~ 3EF
+        0x5605, 0x5701, 0x5809, 0x590D, 0x5A0D, 0x5B09, 0x5C0D, 0x5D09, 0x5E09, 0x5F0D, 0x6035, 0x6131, 0x6231, 0x6335, 0x6431, 0x6535, // 3F0 ~ 3FF
+        0x0046, 0x0102, 0x0202, 0x0306, 0x0402, 0x0506, 0x0606, 0x0702, 0x080A, 0x090E, 0x0402, 0x0506, 0x0606, 0x0702, 0x080A, 0x090E, // 400 ~ 40F
+        0x1002, 0x1106, 0x1206, 0x1302, 0x1406, 0x1502, 0x1602, 0x1706, 0x180E, 0x190A, 0x1406, 0x1502, 0x1602, 0x1706, 0x180E, 0x190A, // 410 ~ 41F
+        0x2022, 0x2126, 0x2226, 0x2322, 0x2426, 0x2522, 0x2622, 0x2726, 0x282E, 0x292A, 0x2426, 0x2522, 0x2622, 0x2726, 0x282E, 0x292A, // 420 ~ 42F
+        0x3026, 0x3122, 0x3222, 0x3326, 0x3422, 0x3526, 0x3626, 0x3722, 0x382A, 0x392E, 0x3422, 0x3526, 0x3626, 0x3722, 0x382A, 0x392E, // 430 ~ 43F
+        0x4002, 0x4106, 0x4206, 0x4302, 0x4406, 0x4502, 0x4602, 0x4706, 0x480E, 0x490A, 0x4406, 0x4502, 0x4602, 0x4706, 0x480E, 0x490A, // 440 ~ 44F
+        0x5006, 0x5102, 0x5202, 0x5306, 0x5402, 0x5506, 0x5606, 0x5702, 0x580A, 0x590E, 0x5402, 0x5506, 0x5606, 0x5702, 0x580A, 0x590E, // 450 ~ 45F
+        0x6026, 0x6122, 0x6222, 0x6326, 0x6422, 0x6526, 0x6626, 0x6722, 0x682A, 0x692E, 0x6422, 0x6526, 0x6626, 0x6722, 0x682A, 0x692E, // 460 ~ 46F
+        0x7022, 0x7126, 0x7226, 0x7322, 0x7426, 0x7522, 0x7622, 0x7726, 0x782E, 0x792A, 0x7426, 0x7522, 0x7622, 0x7726, 0x782E, 0x792A, // 470 ~ 47F
+        0x8082, 0x8186, 0x8286, 0x8382, 0x8486, 0x8582, 0x8682, 0x8786, 0x888E, 0x898A, 0x8486, 0x8582, 0x8682, 0x8786, 0x888E, 0x898A, // 480 ~ 48F
+        0x9086, 0x9182, 0x9282, 0x9386, 0x9482, 0x9586, 0x9686, 0x9782, 0x988A, 0x998E, 0x3423, 0x3527, 0x3627, 0x3723, 0x382B, 0x392F, // 490 ~ 49F
+        0x4003, 0x4107, 0x4207, 0x4303, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, // 4A0 ~ 4AF
+        0x5007, 0x5103, 0x5203, 0x5307, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, // 4B0 ~ 4BF
+        0x6027, 0x6123, 0x6223, 0x6327, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, // 4C0 ~ 4CF
+        0x7023, 0x7127, 0x7227, 0x7323, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, // 4D0 ~ 4DF
+        0x8083, 0x8187, 0x8287, 0x8383, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, // 4E0 ~ 4EF
+        0x9087, 0x9183, 0x9283, 0x9387, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F, // 4F0 ~ 4FF
+        0xA0A7, 0xA1A3, 0xA2A3, 0xA3A7, 0xA4A3, 0xA5A7, 0xA6A7, 0xA7A3, 0xA8AB, 0xA9AF, 0xA4A3, 0xA5A7, 0xA6A7, 0xA7A3, 0xA8AB, 0xA9AF, // 500 ~ 50F
+        0xB0A3, 0xB1A7, 0xB2A7, 0xB3A3, 0xB4A7, 0xB5A3, 0xB6A3, 0xB7A7, 0xB8AF, 0xB9AB, 0xB4A7, 0xB5A3, 0xB6A3, 0xB7A7, 0xB8AF, 0xB9AB, // 510 ~ 51F
+        0xC087, 0xC183, 0xC283, 0xC387, 0xC483, 0xC587, 0xC687, 0xC783, 0xC88B, 0xC98F, 0xC483, 0xC587, 0xC687, 0xC783, 0xC88B, 0xC98F, // 520 ~ 52F
+        0xD083, 0xD187, 0xD287, 0xD383, 0xD487, 0xD583, 0xD683, 0xD787, 0xD88F, 0xD98B, 0xD487, 0xD583, 0xD683, 0xD787, 0xD88F, 0xD98B, // 530 ~ 53F
+        0xE0A3, 0xE1A7, 0xE2A7, 0xE3A3, 0xE4A7, 0xE5A3, 0xE6A3, 0xE7A7, 0xE8AF, 0xE9AB, 0xE4A7, 0xE5A3, 0xE6A3, 0xE7A7, 0xE8AF, 0xE9AB, // 540 ~ 54F
+        0xF0A7, 0xF1A3, 0xF2A3, 0xF3A7, 0xF4A3, 0xF5A7, 0xF6A7, 0xF7A3, 0xF8AB, 0xF9AF, 0xF4A3, 0xF5A7, 0xF6A7, 0xF7A3, 0xF8AB, 0xF9AF, // 550 ~ 55F
+        0x0047, 0x0103, 0x0203, 0x0307, 0x0403, 0x0507, 0x0607, 0x0703, 0x080B, 0x090F, 0x0403, 0x0507, 0x0607, 0x0703, 0x080B, 0x090F, // 560 ~ 56F
+        0x1003, 0x1107, 0x1207, 0x1303, 0x1407, 0x1503, 0x1603, 0x1707, 0x180F, 0x190B, 0x1407, 0x1503, 0x1603, 0x1707, 0x180F, 0x190B, // 570 ~ 57F
+        0x2023, 0x2127, 0x2227, 0x2323, 0x2427, 0x2523, 0x2623, 0x2727, 0x282F, 0x292B, 0x2427, 0x2523, 0x2623, 0x2727, 0x282F, 0x292B, // 580 ~ 58F
+        0x3027, 0x3123, 0x3223, 0x3327, 0x3423, 0x3527, 0x3627, 0x3723, 0x382B, 0x392F, 0x3423, 0x3527, 0x3627, 0x3723, 0x382B, 0x392F, // 590 ~ 59F
+        0x4003, 0x4107, 0x4207, 0x4303, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, // 5A0 ~ 5AF
+        0x5007, 0x5103, 0x5203, 0x5307, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, // 5B0 ~ 5BF
+        0x6027, 0x6123, 0x6223, 0x6327, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, // 5C0 ~ 5CF
+        0x7023, 0x7127, 0x7227, 0x7323, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, // 5D0 ~ 5DF
+        0x8083, 0x8187, 0x8287, 0x8383, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, // 5E0 ~ 5EF
+        0x9087, 0x9183, 0x9283, 0x9387, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F, // 5F0 ~ 5FF
+        0xFABE, 0xFBBA, 0xFCBE, 0xFDBA, 0xFEBA, 0xFFBE, 0x0046, 0x0102, 0x0202, 0x0306, 0x0402, 0x0506, 0x0606, 0x0702, 0x080A, 0x090E, // 600 ~ 60F
+        0x0A1E, 0x0B1A, 0x0C1E, 0x0D1A, 0x0E1A, 0x0F1E, 0x1002, 0x1106, 0x1206, 0x1302, 0x1406, 0x1502, 0x1602, 0x1706, 0x180E, 0x190A, // 610 ~ 61F
+        0x1A1A, 0x1B1E, 0x1C1A, 0x1D1E, 0x1E1E, 0x1F1A, 0x2022, 0x2126, 0x2226, 0x2322, 0x2426, 0x2522, 0x2622, 0x2726, 0x282E, 0x292A, // 620 ~ 62F
+        0x2A3A, 0x2B3E, 0x2C3A, 0x2D3E, 0x2E3E, 0x2F3A, 0x3026, 0x3122, 0x3222, 0x3326, 0x3422, 0x3526, 0x3626, 0x3722, 0x382A, 0x392E, // 630 ~ 63F
+        0x3A3E, 0x3B3A, 0x3C3E, 0x3D3A, 0x3E3A, 0x3F3E, 0x4002, 0x4106, 0x4206, 0x4302, 0x4406, 0x4502, 0x4602, 0x4706, 0x480E, 0x490A, // 640 ~ 64F
+        0x4A1A, 0x4B1E, 0x4C1A, 0x4D1E, 0x4E1E, 0x4F1A, 0x5006, 0x5102, 0x5202, 0x5306, 0x5402, 0x5506, 0x5606, 0x5702, 0x580A, 0x590E, // 650 ~ 65F
+        0x5A1E, 0x5B1A, 0x5C1E, 0x5D1A, 0x5E1A, 0x5F1E, 0x6026, 0x6122, 0x6222, 0x6326, 0x6422, 0x6526, 0x6626, 0x6722, 0x682A, 0x692E, // 660 ~ 66F
+        0x6A3E, 0x6B3A, 0x6C3E, 0x6D3A, 0x6E3A, 0x6F3E, 0x7022, 0x7126, 0x7226, 0x7322, 0x7426, 0x7522, 0x7622, 0x7726, 0x782E, 0x792A, // 670 ~ 67F
+        0x7A3A, 0x7B3E, 0x7C3A, 0x7D3E, 0x7E3E, 0x7F3A, 0x8082, 0x8186, 0x8286, 0x8382, 0x8486, 0x8582, 0x8682, 0x8786, 0x888E, 0x898A, // 680 ~ 68F
+        0x8A9A, 0x8B9E, 0x8C9A, 0x8D9E, 0x8E9E, 0x8F9A, 0x9086, 0x9182, 0x9282, 0x9386, 0x3423, 0x3527, 0x3627, 0x3723, 0x382B, 0x392F, // 690 ~ 69F
+        0x3A3F, 0x3B3B, 0x3C3F, 0x3D3B, 0x3E3B, 0x3F3F, 0x4003, 0x4107, 0x4207, 0x4303, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, // 6A0 ~ 6AF
+        0x4A1B, 0x4B1F, 0x4C1B, 0x4D1F, 0x4E1F, 0x4F1B, 0x5007, 0x5103, 0x5203, 0x5307, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, // 6B0 ~ 6BF
+        0x5A1F, 0x5B1B, 0x5C1F, 0x5D1B, 0x5E1B, 0x5F1F, 0x6027, 0x6123, 0x6223, 0x6327, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, // 6C0 ~ 6CF
+        0x6A3F, 0x6B3B, 0x6C3F, 0x6D3B, 0x6E3B, 0x6F3F, 0x7023, 0x7127, 0x7227, 0x7323, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, // 6D0 ~ 6DF
+        0x7A3B, 0x7B3F, 0x7C3B, 0x7D3F, 0x7E3F, 0x7F3B, 0x8083, 0x8187, 0x8287, 0x8383, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, // 6E0 ~ 6EF
+        0x8A9B, 0x8B9F, 0x8C9B, 0x8D9F, 0x8E9F, 0x8F9B, 0x9087, 0x9183, 0x9283, 0x9387, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F, // 6F0 ~ 6FF
+        0x9A9F, 0x9B9B, 0x9C9F, 0x9D9B, 0x9E9B, 0x9F9F, 0xA0A7, 0xA1A3, 0xA2A3, 0xA3A7, 0xA4A3, 0xA5A7, 0xA6A7, 0xA7A3, 0xA8AB, 0xA9AF, // 700 ~ 70F
+        0xAABF, 0xABBB, 0xACBF, 0xADBB, 0xAEBB, 0xAFBF, 0xB0A3, 0xB1A7, 0xB2A7, 0xB3A3, 0xB4A7, 0xB5A3, 0xB6A3, 0xB7A7, 0xB8AF, 0xB9AB, // 710 ~ 71F
+        0xBABB, 0xBBBF, 0xBCBB, 0xBDBF, 0xBEBF, 0xBFBB, 0xC087, 0xC183, 0xC283, 0xC387, 0xC483, 0xC587, 0xC687, 0xC783, 0xC88B, 0xC98F, // 720 ~ 72F
+        0xCA9F, 0xCB9B, 0xCC9F, 0xCD9B, 0xCE9B, 0xCF9F, 0xD083, 0xD187, 0xD287, 0xD383, 0xD487, 0xD583, 0xD683, 0xD787, 0xD88F, 0xD98B, // 730 ~ 73F
+        0xDA9B, 0xDB9F, 0xDC9B, 0xDD9F, 0xDE9F, 0xDF9B, 0xE0A3, 0xE1A7, 0xE2A7, 0xE3A3, 0xE4A7, 0xE5A3, 0xE6A3, 0xE7A7, 0xE8AF, 0xE9AB, // 740 ~ 74F
+        0xEABB, 0xEBBF, 0xECBB, 0xEDBF, 0xEEBF, 0xEFBB, 0xF0A7, 0xF1A3, 0xF2A3, 0xF3A7, 0xF4A3, 0xF5A7, 0xF6A7, 0xF7A3, 0xF8AB, 0xF9AF, // 750 ~ 75F
+        0xFABF, 0xFBBB, 0xFCBF, 0xFDBB, 0xFEBB, 0xFFBF, 0x0047, 0x0103, 0x0203, 0x0307, 0x0403, 0x0507, 0x0607, 0x0703, 0x080B, 0x090F, // 760 ~ 76F
+        0x0A1F, 0x0B1B, 0x0C1F, 0x0D1B, 0x0E1B, 0x0F1F, 0x1003, 0x1107, 0x1207, 0x1303, 0x1407, 0x1503, 0x1603, 0x1707, 0x180F, 0x190B, // 770 ~ 77F
+        0x1A1B, 0x1B1F, 0x1C1B, 0x1D1F, 0x1E1F, 0x1F1B, 0x2023, 0x2127, 0x2227, 0x2323, 0x2427, 0x2523, 0x2623, 0x2727, 0x282F, 0x292B, // 780 ~ 78F
+        0x2A3B, 0x2B3F, 0x2C3B, 0x2D3F, 0x2E3F, 0x2F3B, 0x3027, 0x3123, 0x3223, 0x3327, 0x3423, 0x3527, 0x3627, 0x3723, 0x382B, 0x392F, // 790 ~ 79F
+        0x3A3F, 0x3B3B, 0x3C3F, 0x3D3B, 0x3E3B, 0x3F3F, 0x4003, 0x4107, 0x4207, 0x4303, 0x4407, 0x4503, 0x4603, 0x4707, 0x480F, 0x490B, // 7A0 ~ 7AF
+        0x4A1B, 0x4B1F, 0x4C1B, 0x4D1F, 0x4E1F, 0x4F1B, 0x5007, 0x5103, 0x5203, 0x5307, 0x5403, 0x5507, 0x5607, 0x5703, 0x580B, 0x590F, // 7B0 ~ 7BF
+        0x5A1F, 0x5B1B, 0x5C1F, 0x5D1B, 0x5E1B, 0x5F1F, 0x6027, 0x6123, 0x6223, 0x6327, 0x6423, 0x6527, 0x6627, 0x6723, 0x682B, 0x692F, // 7C0 ~ 7CF
+        0x6A3F, 0x6B3B, 0x6C3F, 0x6D3B, 0x6E3B, 0x6F3F, 0x7023, 0x7127, 0x7227, 0x7323, 0x7427, 0x7523, 0x7623, 0x7727, 0x782F, 0x792B, // 7D0 ~ 7DF
+        0x7A3B, 0x7B3F, 0x7C3B, 0x7D3F, 0x7E3F, 0x7F3B, 0x8083, 0x8187, 0x8287, 0x8383, 0x8487, 0x8583, 0x8683, 0x8787, 0x888F, 0x898B, // 7E0 ~ 7EF
+        0x8A9B, 0x8B9F, 0x8C9B, 0x8D9F, 0x8E9F, 0x8F9B, 0x9087, 0x9183, 0x9283, 0x9387, 0x9483, 0x9587, 0x9687, 0x9783, 0x988B, 0x998F  // 7F0 ~ 7FF
+    };
+    // attributes of the operation code in the instruction tables (nullptr mnemonic: unknown, or the prefix of CB and DD CB / FD CB)
+    struct InstructionInfo {
+        const char* mnemonic;
+        unsigned char length;
+        unsigned char operand;
+        unsigned char clocks;
+        unsigned char branchClocks;
+    };
+    // instruction tables of decode (unprefixed, CB, ED, DD or FD, and DD CB d or FD CB d)
+    static constexpr InstructionInfo instructionTable1[256] = {
+        {"NOP", 1, OPERAND_NONE, 4, 0}, {"LD BC, nn", 3, OPERAND_WORD, 10, 0}, {"LD (BC), A", 1, OPERAND_NONE, 7, 0}, {"INC BC", 1, OPERAND_NONE, 6, 0}, // 00 ~ 03
+        {"INC B", 1, OPERAND_NONE, 4, 0}, {"DEC B", 1, OPERAND_NONE, 4, 0}, {"LD B, n", 2, OPERAND_BYTE, 7, 0}, {"RLCA", 1, OPERAND_NONE, 4, 0}, // 04 ~ 07
+        {"EX AF, AF'", 1, OPERAND_NONE, 4, 0}, {"ADD HL, BC", 1, OPERAND_NONE, 11, 0}, {"LD A, (BC)", 1, OPERAND_NONE, 7, 0}, {"DEC BC", 1, OPERAND_NONE, 6, 0}, // 08 ~ 0B
+        {"INC C", 1, OPERAND_NONE, 4, 0}, {"DEC C", 1, OPERAND_NONE, 4, 0}, {"LD C, n", 2, OPERAND_BYTE, 7, 0}, {"RRCA", 1, OPERAND_NONE, 4, 0}, // 0C ~ 0F
+        {"DJNZ e", 2, OPERAND_RELATIVE, 8, 13}, {"LD DE, nn", 3, OPERAND_WORD, 10, 0}, {"LD (DE), A", 1, OPERAND_NONE, 7, 0}, {"INC DE", 1, OPERAND_NONE, 6, 0}, // 10 ~ 13
+        {"INC D", 1, OPERAND_NONE, 4, 0}, {"DEC D", 1, OPERAND_NONE, 4, 0}, {"LD D, n", 2, OPERAND_BYTE, 7, 0}, {"RLA", 1, OPERAND_NONE, 4, 0}, // 14 ~ 17
+        {"JR e", 2, OPERAND_RELATIVE, 12, 0}, {"ADD HL, DE", 1, OPERAND_NONE, 11, 0}, {"LD A, (DE)", 1, OPERAND_NONE, 7, 0}, {"DEC DE", 1, OPERAND_NONE, 6, 0}, // 18 ~ 1B
+        {"INC E", 1, OPERAND_NONE, 4, 0}, {"DEC E", 1, OPERAND_NONE, 4, 0}, {"LD E, n", 2, OPERAND_BYTE, 7, 0}, {"RRA", 1, OPERAND_NONE, 4, 0}, // 1C ~ 1F
+        {"JR NZ, e", 2, OPERAND_RELATIVE, 7, 12}, {"LD HL, nn", 3, OPERAND_WORD, 10, 0}, {"LD (nn), HL", 3, OPERAND_WORD, 16, 0}, {"INC HL", 1, OPERAND_NONE, 6, 0}, // 20 ~ 23
+        {"INC H", 1, OPERAND_NONE, 4, 0}, {"DEC H", 1, OPERAND_NONE, 4, 0}, {"LD H, n", 2, OPERAND_BYTE, 7, 0}, {"DAA", 1, OPERAND_NONE, 4, 0}, // 24 ~ 27
+        {"JR Z, e", 2, OPERAND_RELATIVE, 7, 12}, {"ADD HL, HL", 1, OPERAND_NONE, 11, 0}, {"LD HL, (nn)", 3, OPERAND_WORD, 16, 0}, {"DEC HL", 1, OPERAND_NONE, 6, 0}, // 28 ~ 2B
+        {"INC L", 1, OPERAND_NONE, 4, 0}, {"DEC L", 1, OPERAND_NONE, 4, 0}, {"LD L, n", 2, OPERAND_BYTE, 7, 0}, {"CPL", 1, OPERAND_NONE, 4, 0}, // 2C ~ 2F
+        {"JR NC, e", 2, OPERAND_RELATIVE, 7, 12}, {"LD SP, nn", 3, OPERAND_WORD, 10, 0}, {"LD (nn), A", 3, OPERAND_WORD, 13, 0}, {"INC SP", 1, OPERAND_NONE, 6, 0}, // 30 ~ 33
+        {"INC (HL)", 1, OPERAND_NONE, 11, 0}, {"DEC (HL)", 1, OPERAND_NONE, 11, 0}, {"LD (HL), n", 2, OPERAND_BYTE, 10, 0}, {"SCF", 1, OPERAND_NONE, 4, 0}, // 34 ~ 37
+        {"JR C, e", 2, OPERAND_RELATIVE, 7, 12}, {"ADD HL, SP", 1, OPERAND_NONE, 11, 0}, {"LD A, (nn)", 3, OPERAND_WORD, 13, 0}, {"DEC SP", 1, OPERAND_NONE, 6, 0}, // 38 ~ 3B
+        {"INC A", 1, OPERAND_NONE, 4, 0}, {"DEC A", 1, OPERAND_NONE, 4, 0}, {"LD A, n", 2, OPERAND_BYTE, 7, 0}, {"CCF", 1, OPERAND_NONE, 4, 0}, // 3C ~ 3F
+        {"LD B, B", 1, OPERAND_NONE, 4, 0}, {"LD B, C", 1, OPERAND_NONE, 4, 0}, {"LD B, D", 1, OPERAND_NONE, 4, 0}, {"LD B, E", 1, OPERAND_NONE, 4, 0}, // 40 ~ 43
+        {"LD B, H", 1, OPERAND_NONE, 4, 0}, {"LD B, L", 1, OPERAND_NONE, 4, 0}, {"LD B, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD B, A", 1, OPERAND_NONE, 4, 0}, // 44 ~ 47
+        {"LD C, B", 1, OPERAND_NONE, 4, 0}, {"LD C, C", 1, OPERAND_NONE, 4, 0}, {"LD C, D", 1, OPERAND_NONE, 4, 0}, {"LD C, E", 1, OPERAND_NONE, 4, 0}, // 48 ~ 4B
+        {"LD C, H", 1, OPERAND_NONE, 4, 0}, {"LD C, L", 1, OPERAND_NONE, 4, 0}, {"LD C, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD C, A", 1, OPERAND_NONE, 4, 0}, // 4C ~ 4F
+        {"LD D, B", 1, OPERAND_NONE, 4, 0}, {"LD D, C", 1, OPERAND_NONE, 4, 0}, {"LD D, D", 1, OPERAND_NONE, 4, 0}, {"LD D, E", 1, OPERAND_NONE, 4, 0}, // 50 ~ 53
+        {"LD D, H", 1, OPERAND_NONE, 4, 0}, {"LD D, L", 1, OPERAND_NONE, 4, 0}, {"LD D, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD D, A", 1, OPERAND_NONE, 4, 0}, // 54 ~ 57
+        {"LD E, B", 1, OPERAND_NONE, 4, 0}, {"LD E, C", 1, OPERAND_NONE, 4, 0}, {"LD E, D", 1, OPERAND_NONE, 4, 0}, {"LD E, E", 1, OPERAND_NONE, 4, 0}, // 58 ~ 5B
+        {"LD E, H", 1, OPERAND_NONE, 4, 0}, {"LD E, L", 1, OPERAND_NONE, 4, 0}, {"LD E, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD E, A", 1, OPERAND_NONE, 4, 0}, // 5C ~ 5F
+        {"LD H, B", 1, OPERAND_NONE, 4, 0}, {"LD H, C", 1, OPERAND_NONE, 4, 0}, {"LD H, D", 1, OPERAND_NONE, 4, 0}, {"LD H, E", 1, OPERAND_NONE, 4, 0}, // 60 ~ 63
+        {"LD H, H", 1, OPERAND_NONE, 4, 0}, {"LD H, L", 1, OPERAND_NONE, 4, 0}, {"LD H, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD H, A", 1, OPERAND_NONE, 4, 0}, // 64 ~ 67
+        {"LD L, B", 1, OPERAND_NONE, 4, 0}, {"LD L, C", 1, OPERAND_NONE, 4, 0}, {"LD L, D", 1, OPERAND_NONE, 4, 0}, {"LD L, E", 1, OPERAND_NONE, 4, 0}, // 68 ~ 6B
+        {"LD L, H", 1, OPERAND_NONE, 4, 0}, {"LD L, L", 1, OPERAND_NONE, 4, 0}, {"LD L, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD L, A", 1, OPERAND_NONE, 4, 0}, // 6C ~ 6F
+        {"LD (HL), B", 1, OPERAND_NONE, 7, 0}, {"LD (HL), C", 1, OPERAND_NONE, 7, 0}, {"LD (HL), D", 1, OPERAND_NONE, 7, 0}, {"LD (HL), E", 1, OPERAND_NONE, 7, 0}, // 70 ~ 73
+        {"LD (HL), H", 1, OPERAND_NONE, 7, 0}, {"LD (HL), L", 1, OPERAND_NONE, 7, 0}, {"HALT", 1, OPERAND_NONE, 4, 0}, {"LD (HL), A", 1, OPERAND_NONE, 7, 0}, // 74 ~ 77
+        {"LD A, B", 1, OPERAND_NONE, 4, 0}, {"LD A, C", 1, OPERAND_NONE, 4, 0}, {"LD A, D", 1, OPERAND_NONE, 4, 0}, {"LD A, E", 1, OPERAND_NONE, 4, 0}, // 78 ~ 7B
+        {"LD A, H", 1, OPERAND_NONE, 4, 0}, {"LD A, L", 1, OPERAND_NONE, 4, 0}, {"LD A, (HL)", 1, OPERAND_NONE, 7, 0}, {"LD A, A", 1, OPERAND_NONE, 4, 0}, // 7C ~ 7F
+        {"ADD A, B", 1, OPERAND_NONE, 4, 0}, {"ADD A, C", 1, OPERAND_NONE, 4, 0}, {"ADD A, D", 1, OPERAND_NONE, 4, 0}, {"ADD A, E", 1, OPERAND_NONE, 4, 0}, // 80 ~ 83
+        {"ADD A, H", 1, OPERAND_NONE, 4, 0}, {"ADD A, L", 1, OPERAND_NONE, 4, 0}, {"ADD A, (HL)", 1, OPERAND_NONE, 7, 0}, {"ADD A, A", 1, OPERAND_NONE, 4, 0}, // 84 ~ 87
+        {"ADC A, B", 1, OPERAND_NONE, 4, 0}, {"ADC A, C", 1, OPERAND_NONE, 4, 0}, {"ADC A, D", 1, OPERAND_NONE, 4, 0}, {"ADC A, E", 1, OPERAND_NONE, 4, 0}, // 88 ~ 8B
+        {"ADC A, H", 1, OPERAND_NONE, 4, 0}, {"ADC A, L", 1, OPERAND_NONE, 4, 0}, {"ADC A, (HL)", 1, OPERAND_NONE, 7, 0}, {"ADC A, A", 1, OPERAND_NONE, 4, 0}, // 8C ~ 8F
+        {"SUB B", 1, OPERAND_NONE, 4, 0}, {"SUB C", 1, OPERAND_NONE, 4, 0}, {"SUB D", 1, OPERAND_NONE, 4, 0}, {"SUB E", 1, OPERAND_NONE, 4, 0}, // 90 ~ 93
+        {"SUB H", 1, OPERAND_NONE, 4, 0}, {"SUB L", 1, OPERAND_NONE, 4, 0}, {"SUB (HL)", 1, OPERAND_NONE, 7, 0}, {"SUB A", 1, OPERAND_NONE, 4, 0}, // 94 ~ 97
+        {"SBC A, B", 1, OPERAND_NONE, 4, 0}, {"SBC A, C", 1, OPERAND_NONE, 4, 0}, {"SBC A, D", 1, OPERAND_NONE, 4, 0}, {"SBC A, E", 1, OPERAND_NONE, 4, 0}, // 98 ~ 9B
+        {"SBC A, H", 1, OPERAND_NONE, 4, 0}, {"SBC A, L", 1, OPERAND_NONE, 4, 0}, {"SBC A, (HL)", 1, OPERAND_NONE, 7, 0}, {"SBC A, A", 1, OPERAND_NONE, 4, 0}, // 9C ~ 9F
+        {"AND B", 1, OPERAND_NONE, 4, 0}, {"AND C", 1, OPERAND_NONE, 4, 0}, {"AND D", 1, OPERAND_NONE, 4, 0}, {"AND E", 1, OPERAND_NONE, 4, 0}, // A0 ~ A3
+        {"AND H", 1, OPERAND_NONE, 4, 0}, {"AND L", 1, OPERAND_NONE, 4, 0}, {"AND (HL)", 1, OPERAND_NONE, 7, 0}, {"AND A", 1, OPERAND_NONE, 4, 0}, // A4 ~ A7
+        {"XOR B", 1, OPERAND_NONE, 4, 0}, {"XOR C", 1, OPERAND_NONE, 4, 0}, {"XOR D", 1, OPERAND_NONE, 4, 0}, {"XOR E", 1, OPERAND_NONE, 4, 0}, // A8 ~ AB
+        {"XOR H", 1, OPERAND_NONE, 4, 0}, {"XOR L", 1, OPERAND_NONE, 4, 0}, {"XOR (HL)", 1, OPERAND_NONE, 7, 0}, {"XOR A", 1, OPERAND_NONE, 4, 0}, // AC ~ AF
+        {"OR B", 1, OPERAND_NONE, 4, 0}, {"OR C", 1, OPERAND_NONE, 4, 0}, {"OR D", 1, OPERAND_NONE, 4, 0}, {"OR E", 1, OPERAND_NONE, 4, 0}, // B0 ~ B3
+        {"OR H", 1, OPERAND_NONE, 4, 0}, {"OR L", 1, OPERAND_NONE, 4, 0}, {"OR (HL)", 1, OPERAND_NONE, 7, 0}, {"OR A", 1, OPERAND_NONE, 4, 0}, // B4 ~ B7
+        {"CP B", 1, OPERAND_NONE, 4, 0}, {"CP C", 1, OPERAND_NONE, 4, 0}, {"CP D", 1, OPERAND_NONE, 4, 0}, {"CP E", 1, OPERAND_NONE, 4, 0}, // B8 ~ BB
+        {"CP H", 1, OPERAND_NONE, 4, 0}, {"CP L", 1, OPERAND_NONE, 4, 0}, {"CP (HL)", 1, OPERAND_NONE, 7, 0}, {"CP A", 1, OPERAND_NONE, 4, 0}, // BC ~ BF
+        {"RET NZ", 1, OPERAND_NONE, 5, 11}, {"POP BC", 1, OPERAND_NONE, 10, 0}, {"JP NZ, nn", 3, OPERAND_WORD, 10, 10}, {"JP nn", 3, OPERAND_WORD, 10, 0}, // C0 ~ C3
+        {"CALL NZ, nn", 3, OPERAND_WORD, 10, 17}, {"PUSH BC", 1, OPERAND_NONE, 11, 0}, {"ADD A, n", 2, OPERAND_BYTE, 7, 0}, {"RST $00", 1, OPERAND_NONE, 11, 0}, // C4 ~ C7
+        {"RET Z", 1, OPERAND_NONE, 5, 11}, {"RET", 1, OPERAND_NONE, 10, 0}, {"JP Z, nn", 3, OPERAND_WORD, 10, 10}, {nullptr, 2, OPERAND_NONE, 0, 0}, // C8 ~ CB
+        {"CALL Z, nn", 3, OPERAND_WORD, 10, 17}, {"CALL nn", 3, OPERAND_WORD, 17, 0}, {"ADC A, n", 2, OPERAND_BYTE, 7, 0}, {"RST $08", 1, OPERAND_NONE, 11, 0}, // CC ~ CF
+        {"RET NC", 1, OPERAND_NONE, 5, 11}, {"POP DE", 1, OPERAND_NONE, 10, 0}, {"JP NC, nn", 3, OPERAND_WORD, 10, 10}, {"OUT (n), A", 2, OPERAND_BYTE, 11, 0}, // D0 ~ D3
+        {"CALL NC, nn", 3, OPERAND_WORD, 10, 17}, {"PUSH DE", 1, OPERAND_NONE, 11, 0}, {"SUB n", 2, OPERAND_BYTE, 7, 0}, {"RST $10", 1, OPERAND_NONE, 11, 0}, // D4 ~ D7
+        {"RET C", 1, OPERAND_NONE, 5, 11}, {"EXX", 1, OPERAND_NONE, 4, 0}, {"JP C, nn", 3, OPERAND_WORD, 10, 10}, {"IN A, (n)", 2, OPERAND_BYTE, 11, 0}, // D8 ~ DB
+        {"CALL C, nn", 3, OPERAND_WORD, 10, 17}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"SBC A, n", 2, OPERAND_BYTE, 7, 0}, {"RST $18", 1, OPERAND_NONE, 11, 0}, // DC ~ DF
+        {"RET PO", 1, OPERAND_NONE, 5, 11}, {"POP HL", 1, OPERAND_NONE, 10, 0}, {"JP PO, nn", 3, OPERAND_WORD, 10, 10}, {"EX (SP), HL", 1, OPERAND_NONE, 19, 0}, // E0 ~ E3
+        {"CALL PO, nn", 3, OPERAND_WORD, 10, 17}, {"PUSH HL", 1, OPERAND_NONE, 11, 0}, {"AND n", 2, OPERAND_BYTE, 7, 0}, {"RST $20", 1, OPERAND_NONE, 11, 0}, // E4 ~ E7
+        {"RET PE", 1, OPERAND_NONE, 5, 11}, {"JP (HL)", 1, OPERAND_NONE, 4, 0}, {"JP PE, nn", 3, OPERAND_WORD, 10, 10}, {"EX DE, HL", 1, OPERAND_NONE, 4, 0}, // E8 ~ EB
+        {"CALL PE, nn", 3, OPERAND_WORD, 10, 17}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"XOR n", 2, OPERAND_BYTE, 7, 0}, {"RST $28", 1, OPERAND_NONE, 11, 0}, // EC ~ EF
+        {"RET P", 1, OPERAND_NONE, 5, 11}, {"POP AF", 1, OPERAND_NONE, 10, 0}, {"JP P, nn", 3, OPERAND_WORD, 10, 10}, {"DI", 1, OPERAND_NONE, 4, 0}, // F0 ~ F3
+        {"CALL P, nn", 3, OPERAND_WORD, 10, 17}, {"PUSH AF", 1, OPERAND_NONE, 11, 0}, {"OR n", 2, OPERAND_BYTE, 7, 0}, {"RST $30", 1, OPERAND_NONE, 11, 0}, // F4 ~ F7
+        {"RET M", 1, OPERAND_NONE, 5, 11}, {"LD SP, HL", 1, OPERAND_NONE, 6, 0}, {"JP M, nn", 3, OPERAND_WORD, 10, 10}, {"EI", 1, OPERAND_NONE, 4, 0}, // F8 ~ FB
+        {"CALL M, nn", 3, OPERAND_WORD, 10, 17}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"CP n", 2, OPERAND_BYTE, 7, 0}, {"RST $38", 1, OPERAND_NONE, 11, 0}  // FC ~ FF
+    };
+    static constexpr InstructionInfo instructionTableCB[256] = {
+        {"RLC B", 2, OPERAND_NONE, 8, 0}, {"RLC C", 2, OPERAND_NONE, 8, 0}, {"RLC D", 2, OPERAND_NONE, 8, 0}, {"RLC E", 2, OPERAND_NONE, 8, 0}, // 00 ~ 03
+        {"RLC H", 2, OPERAND_NONE, 8, 0}, {"RLC L", 2, OPERAND_NONE, 8, 0}, {"RLC (HL)", 2, OPERAND_NONE, 15, 0}, {"RLC A", 2, OPERAND_NONE, 8, 0}, // 04 ~ 07
+        {"RRC B", 2, OPERAND_NONE, 8, 0}, {"RRC C", 2, OPERAND_NONE, 8, 0}, {"RRC D", 2, OPERAND_NONE, 8, 0}, {"RRC E", 2, OPERAND_NONE, 8, 0}, // 08 ~ 0B
+        {"RRC H", 2, OPERAND_NONE, 8, 0}, {"RRC L", 2, OPERAND_NONE, 8, 0}, {"RRC (HL)", 2, OPERAND_NONE, 15, 0}, {"RRC A", 2, OPERAND_NONE, 8, 0}, // 0C ~ 0F
+        {"RL B", 2, OPERAND_NONE, 8, 0}, {"RL C", 2, OPERAND_NONE, 8, 0}, {"RL D", 2, OPERAND_NONE, 8, 0}, {"RL E", 2, OPERAND_NONE, 8, 0}, // 10 ~ 13
+        {"RL H", 2, OPERAND_NONE, 8, 0}, {"RL L", 2, OPERAND_NONE, 8, 0}, {"RL (HL)", 2, OPERAND_NONE, 15, 0}, {"RL A", 2, OPERAND_NONE, 8, 0}, // 14 ~ 17
+        {"RR B", 2, OPERAND_NONE, 8, 0}, {"RR C", 2, OPERAND_NONE, 8, 0}, {"RR D", 2, OPERAND_NONE, 8, 0}, {"RR E", 2, OPERAND_NONE, 8, 0}, // 18 ~ 1B
+        {"RR H", 2, OPERAND_NONE, 8, 0}, {"RR L", 2, OPERAND_NONE, 8, 0}, {"RR (HL)", 2, OPERAND_NONE, 15, 0}, {"RR A", 2, OPERAND_NONE, 8, 0}, // 1C ~ 1F
+        {"SLA B", 2, OPERAND_NONE, 8, 0}, {"SLA C", 2, OPERAND_NONE, 8, 0}, {"SLA D", 2, OPERAND_NONE, 8, 0}, {"SLA E", 2, OPERAND_NONE, 8, 0}, // 20 ~ 23
+        {"SLA H", 2, OPERAND_NONE, 8, 0}, {"SLA L", 2, OPERAND_NONE, 8, 0}, {"SLA (HL)", 2, OPERAND_NONE, 15, 0}, {"SLA A", 2, OPERAND_NONE, 8, 0}, // 24 ~ 27
+        {"SRA B", 2, OPERAND_NONE, 8, 0}, {"SRA C", 2, OPERAND_NONE, 8, 0}, {"SRA D", 2, OPERAND_NONE, 8, 0}, {"SRA E", 2, OPERAND_NONE, 8, 0}, // 28 ~ 2B
+        {"SRA H", 2, OPERAND_NONE, 8, 0}, {"SRA L", 2, OPERAND_NONE, 8, 0}, {"SRA (HL)", 2, OPERAND_NONE, 15, 0}, {"SRA A", 2, OPERAND_NONE, 8, 0}, // 2C ~ 2F
+        {"SLL B", 2, OPERAND_NONE, 8, 0}, {"SLL C", 2, OPERAND_NONE, 8, 0}, {"SLL D", 2, OPERAND_NONE, 8, 0}, {"SLL E", 2, OPERAND_NONE, 8, 0}, // 30 ~ 33
+        {"SLL H", 2, OPERAND_NONE, 8, 0}, {"SLL L", 2, OPERAND_NONE, 8, 0}, {"SLL (HL)", 2, OPERAND_NONE, 15, 0}, {"SLL A", 2, OPERAND_NONE, 8, 0}, // 34 ~ 37
+        {"SRL B", 2, OPERAND_NONE, 8, 0}, {"SRL C", 2, OPERAND_NONE, 8, 0}, {"SRL D", 2, OPERAND_NONE, 8, 0}, {"SRL E", 2, OPERAND_NONE, 8, 0}, // 38 ~ 3B
+        {"SRL H", 2, OPERAND_NONE, 8, 0}, {"SRL L", 2, OPERAND_NONE, 8, 0}, {"SRL (HL)", 2, OPERAND_NONE, 15, 0}, {"SRL A", 2, OPERAND_NONE, 8, 0}, // 3C ~ 3F
+        {"BIT 0, B", 2, OPERAND_NONE, 8, 0}, {"BIT 0, C", 2, OPERAND_NONE, 8, 0}, {"BIT 0, D", 2, OPERAND_NONE, 8, 0}, {"BIT 0, E", 2, OPERAND_NONE, 8, 0}, // 40 ~ 43
+        {"BIT 0, H", 2, OPERAND_NONE, 8, 0}, {"BIT 0, L", 2, OPERAND_NONE, 8, 0}, {"BIT 0, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 0, A", 2, OPERAND_NONE, 8, 0}, // 44 ~ 47
+        {"BIT 1, B", 2, OPERAND_NONE, 8, 0}, {"BIT 1, C", 2, OPERAND_NONE, 8, 0}, {"BIT 1, D", 2, OPERAND_NONE, 8, 0}, {"BIT 1, E", 2, OPERAND_NONE, 8, 0}, // 48 ~ 4B
+        {"BIT 1, H", 2, OPERAND_NONE, 8, 0}, {"BIT 1, L", 2, OPERAND_NONE, 8, 0}, {"BIT 1, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 1, A", 2, OPERAND_NONE, 8, 0}, // 4C ~ 4F
+        {"BIT 2, B", 2, OPERAND_NONE, 8, 0}, {"BIT 2, C", 2, OPERAND_NONE, 8, 0}, {"BIT 2, D", 2, OPERAND_NONE, 8, 0}, {"BIT 2, E", 2, OPERAND_NONE, 8, 0}, // 50 ~ 53
+        {"BIT 2, H", 2, OPERAND_NONE, 8, 0}, {"BIT 2, L", 2, OPERAND_NONE, 8, 0}, {"BIT 2, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 2, A", 2, OPERAND_NONE, 8, 0}, // 54 ~ 57
+        {"BIT 3, B", 2, OPERAND_NONE, 8, 0}, {"BIT 3, C", 2, OPERAND_NONE, 8, 0}, {"BIT 3, D", 2, OPERAND_NONE, 8, 0}, {"BIT 3, E", 2, OPERAND_NONE, 8, 0}, // 58 ~ 5B
+        {"BIT 3, H", 2, OPERAND_NONE, 8, 0}, {"BIT 3, L", 2, OPERAND_NONE, 8, 0}, {"BIT 3, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 3, A", 2, OPERAND_NONE, 8, 0}, // 5C ~ 5F
+        {"BIT 4, B", 2, OPERAND_NONE, 8, 0}, {"BIT 4, C", 2, OPERAND_NONE, 8, 0}, {"BIT 4, D", 2, OPERAND_NONE, 8, 0}, {"BIT 4, E", 2, OPERAND_NONE, 8, 0}, // 60 ~ 63
+        {"BIT 4, H", 2, OPERAND_NONE, 8, 0}, {"BIT 4, L", 2, OPERAND_NONE, 8, 0}, {"BIT 4, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 4, A", 2, OPERAND_NONE, 8, 0}, // 64 ~ 67
+        {"BIT 5, B", 2, OPERAND_NONE, 8, 0}, {"BIT 5, C", 2, OPERAND_NONE, 8, 0}, {"BIT 5, D", 2, OPERAND_NONE, 8, 0}, {"BIT 5, E", 2, OPERAND_NONE, 8, 0}, // 68 ~ 6B
+        {"BIT 5, H", 2, OPERAND_NONE, 8, 0}, {"BIT 5, L", 2, OPERAND_NONE, 8, 0}, {"BIT 5, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 5, A", 2, OPERAND_NONE, 8, 0}, // 6C ~ 6F
+        {"BIT 6, B", 2, OPERAND_NONE, 8, 0}, {"BIT 6, C", 2, OPERAND_NONE, 8, 0}, {"BIT 6, D", 2, OPERAND_NONE, 8, 0}, {"BIT 6, E", 2, OPERAND_NONE, 8, 0}, // 70 ~ 73
+        {"BIT 6, H", 2, OPERAND_NONE, 8, 0}, {"BIT 6, L", 2, OPERAND_NONE, 8, 0}, {"BIT 6, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 6, A", 2, OPERAND_NONE, 8, 0}, // 74 ~ 77
+        {"BIT 7, B", 2, OPERAND_NONE, 8, 0}, {"BIT 7, C", 2, OPERAND_NONE, 8, 0}, {"BIT 7, D", 2, OPERAND_NONE, 8, 0}, {"BIT 7, E", 2, OPERAND_NONE, 8, 0}, // 78 ~ 7B
+        {"BIT 7, H", 2, OPERAND_NONE, 8, 0}, {"BIT 7, L", 2, OPERAND_NONE, 8, 0}, {"BIT 7, (HL)", 2, OPERAND_NONE, 12, 0}, {"BIT 7, A", 2, OPERAND_NONE, 8, 0}, // 7C ~ 7F
+        {"RES 0, B", 2, OPERAND_NONE, 8, 0}, {"RES 0, C", 2, OPERAND_NONE, 8, 0}, {"RES 0, D", 2, OPERAND_NONE, 8, 0}, {"RES 0, E", 2, OPERAND_NONE, 8, 0}, // 80 ~ 83
+        {"RES 0, H", 2, OPERAND_NONE, 8, 0}, {"RES 0, L", 2, OPERAND_NONE, 8, 0}, {"RES 0, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 0, A", 2, OPERAND_NONE, 8, 0}, // 84 ~ 87
+        {"RES 1, B", 2, OPERAND_NONE, 8, 0}, {"RES 1, C", 2, OPERAND_NONE, 8, 0}, {"RES 1, D", 2, OPERAND_NONE, 8, 0}, {"RES 1, E", 2, OPERAND_NONE, 8, 0}, // 88 ~ 8B
+        {"RES 1, H", 2, OPERAND_NONE, 8, 0}, {"RES 1, L", 2, OPERAND_NONE, 8, 0}, {"RES 1, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 1, A", 2, OPERAND_NONE, 8, 0}, // 8C ~ 8F
+        {"RES 2, B", 2, OPERAND_NONE, 8, 0}, {"RES 2, C", 2, OPERAND_NONE, 8, 0}, {"RES 2, D", 2, OPERAND_NONE, 8, 0}, {"RES 2, E", 2, OPERAND_NONE, 8, 0}, // 90 ~ 93
+        {"RES 2, H", 2, OPERAND_NONE, 8, 0}, {"RES 2, L", 2, OPERAND_NONE, 8, 0}, {"RES 2, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 2, A", 2, OPERAND_NONE, 8, 0}, // 94 ~ 97
+        {"RES 3, B", 2, OPERAND_NONE, 8, 0}, {"RES 3, C", 2, OPERAND_NONE, 8, 0}, {"RES 3, D", 2, OPERAND_NONE, 8, 0}, {"RES 3, E", 2, OPERAND_NONE, 8, 0}, // 98 ~ 9B
+        {"RES 3, H", 2, OPERAND_NONE, 8, 0}, {"RES 3, L", 2, OPERAND_NONE, 8, 0}, {"RES 3, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 3, A", 2, OPERAND_NONE, 8, 0}, // 9C ~ 9F
+        {"RES 4, B", 2, OPERAND_NONE, 8, 0}, {"RES 4, C", 2, OPERAND_NONE, 8, 0}, {"RES 4, D", 2, OPERAND_NONE, 8, 0}, {"RES 4, E", 2, OPERAND_NONE, 8, 0}, // A0 ~ A3
+        {"RES 4, H", 2, OPERAND_NONE, 8, 0}, {"RES 4, L", 2, OPERAND_NONE, 8, 0}, {"RES 4, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 4, A", 2, OPERAND_NONE, 8, 0}, // A4 ~ A7
+        {"RES 5, B", 2, OPERAND_NONE, 8, 0}, {"RES 5, C", 2, OPERAND_NONE, 8, 0}, {"RES 5, D", 2, OPERAND_NONE, 8, 0}, {"RES 5, E", 2, OPERAND_NONE, 8, 0}, // A8 ~ AB
+        {"RES 5, H", 2, OPERAND_NONE, 8, 0}, {"RES 5, L", 2, OPERAND_NONE, 8, 0}, {"RES 5, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 5, A", 2, OPERAND_NONE, 8, 0}, // AC ~ AF
+        {"RES 6, B", 2, OPERAND_NONE, 8, 0}, {"RES 6, C", 2, OPERAND_NONE, 8, 0}, {"RES 6, D", 2, OPERAND_NONE, 8, 0}, {"RES 6, E", 2, OPERAND_NONE, 8, 0}, // B0 ~ B3
+        {"RES 6, H", 2, OPERAND_NONE, 8, 0}, {"RES 6, L", 2, OPERAND_NONE, 8, 0}, {"RES 6, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 6, A", 2, OPERAND_NONE, 8, 0}, // B4 ~ B7
+        {"RES 7, B", 2, OPERAND_NONE, 8, 0}, {"RES 7, C", 2, OPERAND_NONE, 8, 0}, {"RES 7, D", 2, OPERAND_NONE, 8, 0}, {"RES 7, E", 2, OPERAND_NONE, 8, 0}, // B8 ~ BB
+        {"RES 7, H", 2, OPERAND_NONE, 8, 0}, {"RES 7, L", 2, OPERAND_NONE, 8, 0}, {"RES 7, (HL)", 2, OPERAND_NONE, 15, 0}, {"RES 7, A", 2, OPERAND_NONE, 8, 0}, // BC ~ BF
+        {"SET 0, B", 2, OPERAND_NONE, 8, 0}, {"SET 0, C", 2, OPERAND_NONE, 8, 0}, {"SET 0, D", 2, OPERAND_NONE, 8, 0}, {"SET 0, E", 2, OPERAND_NONE, 8, 0}, // C0 ~ C3
+        {"SET 0, H", 2, OPERAND_NONE, 8, 0}, {"SET 0, L", 2, OPERAND_NONE, 8, 0}, {"SET 0, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 0, A", 2, OPERAND_NONE, 8, 0}, // C4 ~ C7
+        {"SET 1, B", 2, OPERAND_NONE, 8, 0}, {"SET 1, C", 2, OPERAND_NONE, 8, 0}, {"SET 1, D", 2, OPERAND_NONE, 8, 0}, {"SET 1, E", 2, OPERAND_NONE, 8, 0}, // C8 ~ CB
+        {"SET 1, H", 2, OPERAND_NONE, 8, 0}, {"SET 1, L", 2, OPERAND_NONE, 8, 0}, {"SET 1, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 1, A", 2, OPERAND_NONE, 8, 0}, // CC ~ CF
+        {"SET 2, B", 2, OPERAND_NONE, 8, 0}, {"SET 2, C", 2, OPERAND_NONE, 8, 0}, {"SET 2, D", 2, OPERAND_NONE, 8, 0}, {"SET 2, E", 2, OPERAND_NONE, 8, 0}, // D0 ~ D3
+        {"SET 2, H", 2, OPERAND_NONE, 8, 0}, {"SET 2, L", 2, OPERAND_NONE, 8, 0}, {"SET 2, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 2, A", 2, OPERAND_NONE, 8, 0}, // D4 ~ D7
+        {"SET 3, B", 2, OPERAND_NONE, 8, 0}, {"SET 3, C", 2, OPERAND_NONE, 8, 0}, {"SET 3, D", 2, OPERAND_NONE, 8, 0}, {"SET 3, E", 2, OPERAND_NONE, 8, 0}, // D8 ~ DB
+        {"SET 3, H", 2, OPERAND_NONE, 8, 0}, {"SET 3, L", 2, OPERAND_NONE, 8, 0}, {"SET 3, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 3, A", 2, OPERAND_NONE, 8, 0}, // DC ~ DF
+        {"SET 4, B", 2, OPERAND_NONE, 8, 0}, {"SET 4, C", 2, OPERAND_NONE, 8, 0}, {"SET 4, D", 2, OPERAND_NONE, 8, 0}, {"SET 4, E", 2, OPERAND_NONE, 8, 0}, // E0 ~ E3
+        {"SET 4, H", 2, OPERAND_NONE, 8, 0}, {"SET 4, L", 2, OPERAND_NONE, 8, 0}, {"SET 4, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 4, A", 2, OPERAND_NONE, 8, 0}, // E4 ~ E7
+        {"SET 5, B", 2, OPERAND_NONE, 8, 0}, {"SET 5, C", 2, OPERAND_NONE, 8, 0}, {"SET 5, D", 2, OPERAND_NONE, 8, 0}, {"SET 5, E", 2, OPERAND_NONE, 8, 0}, // E8 ~ EB
+        {"SET 5, H", 2, OPERAND_NONE, 8, 0}, {"SET 5, L", 2, OPERAND_NONE, 8, 0}, {"SET 5, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 5, A", 2, OPERAND_NONE, 8, 0}, // EC ~ EF
+        {"SET 6, B", 2, OPERAND_NONE, 8, 0}, {"SET 6, C", 2, OPERAND_NONE, 8, 0}, {"SET 6, D", 2, OPERAND_NONE, 8, 0}, {"SET 6, E", 2, OPERAND_NONE, 8, 0}, // F0 ~ F3
+        {"SET 6, H", 2, OPERAND_NONE, 8, 0}, {"SET 6, L", 2, OPERAND_NONE, 8, 0}, {"SET 6, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 6, A", 2, OPERAND_NONE, 8, 0}, // F4 ~ F7
+        {"SET 7, B", 2, OPERAND_NONE, 8, 0}, {"SET 7, C", 2, OPERAND_NONE, 8, 0}, {"SET 7, D", 2, OPERAND_NONE, 8, 0}, {"SET 7, E", 2, OPERAND_NONE, 8, 0}, // F8 ~ FB
+        {"SET 7, H", 2, OPERAND_NONE, 8, 0}, {"SET 7, L", 2, OPERAND_NONE, 8, 0}, {"SET 7, (HL)", 2, OPERAND_NONE, 15, 0}, {"SET 7, A", 2, OPERAND_NONE, 8, 0}  // FC ~ FF
+    };
+    static constexpr InstructionInfo instructionTableED[256] = {
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 00 ~ 03
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 04 ~ 07
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 08 ~ 0B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 0C ~ 0F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 10 ~ 13
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 14 ~ 17
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 18 ~ 1B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 1C ~ 1F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 20 ~ 23
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 24 ~ 27
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 28 ~ 2B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 2C ~ 2F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 30 ~ 33
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 34 ~ 37
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 38 ~ 3B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 3C ~ 3F
+        {"IN B, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), B", 2, OPERAND_NONE, 12, 0}, {"SBC HL, BC", 2, OPERAND_NONE, 15, 0}, {"LD (nn), BC", 4, OPERAND_WORD, 20, 0}, // 40 ~ 43
+        {"NEG", 2, OPERAND_NONE, 8, 0}, {"RETN", 2, OPERAND_NONE, 14, 0}, {"IM 0", 2, OPERAND_NONE, 8, 0}, {"LD I, A", 2, OPERAND_NONE, 9, 0}, // 44 ~ 47
+        {"IN C, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), C", 2, OPERAND_NONE, 12, 0}, {"ADC HL, BC", 2, OPERAND_NONE, 15, 0}, {"LD BC, (nn)", 4, OPERAND_WORD, 20, 0}, // 48 ~ 4B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"RETI", 2, OPERAND_NONE, 14, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"LD R, A", 2, OPERAND_NONE, 9, 0}, // 4C ~ 4F
+        {"IN D, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), D", 2, OPERAND_NONE, 12, 0}, {"SBC HL, DE", 2, OPERAND_NONE, 15, 0}, {"LD (nn), DE", 4, OPERAND_WORD, 20, 0}, // 50 ~ 53
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"IM 1", 2, OPERAND_NONE, 8, 0}, {"LD A, I", 2, OPERAND_NONE, 9, 0}, // 54 ~ 57
+        {"IN E, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), E", 2, OPERAND_NONE, 12, 0}, {"ADC HL, DE", 2, OPERAND_NONE, 15, 0}, {"LD DE, (nn)", 4, OPERAND_WORD, 20, 0}, // 58 ~ 5B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"IM 2", 2, OPERAND_NONE, 8, 0}, {"LD A, R", 2, OPERAND_NONE, 9, 0}, // 5C ~ 5F
+        {"IN H, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), H", 2, OPERAND_NONE, 12, 0}, {"SBC HL, HL", 2, OPERAND_NONE, 15, 0}, {"LD (nn), HL", 4, OPERAND_WORD, 20, 0}, // 60 ~ 63
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"RRD", 2, OPERAND_NONE, 18, 0}, // 64 ~ 67
+        {"IN L, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), L", 2, OPERAND_NONE, 12, 0}, {"ADC HL, HL", 2, OPERAND_NONE, 15, 0}, {"LD HL, (nn)", 4, OPERAND_WORD, 20, 0}, // 68 ~ 6B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"RLD", 2, OPERAND_NONE, 18, 0}, // 6C ~ 6F
+        {"IN (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), 0", 2, OPERAND_NONE, 12, 0}, {"SBC HL, SP", 2, OPERAND_NONE, 15, 0}, {"LD (nn), SP", 4, OPERAND_WORD, 20, 0}, // 70 ~ 73
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 74 ~ 77
+        {"IN A, (C)", 2, OPERAND_NONE, 12, 0}, {"OUT (C), A", 2, OPERAND_NONE, 12, 0}, {"ADC HL, SP", 2, OPERAND_NONE, 15, 0}, {"LD SP, (nn)", 4, OPERAND_WORD, 20, 0}, // 78 ~ 7B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 7C ~ 7F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 80 ~ 83
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 84 ~ 87
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 88 ~ 8B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 8C ~ 8F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 90 ~ 93
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 94 ~ 97
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 98 ~ 9B
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 9C ~ 9F
+        {"LDI", 2, OPERAND_NONE, 16, 0}, {"CPI", 2, OPERAND_NONE, 16, 0}, {"INI", 2, OPERAND_NONE, 16, 0}, {"OUTI", 2, OPERAND_NONE, 16, 0}, // A0 ~ A3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // A4 ~ A7
+        {"LDD", 2, OPERAND_NONE, 16, 0}, {"CPD", 2, OPERAND_NONE, 16, 0}, {"IND", 2, OPERAND_NONE, 16, 0}, {"OUTD", 2, OPERAND_NONE, 16, 0}, // A8 ~ AB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // AC ~ AF
+        {"LDIR", 2, OPERAND_NONE, 16, 21}, {"CPIR", 2, OPERAND_NONE, 16, 21}, {"INIR", 2, OPERAND_NONE, 16, 21}, {"OTIR", 2, OPERAND_NONE, 16, 21}, // B0 ~ B3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // B4 ~ B7
+        {"LDDR", 2, OPERAND_NONE, 16, 21}, {"CPDR", 2, OPERAND_NONE, 16, 21}, {"INDR", 2, OPERAND_NONE, 16, 21}, {"OTDR", 2, OPERAND_NONE, 16, 21}, // B8 ~ BB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // BC ~ BF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // C0 ~ C3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // C4 ~ C7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // C8 ~ CB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // CC ~ CF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D0 ~ D3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D4 ~ D7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D8 ~ DB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // DC ~ DF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // E0 ~ E3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // E4 ~ E7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // E8 ~ EB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // EC ~ EF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F0 ~ F3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F4 ~ F7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F8 ~ FB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}  // FC ~ FF
+    };
+    static constexpr InstructionInfo instructionTableIXY[256] = {
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 00 ~ 03
+        {"INC B", 2, OPERAND_NONE, 8, 0}, {"DEC B", 2, OPERAND_NONE, 8, 0}, {"LD B, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 04 ~ 07
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"ADD i, BC", 2, OPERAND_NONE, 15, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 08 ~ 0B
+        {"INC C", 2, OPERAND_NONE, 8, 0}, {"DEC C", 2, OPERAND_NONE, 8, 0}, {"LD C, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 0C ~ 0F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 10 ~ 13
+        {"INC D", 2, OPERAND_NONE, 8, 0}, {"DEC D", 2, OPERAND_NONE, 8, 0}, {"LD D, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 14 ~ 17
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"ADD i, DE", 2, OPERAND_NONE, 15, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 18 ~ 1B
+        {"INC E", 2, OPERAND_NONE, 8, 0}, {"DEC E", 2, OPERAND_NONE, 8, 0}, {"LD E, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 1C ~ 1F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"LD i, nn", 4, OPERAND_WORD, 14, 0}, {"LD (nn), i", 4, OPERAND_WORD, 20, 0}, {"INC i", 2, OPERAND_NONE, 10, 0}, // 20 ~ 23
+        {"INC iH", 2, OPERAND_NONE, 8, 0}, {"DEC iH", 2, OPERAND_NONE, 8, 0}, {"LD iH, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 24 ~ 27
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"ADD i, i", 2, OPERAND_NONE, 15, 0}, {"LD i, (nn)", 4, OPERAND_WORD, 20, 0}, {"DEC i", 2, OPERAND_NONE, 10, 0}, // 28 ~ 2B
+        {"INC iL", 2, OPERAND_NONE, 8, 0}, {"DEC iL", 2, OPERAND_NONE, 8, 0}, {"LD iL, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 2C ~ 2F
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 30 ~ 33
+        {"INC (i+d)", 3, OPERAND_INDEX, 23, 0}, {"DEC (i+d)", 3, OPERAND_INDEX, 23, 0}, {"LD (i+d), n", 4, OPERAND_INDEX_BYTE, 19, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 34 ~ 37
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"ADD i, SP", 2, OPERAND_NONE, 15, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 38 ~ 3B
+        {"INC A", 2, OPERAND_NONE, 8, 0}, {"DEC A", 2, OPERAND_NONE, 8, 0}, {"LD A, n", 3, OPERAND_BYTE, 11, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // 3C ~ 3F
+        {"LD B, B", 2, OPERAND_NONE, 8, 0}, {"LD B, C", 2, OPERAND_NONE, 8, 0}, {"LD B, D", 2, OPERAND_NONE, 8, 0}, {"LD B, E", 2, OPERAND_NONE, 8, 0}, // 40 ~ 43
+        {"LD B, iH", 2, OPERAND_NONE, 8, 0}, {"LD B, iL", 2, OPERAND_NONE, 8, 0}, {"LD B, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD B, A", 2, OPERAND_NONE, 8, 0}, // 44 ~ 47
+        {"LD C, B", 2, OPERAND_NONE, 8, 0}, {"LD C, C", 2, OPERAND_NONE, 8, 0}, {"LD C, D", 2, OPERAND_NONE, 8, 0}, {"LD C, E", 2, OPERAND_NONE, 8, 0}, // 48 ~ 4B
+        {"LD C, iH", 2, OPERAND_NONE, 8, 0}, {"LD C, iL", 2, OPERAND_NONE, 8, 0}, {"LD C, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD C, A", 2, OPERAND_NONE, 8, 0}, // 4C ~ 4F
+        {"LD D, B", 2, OPERAND_NONE, 8, 0}, {"LD D, C", 2, OPERAND_NONE, 8, 0}, {"LD D, D", 2, OPERAND_NONE, 8, 0}, {"LD D, E", 2, OPERAND_NONE, 8, 0}, // 50 ~ 53
+        {"LD D, iH", 2, OPERAND_NONE, 8, 0}, {"LD D, iL", 2, OPERAND_NONE, 8, 0}, {"LD D, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD D, A", 2, OPERAND_NONE, 8, 0}, // 54 ~ 57
+        {"LD E, B", 2, OPERAND_NONE, 8, 0}, {"LD E, C", 2, OPERAND_NONE, 8, 0}, {"LD E, D", 2, OPERAND_NONE, 8, 0}, {"LD E, E", 2, OPERAND_NONE, 8, 0}, // 58 ~ 5B
+        {"LD E, iH", 2, OPERAND_NONE, 8, 0}, {"LD E, iL", 2, OPERAND_NONE, 8, 0}, {"LD E, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD E, A", 2, OPERAND_NONE, 8, 0}, // 5C ~ 5F
+        {"LD iH, B", 2, OPERAND_NONE, 8, 0}, {"LD iH, C", 2, OPERAND_NONE, 8, 0}, {"LD iH, D", 2, OPERAND_NONE, 8, 0}, {"LD iH, E", 2, OPERAND_NONE, 8, 0}, // 60 ~ 63
+        {"LD iH, iH", 2, OPERAND_NONE, 8, 0}, {"LD iH, iL", 2, OPERAND_NONE, 8, 0}, {"LD H, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD iH, A", 2, OPERAND_NONE, 8, 0}, // 64 ~ 67
+        {"LD iL, B", 2, OPERAND_NONE, 8, 0}, {"LD iL, C", 2, OPERAND_NONE, 8, 0}, {"LD iL, D", 2, OPERAND_NONE, 8, 0}, {"LD iL, E", 2, OPERAND_NONE, 8, 0}, // 68 ~ 6B
+        {"LD iL, iH", 2, OPERAND_NONE, 8, 0}, {"LD iL, iL", 2, OPERAND_NONE, 8, 0}, {"LD L, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD iL, A", 2, OPERAND_NONE, 8, 0}, // 6C ~ 6F
+        {"LD (i+d), B", 3, OPERAND_INDEX, 19, 0}, {"LD (i+d), C", 3, OPERAND_INDEX, 19, 0}, {"LD (i+d), D", 3, OPERAND_INDEX, 19, 0}, {"LD (i+d), E", 3, OPERAND_INDEX, 19, 0}, // 70 ~ 73
+        {"LD (i+d), H", 3, OPERAND_INDEX, 19, 0}, {"LD (i+d), L", 3, OPERAND_INDEX, 19, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"LD (i+d), A", 3, OPERAND_INDEX, 19, 0}, // 74 ~ 77
+        {"LD A, B", 2, OPERAND_NONE, 8, 0}, {"LD A, C", 2, OPERAND_NONE, 8, 0}, {"LD A, D", 2, OPERAND_NONE, 8, 0}, {"LD A, E", 2, OPERAND_NONE, 8, 0}, // 78 ~ 7B
+        {"LD A, iH", 2, OPERAND_NONE, 8, 0}, {"LD A, iL", 2, OPERAND_NONE, 8, 0}, {"LD A, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"LD A, A", 2, OPERAND_NONE, 8, 0}, // 7C ~ 7F
+        {"ADD A, B", 2, OPERAND_NONE, 8, 0}, {"ADD A, C", 2, OPERAND_NONE, 8, 0}, {"ADD A, D", 2, OPERAND_NONE, 8, 0}, {"ADD A, E", 2, OPERAND_NONE, 8, 0}, // 80 ~ 83
+        {"ADD A, iH", 2, OPERAND_NONE, 8, 0}, {"ADD A, iL", 2, OPERAND_NONE, 8, 0}, {"ADD A, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"ADD A, A", 2, OPERAND_NONE, 8, 0}, // 84 ~ 87
+        {"ADC A, B", 2, OPERAND_NONE, 8, 0}, {"ADC A, C", 2, OPERAND_NONE, 8, 0}, {"ADC A, D", 2, OPERAND_NONE, 8, 0}, {"ADC A, E", 2, OPERAND_NONE, 8, 0}, // 88 ~ 8B
+        {"ADC A, iH", 2, OPERAND_NONE, 8, 0}, {"ADC A, iL", 2, OPERAND_NONE, 8, 0}, {"ADC A, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"ADC A, A", 2, OPERAND_NONE, 8, 0}, // 8C ~ 8F
+        {"SUB B", 2, OPERAND_NONE, 8, 0}, {"SUB C", 2, OPERAND_NONE, 8, 0}, {"SUB D", 2, OPERAND_NONE, 8, 0}, {"SUB E", 2, OPERAND_NONE, 8, 0}, // 90 ~ 93
+        {"SUB iH", 2, OPERAND_NONE, 8, 0}, {"SUB iL", 2, OPERAND_NONE, 8, 0}, {"SUB (i+d)", 3, OPERAND_INDEX, 19, 0}, {"SUB A", 2, OPERAND_NONE, 8, 0}, // 94 ~ 97
+        {"SBC A, B", 2, OPERAND_NONE, 8, 0}, {"SBC A, C", 2, OPERAND_NONE, 8, 0}, {"SBC A, D", 2, OPERAND_NONE, 8, 0}, {"SBC A, E", 2, OPERAND_NONE, 8, 0}, // 98 ~ 9B
+        {"SBC A, iH", 2, OPERAND_NONE, 8, 0}, {"SBC A, iL", 2, OPERAND_NONE, 8, 0}, {"SBC A, (i+d)", 3, OPERAND_INDEX, 19, 0}, {"SBC A, A", 2, OPERAND_NONE, 8, 0}, // 9C ~ 9F
+        {"AND B", 2, OPERAND_NONE, 8, 0}, {"AND C", 2, OPERAND_NONE, 8, 0}, {"AND D", 2, OPERAND_NONE, 8, 0}, {"AND E", 2, OPERAND_NONE, 8, 0}, // A0 ~ A3
+        {"AND iH", 2, OPERAND_NONE, 8, 0}, {"AND iL", 2, OPERAND_NONE, 8, 0}, {"AND (i+d)", 3, OPERAND_INDEX, 19, 0}, {"AND A", 2, OPERAND_NONE, 8, 0}, // A4 ~ A7
+        {"XOR B", 2, OPERAND_NONE, 8, 0}, {"XOR C", 2, OPERAND_NONE, 8, 0}, {"XOR D", 2, OPERAND_NONE, 8, 0}, {"XOR E", 2, OPERAND_NONE, 8, 0}, // A8 ~ AB
+        {"XOR iH", 2, OPERAND_NONE, 8, 0}, {"XOR iL", 2, OPERAND_NONE, 8, 0}, {"XOR (i+d)", 3, OPERAND_INDEX, 19, 0}, {"XOR A", 2, OPERAND_NONE, 8, 0}, // AC ~ AF
+        {"OR B", 2, OPERAND_NONE, 8, 0}, {"OR C", 2, OPERAND_NONE, 8, 0}, {"OR D", 2, OPERAND_NONE, 8, 0}, {"OR E", 2, OPERAND_NONE, 8, 0}, // B0 ~ B3
+        {"OR iH", 2, OPERAND_NONE, 8, 0}, {"OR iL", 2, OPERAND_NONE, 8, 0}, {"OR (i+d)", 3, OPERAND_INDEX, 19, 0}, {"OR A", 2, OPERAND_NONE, 8, 0}, // B4 ~ B7
+        {"CP B", 2, OPERAND_NONE, 8, 0}, {"CP C", 2, OPERAND_NONE, 8, 0}, {"CP D", 2, OPERAND_NONE, 8, 0}, {"CP E", 2, OPERAND_NONE, 8, 0}, // B8 ~ BB
+        {"CP iH", 2, OPERAND_NONE, 8, 0}, {"CP iL", 2, OPERAND_NONE, 8, 0}, {"CP (i+d)", 3, OPERAND_INDEX, 19, 0}, {"CP A", 2, OPERAND_NONE, 8, 0}, // BC ~ BF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // C0 ~ C3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // C4 ~ C7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 4, OPERAND_NONE, 0, 0}, // C8 ~ CB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // CC ~ CF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D0 ~ D3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D4 ~ D7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // D8 ~ DB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // DC ~ DF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"POP i", 2, OPERAND_NONE, 14, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {"EX (SP), i", 2, OPERAND_NONE, 23, 0}, // E0 ~ E3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"PUSH i", 2, OPERAND_NONE, 15, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // E4 ~ E7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"JP (i)", 2, OPERAND_NONE, 8, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // E8 ~ EB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // EC ~ EF
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F0 ~ F3
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F4 ~ F7
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {"LD SP, i", 2, OPERAND_NONE, 10, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, // F8 ~ FB
+        {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}, {nullptr, 0, OPERAND_NONE, 0, 0}  // FC ~ FF
+    };
+    static constexpr InstructionInfo instructionTableIXYCB[256] = {
+        {"RLC (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 00 ~ 03
+        {"RLC (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RLC (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 04 ~ 07
+        {"RRC (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 08 ~ 0B
+        {"RRC (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RRC (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 0C ~ 0F
+        {"RL (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 10 ~ 13
+        {"RL (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RL (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 14 ~ 17
+        {"RR (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 18 ~ 1B
+        {"RR (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RR (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 1C ~ 1F
+        {"SLA (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 20 ~ 23
+        {"SLA (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SLA (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 24 ~ 27
+        {"SRA (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 28 ~ 2B
+        {"SRA (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SRA (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 2C ~ 2F
+        {"SLL (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 30 ~ 33
+        {"SLL (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SLL (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 34 ~ 37
+        {"SRL (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 38 ~ 3B
+        {"SRL (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SRL (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 3C ~ 3F
+        {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 40 ~ 43
+        {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 0, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 44 ~ 47
+        {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 48 ~ 4B
+        {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 1, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 4C ~ 4F
+        {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 50 ~ 53
+        {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 2, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 54 ~ 57
+        {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 58 ~ 5B
+        {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 3, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 5C ~ 5F
+        {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 60 ~ 63
+        {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 4, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 64 ~ 67
+        {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 68 ~ 6B
+        {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 5, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 6C ~ 6F
+        {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 70 ~ 73
+        {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 6, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 74 ~ 77
+        {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 78 ~ 7B
+        {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, {"BIT 7, (i+d)", 4, OPERAND_INDEX, 20, 0}, // 7C ~ 7F
+        {"RES 0, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 80 ~ 83
+        {"RES 0, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 0, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 84 ~ 87
+        {"RES 1, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 88 ~ 8B
+        {"RES 1, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 1, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 8C ~ 8F
+        {"RES 2, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 90 ~ 93
+        {"RES 2, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 2, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 94 ~ 97
+        {"RES 3, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // 98 ~ 9B
+        {"RES 3, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 3, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // 9C ~ 9F
+        {"RES 4, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // A0 ~ A3
+        {"RES 4, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 4, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // A4 ~ A7
+        {"RES 5, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // A8 ~ AB
+        {"RES 5, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 5, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // AC ~ AF
+        {"RES 6, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // B0 ~ B3
+        {"RES 6, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 6, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // B4 ~ B7
+        {"RES 7, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // B8 ~ BB
+        {"RES 7, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"RES 7, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // BC ~ BF
+        {"SET 0, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // C0 ~ C3
+        {"SET 0, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 0, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // C4 ~ C7
+        {"SET 1, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // C8 ~ CB
+        {"SET 1, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 1, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // CC ~ CF
+        {"SET 2, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // D0 ~ D3
+        {"SET 2, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 2, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // D4 ~ D7
+        {"SET 3, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // D8 ~ DB
+        {"SET 3, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 3, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // DC ~ DF
+        {"SET 4, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // E0 ~ E3
+        {"SET 4, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 4, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // E4 ~ E7
+        {"SET 5, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // E8 ~ EB
+        {"SET 5, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 5, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // EC ~ EF
+        {"SET 6, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // F0 ~ F3
+        {"SET 6, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 6, (i+d), A", 4, OPERAND_INDEX, 23, 0}, // F4 ~ F7
+        {"SET 7, (i+d), B", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d), C", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d), D", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d), E", 4, OPERAND_INDEX, 23, 0}, // F8 ~ FB
+        {"SET 7, (i+d), H", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d), L", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d)", 4, OPERAND_INDEX, 23, 0}, {"SET 7, (i+d), A", 4, OPERAND_INDEX, 23, 0}  // FC ~ FF
+    };
+
+    static inline char* putDisassembledHex(char* text, unsigned int value, int digits)
+    {
+        *text++ = '$';
+        for (int shift = (digits - 1) * 4; 0 <= shift; shift -= 4) *text++ = "0123456789ABCDEF"[(value >> shift) & 0xF];
+        return text;
+    }
+
+    // decode the instruction at addr with the reader of the bytes (only the bytes of the instruction are read)
+    template <class Reader>
+    static inline void decodeInstruction(Instruction* ins, unsigned short addr, Reader read)
+    {
+        const InstructionInfo* info;
+        unsigned char* op = ins->opcode;
+        int opcodeLength = 1;
+        memset(ins, 0, sizeof(Instruction));
+        ins->addr = addr;
+        op[0] = read(addr);
+        switch (op[0]) {
+            case 0xCB:
+                op[1] = read((unsigned short)(addr + 1));
+                info = &instructionTableCB[op[1]];
+                opcodeLength = 2;
+                break;
+            case 0xED:
+                op[1] = read((unsigned short)(addr + 1));
+                info = &instructionTableED[op[1]];
+                opcodeLength = 2;
+                break;
+            case 0xDD:
+            case 0xFD:
+                op[1] = read((unsigned short)(addr + 1));
+                if (0xCB == op[1]) {
+                    op[2] = read((unsigned short)(addr + 2));
+                    op[3] = read((unsigned short)(addr + 3));
+                    info = &instructionTableIXYCB[op[3]];
+                    opcodeLength = 4;
+                } else {
+                    info = &instructionTableIXY[op[1]];
+                    opcodeLength = 2;
+                }
+                break;
+            default:
+                info = &instructionTable1[op[0]];
+        }
+        if (!info->mnemonic) {
+            ins->length = 1; // the first byte as the data
+            return;
+        }
+        ins->mnemonic = info->mnemonic;
+        ins->length = info->length;
+        ins->operand = info->operand;
+        ins->clocks = info->clocks;
+        ins->branchClocks = info->branchClocks;
+        for (int i = opcodeLength; i < info->length; i++) op[i] = read((unsigned short)(addr + i));
+        switch (info->operand) {
+            case OPERAND_BYTE: ins->value = op[info->length - 1]; break;
+            case OPERAND_WORD: ins->value = (unsigned short)(op[info->length - 2] | op[info->length - 1] << 8); break;
+            case OPERAND_RELATIVE: ins->value = (unsigned short)(addr + 2 + (signed char)op[1]); break;
+            case OPERAND_INDEX: ins->displacement = (signed char)op[2]; break;
+            case OPERAND_INDEX_BYTE:
+                ins->displacement = (signed char)op[2];
+                ins->value = op[3];
+                break;
+        }
+    }
+    static constexpr void (*opSet1[256])(Z80Core* ctx) = {
         NOP, LD_BC_NN, LD_BC_A, INC_RP_BC, INC_B, DEC_B, LD_B_N, RLCA, EX_AF_AF2, ADD_HL_BC, LD_A_BC, DEC_RP_BC, INC_C, DEC_C, LD_C_N, RRCA,
         DJNZ_E, LD_DE_NN, LD_DE_A, INC_RP_DE, INC_D, DEC_D, LD_D_N, RLA, JR_E, ADD_HL_DE, LD_A_DE, DEC_RP_DE, INC_E, DEC_E, LD_E_N, RRA,
         JR_NZ_E, LD_HL_NN, LD_ADDR_HL, INC_RP_HL, INC_H, DEC_H, LD_H_N, DAA, JR_Z_E, ADD_HL_HL, LD_HL_ADDR, DEC_RP_HL, INC_L, DEC_L, LD_L_N, CPL,
@@ -5762,7 +7434,7 @@ class Z80
         RET_C2, POP_DE, JP_C2_NN, OUT_N_A, CALL_C2_NN, PUSH_DE, SUB_N, RST10, RET_C3, EXX, JP_C3_NN, IN_A_N, CALL_C3_NN, OP_IX, SBC_N, RST18,
         RET_C4, POP_HL, JP_C4_NN, EX_SP_HL, CALL_C4_NN, PUSH_HL, AND_N, RST20, RET_C5, JP_HL, JP_C5_NN, EX_DE_HL, CALL_C5_NN, OP_ED, XOR_N, RST28,
         RET_C6, POP_AF, JP_C6_NN, DI, CALL_C6_NN, PUSH_AF, OR_N, RST30, RET_C7, LD_SP_HL, JP_C7_NN, EI, CALL_C7_NN, OP_IY, CP_N, RST38};
-    void (*opSetCB[256])(Z80* ctx) = {
+    static constexpr void (*opSetCB[256])(Z80Core* ctx) = {
         RLC_B, RLC_C, RLC_D, RLC_E, RLC_H, RLC_L, RLC_HL_, RLC_A,
         RRC_B, RRC_C, RRC_D, RRC_E, RRC_H, RRC_L, RRC_HL_, RRC_A,
         RL_B, RL_C, RL_D, RL_E, RL_H, RL_L, RL_HL_, RL_A,
@@ -5795,7 +7467,7 @@ class Z80
         SET_B_5, SET_C_5, SET_D_5, SET_E_5, SET_H_5, SET_L_5, SET_HL_5, SET_A_5,
         SET_B_6, SET_C_6, SET_D_6, SET_E_6, SET_H_6, SET_L_6, SET_HL_6, SET_A_6,
         SET_B_7, SET_C_7, SET_D_7, SET_E_7, SET_H_7, SET_L_7, SET_HL_7, SET_A_7};
-    void (*opSetED[256])(Z80* ctx) = {
+    static constexpr void (*opSetED[256])(Z80Core* ctx) = {
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
@@ -5814,7 +7486,7 @@ class Z80
         LDD, CPD, IND, OUTD, nullptr, nullptr, nullptr, nullptr,
         LDIR, CPIR, INIR, OUTIR, nullptr, nullptr, nullptr, nullptr,
         LDDR, CPDR, INDR, OUTDR, nullptr, nullptr, nullptr, nullptr};
-    void (*opSetIX[256])(Z80* ctx) = {
+    static constexpr void (*opSetIX[256])(Z80Core* ctx) = {
         nullptr, nullptr, nullptr, nullptr, INC_B_2, DEC_B_2, LD_B_N_3, nullptr,
         nullptr, ADD_IX_BC, nullptr, nullptr, INC_C_2, DEC_C_2, LD_C_N_3, nullptr,
         nullptr, nullptr, nullptr, nullptr, INC_D_2, DEC_D_2, LD_D_N_3, nullptr,
@@ -5847,7 +7519,7 @@ class Z80
         nullptr, JP_IX, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, LD_SP_IX_, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
-    void (*opSetIY[256])(Z80* ctx) = {
+    static constexpr void (*opSetIY[256])(Z80Core* ctx) = {
         nullptr, nullptr, nullptr, nullptr, INC_B_2, DEC_B_2, LD_B_N_3, nullptr,
         nullptr, ADD_IY_BC, nullptr, nullptr, INC_C_2, DEC_C_2, LD_C_N_3, nullptr,
         nullptr, nullptr, nullptr, nullptr, INC_D_2, DEC_D_2, LD_D_N_3, nullptr,
@@ -5880,7 +7552,7 @@ class Z80
         nullptr, JP_IY, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
         nullptr, LD_SP_IY_, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
-    void (*opSetIX4[256])(Z80* ctx, signed char d) = {
+    static constexpr void (*opSetIX4[256])(Z80Core* ctx, signed char d) = {
         RLC_IX_with_LD_B, RLC_IX_with_LD_C, RLC_IX_with_LD_D, RLC_IX_with_LD_E, RLC_IX_with_LD_H, RLC_IX_with_LD_L, RLC_IX_, RLC_IX_with_LD_A,
         RRC_IX_with_LD_B, RRC_IX_with_LD_C, RRC_IX_with_LD_D, RRC_IX_with_LD_E, RRC_IX_with_LD_H, RRC_IX_with_LD_L, RRC_IX_, RRC_IX_with_LD_A,
         RL_IX_with_LD_B, RL_IX_with_LD_C, RL_IX_with_LD_D, RL_IX_with_LD_E, RL_IX_with_LD_H, RL_IX_with_LD_L, RL_IX_, RL_IX_with_LD_A,
@@ -5913,7 +7585,7 @@ class Z80
         SET_IX_5_with_LD_B, SET_IX_5_with_LD_C, SET_IX_5_with_LD_D, SET_IX_5_with_LD_E, SET_IX_5_with_LD_H, SET_IX_5_with_LD_L, SET_IX_5, SET_IX_5_with_LD_A,
         SET_IX_6_with_LD_B, SET_IX_6_with_LD_C, SET_IX_6_with_LD_D, SET_IX_6_with_LD_E, SET_IX_6_with_LD_H, SET_IX_6_with_LD_L, SET_IX_6, SET_IX_6_with_LD_A,
         SET_IX_7_with_LD_B, SET_IX_7_with_LD_C, SET_IX_7_with_LD_D, SET_IX_7_with_LD_E, SET_IX_7_with_LD_H, SET_IX_7_with_LD_L, SET_IX_7, SET_IX_7_with_LD_A};
-    void (*opSetIY4[256])(Z80* ctx, signed char d) = {
+    static constexpr void (*opSetIY4[256])(Z80Core* ctx, signed char d) = {
         RLC_IY_with_LD_B, RLC_IY_with_LD_C, RLC_IY_with_LD_D, RLC_IY_with_LD_E, RLC_IY_with_LD_H, RLC_IY_with_LD_L, RLC_IY_, RLC_IY_with_LD_A,
         RRC_IY_with_LD_B, RRC_IY_with_LD_C, RRC_IY_with_LD_D, RRC_IY_with_LD_E, RRC_IY_with_LD_H, RRC_IY_with_LD_L, RRC_IY_, RRC_IY_with_LD_A,
         RL_IY_with_LD_B, RL_IY_with_LD_C, RL_IY_with_LD_D, RL_IY_with_LD_E, RL_IY_with_LD_H, RL_IY_with_LD_L, RL_IY_, RL_IY_with_LD_A,
@@ -5946,6 +7618,16 @@ class Z80
         SET_IY_5_with_LD_B, SET_IY_5_with_LD_C, SET_IY_5_with_LD_D, SET_IY_5_with_LD_E, SET_IY_5_with_LD_H, SET_IY_5_with_LD_L, SET_IY_5, SET_IY_5_with_LD_A,
         SET_IY_6_with_LD_B, SET_IY_6_with_LD_C, SET_IY_6_with_LD_D, SET_IY_6_with_LD_E, SET_IY_6_with_LD_H, SET_IY_6_with_LD_L, SET_IY_6, SET_IY_6_with_LD_A,
         SET_IY_7_with_LD_B, SET_IY_7_with_LD_C, SET_IY_7_with_LD_D, SET_IY_7_with_LD_E, SET_IY_7_with_LD_H, SET_IY_7_with_LD_L, SET_IY_7, SET_IY_7_with_LD_A};
+#ifdef Z80_SWITCH_DISPATCH
+    // the dispatchers are generated from the opSet tables (the handlers can be inlined)
+    inline void dispatch1(unsigned char operandNumber) { Z80_DISPATCH(opSet1, (this)) }
+    inline void dispatchCB(unsigned char operandNumber) { Z80_DISPATCH(opSetCB, (this)) }
+    inline void dispatchED(unsigned char operandNumber) { Z80_DISPATCH(opSetED, (this)) }
+    inline void dispatchIX(unsigned char operandNumber) { Z80_DISPATCH(opSetIX, (this)) }
+    inline void dispatchIY(unsigned char operandNumber) { Z80_DISPATCH(opSetIY, (this)) }
+    inline void dispatchIX4(unsigned char operandNumber, signed char d) { Z80_DISPATCH(opSetIX4, (this, d)) }
+    inline void dispatchIY4(unsigned char operandNumber, signed char d) { Z80_DISPATCH(opSetIY4, (this, d)) }
+#endif
 
     inline void checkInterrupt()
     {
@@ -6027,147 +7709,1022 @@ class Z80
         consumeClock(2);
     }
 
-  public: // API functions
-#ifdef Z80_NO_FUNCTIONAL
-    Z80(unsigned char (*read)(void* arg, unsigned short addr),
-        void (*write)(void* arg, unsigned short addr, unsigned char value),
-        unsigned char (*in)(void* arg, unsigned short port),
-        void (*out)(void* arg, unsigned short port, unsigned char value),
-        void* arg,
-        bool returnPortAs16Bits = false)
+    // true if the NOPs in HALT can be skipped (no interrupt can be accepted and nothing observes each NOP)
+    inline bool isHaltSkipAvailable()
+    {
+        if (reg.interrupt & 0b11000000) return false;
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+        return aggregateHaltClocks;
 #else
-    Z80(std::function<unsigned char(void*, unsigned short)> read,
-        std::function<void(void*, unsigned short, unsigned char)> write,
-        std::function<unsigned char(void*, unsigned short)> in,
-        std::function<void(void*, unsigned short, unsigned char)> out,
-        void* arg,
-        bool returnPortAs16Bits = false)
+        return aggregateHaltClocks || !CB.consumeClockEnabled;
 #endif
-    {
-        this->CB.arg = arg;
-        initialize();
-        setupCallback(read, write, in, out, returnPortAs16Bits);
     }
 
-    // without setup callbacks
-    Z80(void* arg)
+    // execute a NOP in HALT (read and discard the next byte)
+    inline void executeHaltOperand(int clock)
     {
-        this->CB.arg = arg;
-        initialize();
+        if (!pageMap[reg.PC >> 8].read && (recordLog || replaying)) {
+            skipHalt(clock); // the discarded byte via the bus is not an input of the record/replay (the NOPs are skipped at any timing)
+            return;
+        }
+        readByte<true>(reg.PC, clock);
+        reg.R = ((reg.R + 1) & 0x7F) | (reg.R & 0x80);
     }
 
-    Z80()
+    // skip the NOPs in HALT until the end of the clocks (the consumeClock callback is called once with the skipped clocks)
+    inline void skipHalt(int clock)
     {
-        initialize();
+        int step = wtc.read + 4;
+        int count = clock / step + (clock % step ? 1 : 0);
+        reg.R = ((reg.R + count) & 0x7F) | (reg.R & 0x80);
+        skipClocks(count * step);
+#if !defined(Z80_CALLBACK_PER_INSTRUCTION)
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+        flushFlags();
+        CB.consumeClock(CB.arg, count * step);
+#else
+        if (CB.consumeClockEnabled) {
+            flushFlags();
+            CB.consumeClock(CB.arg, count * step);
+        }
+#endif
+#endif
     }
 
-#ifndef Z80_NO_FUNCTIONAL
-    void setupCallback(std::function<unsigned char(void*, unsigned short)> read,
-                       std::function<void(void*, unsigned short, unsigned char)> write,
-                       std::function<unsigned char(void*, unsigned short)> in,
-                       std::function<void(void*, unsigned short, unsigned char)> out,
-                       void* arg,
-                       bool returnPortAs16Bits = false)
+    template <bool instrumentedLoop>
+    inline void executeOperand(int clock)
     {
-        CB.arg = arg;
-        setupCallback(read, write, in, out, returnPortAs16Bits);
+        int operandNumber = fetch(clock);
+        updateRefreshRegister();
+#ifndef Z80_DISABLE_BREAKPOINT
+        if (instrumentedLoop) checkBreakOperand(0, operandNumber);
+#endif
+#ifdef Z80_SWITCH_DISPATCH
+        dispatch1(operandNumber);
+#else
+        opSet1[operandNumber](this);
+#endif
     }
 
-    void setupCallback(std::function<unsigned char(void*, unsigned short)> read,
-                       std::function<void(void*, unsigned short, unsigned char)> write,
-                       std::function<unsigned char(void*, unsigned short)> in,
-                       std::function<void(void*, unsigned short, unsigned char)> out,
-                       bool returnPortAs16Bits = false)
-    {
-        setupMemoryCallback(read, write);
-        setupDeviceCallback(in, out, returnPortAs16Bits);
-    }
+#ifdef Z80_DECODE_CACHE
+    // operand decoded from the opcode bytes (prefix, operand number and the displacement of DD CB d op / FD CB d op)
+    struct DecodedOperand {
+        void (*handler)(Z80Core* ctx);
+        void (*handlerD)(Z80Core* ctx, signed char d); // handler of DD CB d op / FD CB d op
+        unsigned short addr;
+        unsigned char opcode[4];
+        unsigned char length; // length of the opcode bytes (1, 2 or 4)
+        unsigned char size;   // size of the instruction (opcode bytes and immediate values)
+        bool breakOperand;    // true if the break operands are added to the opcode
+        bool breakPoint;      // true if the break points are added to the address
+    };
 
-    void setupMemoryCallback(std::function<unsigned char(void*, unsigned short)> read,
-                             std::function<void(void*, unsigned short, unsigned char)> write)
-    {
-        CB.read = read;
-        CB.write = write;
-    }
+    // straight-line operands from the start address to a branch (never crosses the page)
+    struct DecodedBlock {
+        std::vector<DecodedOperand> operands;
+        unsigned int executed; // number of times entered from the start address (up to Z80_HOT_BLOCK_THRESHOLD)
+#ifdef Z80_JIT_X86_64
+        void* jitCode;  // native code of the block (nullptr: not compiled)
+        size_t jitSize; // size of the mapped native code
+        bool jitTried;  // true if compiled (or nothing to compile)
+#endif
+    };
 
-    void setupDeviceCallback(std::function<unsigned char(void*, unsigned short)> in,
-                             std::function<void(void*, unsigned short, unsigned char)> out,
-                             bool returnPortAs16Bits)
+    DecodedBlock** decodedPages[256] = {};        // decoded blocks of each page (indexed by the lower 8 bits of the start address)
+    unsigned char decodedBytes[0x10000 / 8] = {}; // bitmap of the opcode bytes referred from the decoded blocks
+    DecodedOperand* decodedNext = nullptr;        // next operand in the executing block
+    DecodedOperand* decodedEnd = nullptr;         // end of the executing block
+    unsigned int decodedGeneration = 0;           // incremented when the decoded blocks are released
+#ifdef Z80_JIT_X86_64
+    std::vector<std::pair<void*, size_t>> jitReleased; // native code of the released blocks (unmapped outside of the native code)
+    DecodedOperand* jitOp = nullptr;                   // next operand of the running native code
+    int jitClock = 0;                                  // clocks left in the running native code
+    int jitExecuted = 0;                               // clocks executed by the running native code
+#endif
+
+    // true if the consumeClock callback is called at each memory access
+    inline bool isConsumeClockPerAccess()
     {
-        CB.in = in;
-        CB.out = out;
-#ifndef Z80_UNSUPPORT_16BIT_PORT
-        CB.returnPortAs16Bits = returnPortAs16Bits;
+#ifdef Z80_CALLBACK_PER_INSTRUCTION
+        return false;
+#elif defined(Z80_CALLBACK_WITHOUT_CHECK)
+        return true;
+#else
+        return CB.consumeClockEnabled;
 #endif
     }
 
-#else
-    void setupCallback(unsigned char (*read)(void* arg, unsigned short addr),
-                       void (*write)(void* arg, unsigned short addr, unsigned char value),
-                       unsigned char (*in)(void* arg, unsigned short port),
-                       void (*out)(void* arg, unsigned short port, unsigned char value),
-                       void* arg,
-                       bool returnPortAs16Bits = false)
+    inline void consumeReadClock(int clock)
     {
-        CB.arg = arg;
-        setupCallback(read, write, in, out, returnPortAs16Bits);
+#ifndef Z80_DISABLE_BREAKPOINT
+        if (clock && wtc.read) consumeClock(wtc.read);
+        if (clock) consumeClock(clock);
+#else
+        consumeClock(wtc.read);
+        consumeClock(clock);
+#endif
     }
 
-    void setupCallback(unsigned char (*read)(void* arg, unsigned short addr),
-                       void (*write)(void* arg, unsigned short addr, unsigned char value),
-                       unsigned char (*in)(void* arg, unsigned short port),
-                       void (*out)(void* arg, unsigned short port, unsigned char value),
-                       bool returnPortAs16Bits = false)
+#ifndef Z80_DISABLE_BREAKPOINT
+    inline bool hasBreakOperand(int number)
     {
-        setupMemoryCallback(read, write);
-        setupDeviceCallback(in, out, returnPortAs16Bits);
+        int slot = breakOperandSlot(number);
+        return 0 <= slot && hasBreakOperand(slot, number & 0xFF);
     }
+#endif
 
-    void setupMemoryCallback(unsigned char (*read)(void* arg, unsigned short addr),
-                             void (*write)(void* arg, unsigned short addr, unsigned char value))
+    // decode an operand at the address from the mapped page (returns false if unknown or the opcode bytes cross the page)
+    inline bool decodeOperand(const unsigned char* page, unsigned short addr, DecodedOperand* op)
     {
-        CB.read = read;
-        CB.write = write;
+        void (*const* opSet2)(Z80Core*) = nullptr;
+        void (*const* opSet4)(Z80Core*, signed char) = nullptr;
+        op->addr = addr;
+        op->opcode[0] = page[addr & 0xFF];
+        op->handlerD = nullptr;
+        switch (op->opcode[0]) {
+            case 0xCB: opSet2 = opSetCB; break;
+            case 0xED: opSet2 = opSetED; break;
+            case 0xDD: opSet2 = opSetIX, opSet4 = opSetIX4; break;
+            case 0xFD: opSet2 = opSetIY, opSet4 = opSetIY4; break;
+        }
+        if (!opSet2) {
+            op->handler = opSet1[op->opcode[0]];
+            op->length = 1;
+            op->size = instructionTable1[op->opcode[0]].length;
+#ifndef Z80_DISABLE_BREAKPOINT
+            op->breakPoint = hasBreakPoint(addr);
+            op->breakOperand = hasBreakOperand(op->opcode[0]);
+#endif
+            return true;
+        }
+        if (0xFF == (addr & 0xFF)) return false;
+        op->opcode[1] = page[(addr & 0xFF) + 1];
+        op->handler = opSet2[op->opcode[1]];
+        op->length = 2;
+        op->size = 0xCB == op->opcode[0] ? 2 : 0xED == op->opcode[0] ? instructionTableED[op->opcode[1]].length : instructionTableIXY[op->opcode[1]].length;
+        if (opSet4 && 0xCB == op->opcode[1]) {
+            if (0xFC < (addr & 0xFF)) return false;
+            op->opcode[2] = page[(addr & 0xFF) + 2];
+            op->opcode[3] = page[(addr & 0xFF) + 3];
+            op->handlerD = opSet4[op->opcode[3]];
+            op->length = 4;
+            op->size = 4;
+        }
+#ifndef Z80_DISABLE_BREAKPOINT
+        op->breakPoint = hasBreakPoint(addr);
+        op->breakOperand = hasBreakOperand(op->opcode[0]) || hasBreakOperand(op->opcode[0] << 8 | op->opcode[1]);
+        if (4 == op->length) op->breakOperand = op->breakOperand || hasBreakOperand(op->opcode[0] << 16 | 0xCB00 | op->opcode[3]);
+#endif
+        return nullptr != op->handler && 0 < op->size;
     }
 
-    void setupDeviceCallback(unsigned char (*in)(void* arg, unsigned short addr),
-                             void (*out)(void* arg, unsigned short addr, unsigned char value),
-                             bool returnPortAs16Bits)
+    // JR, DJNZ, JP, CALL, RET, RST, RETI, RETN, HALT and the repeat instructions end the block
+    inline bool isBlockEnd(const DecodedOperand* op)
     {
-        CB.in = in;
-        CB.out = out;
-#ifndef Z80_UNSUPPORT_16BIT_PORT
-        CB.returnPortAs16Bits = returnPortAs16Bits;
-#endif
+        unsigned char op1 = op->opcode[0];
+        if (1 == op->length) {
+            switch (op1) {
+                case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+                case 0x76: case 0xC3: case 0xC9: case 0xCD: case 0xE9:
+                    return true;
+            }
+            switch (op1 & 0b11000111) {
+                case 0b11000000: case 0b11000010: case 0b11000100: case 0b11000111: return true;
+            }
+            return false;
+        } else if (2 == op->length) {
+            if (0xED == op1) return 0x45 == (op->opcode[1] & 0b11000111) || 0xB0 == (op->opcode[1] & 0b11110100);
+            return 0xCB != op1 && 0xE9 == op->opcode[1];
+        }
+        return false;
+    }
+
+    // only the pages mapped by mapMemory are decoded (the code via the read callback is fetched in each execution)
+    inline DecodedBlock* findDecodedBlock(unsigned short addr)
+    {
+        int page = addr >> 8;
+        const unsigned char* memory = pageMap[page].read;
+        if (!memory) return nullptr;
+        if (!decodedPages[page]) decodedPages[page] = new DecodedBlock*[256]();
+        DecodedBlock** blocks = decodedPages[page];
+        if (blocks[addr & 0xFF]) return blocks[addr & 0xFF];
+        DecodedBlock* block = new DecodedBlock();
+        block->executed = 0;
+        DecodedOperand op;
+        for (int offset = addr & 0xFF; offset < 0x100 && decodeOperand(memory, (unsigned short)(page << 8 | offset), &op); offset += op.size) {
+            block->operands.push_back(op);
+            for (int i = 0; i < op.length; i++) {
+                int a = op.addr + i;
+                decodedBytes[a >> 3] |= bits[a & 7];
+            }
+            if (isBlockEnd(&op)) break;
+        }
+        if (block->operands.empty()) {
+            delete block;
+            return nullptr;
+        }
+        blocks[addr & 0xFF] = block;
+        return block;
     }
-#endif
 
-    void initialize()
+    inline void invalidateDecodedPage(int page)
     {
-        resetConsumeClockCallback();
-#ifndef Z80_DISABLE_DEBUG
-        resetDebugMessage();
+        DecodedBlock** blocks = decodedPages[page];
+        if (blocks) {
+            for (int i = 0; i < 256; i++) {
+#ifdef Z80_JIT_X86_64
+                if (blocks[i] && blocks[i]->jitCode) jitReleased.push_back(std::make_pair(blocks[i]->jitCode, blocks[i]->jitSize));
 #endif
-        ::memset(&reg, 0, sizeof(reg));
-        reg.pair.A = 0xff;
-        reg.pair.F = 0xff;
-        reg.SP = 0xffff;
-        memset(&wtc, 0, sizeof(wtc));
+                delete blocks[i];
+                blocks[i] = nullptr;
+            }
+        }
+        ::memset(&decodedBytes[page * 32], 0, 32);
+        decodedNext = decodedEnd = nullptr;
+        decodedGeneration++;
     }
 
-    ~Z80()
+    // execute the operand at PC from the decoded block (returns false if it can not be decoded)
+    inline bool executeDecodedOperand(int clock)
     {
-#ifndef Z80_DISABLE_BREAKPOINT
-        removeAllBreakOperands();
-        removeAllBreakPoints();
+        if (decodedNext == decodedEnd || decodedNext->addr != reg.PC) {
+            DecodedBlock* block = findDecodedBlock(reg.PC);
+            if (!block) {
+                decodedNext = decodedEnd = nullptr;
+                return false;
+            }
+            decodedNext = block->operands.data();
+            decodedEnd = decodedNext + block->operands.size();
+        }
+#ifndef Z80_DISABLE_PROFILE
+        if (profile.data) ::memcpy(profile.opcode, decodedNext->opcode, sizeof(profile.opcode));
 #endif
-#ifndef Z80_DISABLE_NESTCHECK
-        removeAllCallHandlers();
-        removeAllReturnHandlers();
+#ifndef Z80_DISABLE_TRACE
+        if (trace.current) ::memcpy(trace.current->opcode, decodedNext->opcode, decodedNext->length);
 #endif
-    }
-
-#ifndef Z80_DISABLE_DEBUG
+#ifndef Z80_DISABLE_BREAKPOINT
+        if (!decodedNext->breakOperand && !isConsumeClockPerAccess()) {
+#else
+        if (!isConsumeClockPerAccess()) {
+#endif
+            // consume the clocks of fetching the opcode bytes at once since nobody can observe each of them
+            DecodedOperand* fast = decodedNext++;
+            int clocks = clock + 2 + wtc.read;
+            if (1 < fast->length) clocks += wtc.read + 4 + wtc.fetchM;
+            if (4 == fast->length) clocks += (wtc.read + 4) * 2;
+            reg.consumeClockCounter += clocks;
+            totalClocks += (unsigned int)clocks;
+            reg.R = ((reg.R + 1) & 0x7F) | (reg.R & 0x80);
+            reg.PC += fast->length;
+            if (4 == fast->length) {
+                fast->handlerD(this, (signed char)fast->opcode[2]);
+            } else {
+                fast->handler(this);
+            }
+            return true;
+        }
+        // NOTE: copy the operand because the block will be released if the instruction writes to the own page
+        DecodedOperand op = *decodedNext++;
+        // consume the clocks same as fetch() without reading the memory
+        consumeReadClock(clock);
+        reg.PC++;
+        updateRefreshRegister();
+#ifndef Z80_DISABLE_BREAKPOINT
+        if (op.breakOperand) checkBreakOperand(0, op.opcode[0]);
+#endif
+        if (1 < op.length) {
+            consumeReadClock(4 + wtc.fetchM);
+            reg.PC++;
+#ifndef Z80_DISABLE_BREAKPOINT
+            if (op.breakOperand) checkBreakOperand(op.opcode[0] << 8 | op.opcode[1]);
+#endif
+            if (4 == op.length) {
+                consumeReadClock(4);
+                consumeReadClock(4);
+                reg.PC += 2;
+#ifndef Z80_DISABLE_BREAKPOINT
+                if (op.breakOperand) checkBreakOperand(op.opcode[0] << 16 | 0xCB00 | op.opcode[3]);
+#endif
+                op.handlerD(this, (signed char)op.opcode[2]);
+                return true;
+            }
+        }
+        op.handler(this);
+        return true;
+    }
+
+#ifdef Z80_HOT_BLOCK
+    // execute an operand of the hot block
+    inline void executeHotOperand(DecodedOperand* op, int& clock, int& executed)
+    {
+        // same as the interpreter without the break point check
+        if (wtc.fetch) consumeClock(wtc.fetch);
+        reg.execEI = 0;
+        int clocks = 2 + 2 + wtc.read;
+        if (1 < op->length) clocks += wtc.read + 4 + wtc.fetchM;
+        if (4 == op->length) clocks += (wtc.read + 4) * 2;
+        reg.consumeClockCounter += clocks;
+        totalClocks += (unsigned int)clocks;
+        reg.R = ((reg.R + 1) & 0x7F) | (reg.R & 0x80);
+        reg.PC += op->length;
+        clockLeft = eventHorizon(clock);
+        if (4 == op->length) {
+            op->handlerD(this, (signed char)op->opcode[2]);
+        } else {
+            op->handler(this);
+        }
+        executed += reg.consumeClockCounter + skippedClocks;
+        clock -= reg.consumeClockCounter + skippedClocks;
+        skippedClocks = 0;
+        if (nextEventClocks <= totalClocks) dispatchEvents();
+#ifdef Z80_CALLBACK_PER_INSTRUCTION
+        checkInterrupt();
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+        flushFlags();
+        CB.consumeClock(CB.arg, reg.consumeClockCounter);
+#else
+        if (CB.consumeClockEnabled) {
+            flushFlags();
+            CB.consumeClock(CB.arg, reg.consumeClockCounter);
+        }
+#endif
+        reg.consumeClockCounter = 0;
+#else
+        reg.consumeClockCounter = 0;
+        checkInterrupt();
+#endif
+    }
+
+#ifdef Z80_JIT_X86_64
+    // execute the count operands one by one from the native code (returns 0 to leave the native code)
+    static int jitSteps(Z80Core* ctx, DecodedOperand* op, int count)
+    {
+        unsigned int generation = ctx->decodedGeneration;
+        for (DecodedOperand* end = op + count; op != end; op++) {
+            if (ctx->jitClock <= 0 || ctx->requestBreakFlag || op->addr != ctx->reg.PC) {
+                ctx->jitOp = op;
+                return 0;
+            }
+            ctx->executeHotOperand(op, ctx->jitClock, ctx->jitExecuted);
+            if (generation != ctx->decodedGeneration || (ctx->reg.IFF & ctx->IFF_HALT())) return 0; // executeHotBlock leaves without jitOp
+        }
+        ctx->jitOp = op;
+        return 1;
+    }
+
+    // consume the clocks of the count operands executed by the native code at once (returns 0 to leave the native code)
+    // nobody can observe each of them: no event, no interrupt, no callback and no end of the clocks until the last one
+    static int jitRun(Z80Core* ctx, DecodedOperand* op, int count, int fixedClocks, int reads)
+    {
+        ctx->jitOp = op;
+        int clocks = count * (4 + ctx->wtc.fetch + ctx->wtc.read) + fixedClocks + reads * ctx->wtc.read;
+        int pending = ctx->reg.consumeClockCounter; // consumed by the interrupt after the previous operand
+        if (ctx->jitClock <= clocks + pending || ctx->requestBreakFlag || op->addr != ctx->reg.PC) return 0;
+        if (ctx->nextEventClocks <= ctx->totalClocks + (unsigned int)clocks || (ctx->reg.interrupt & 0b11000000)) return 0;
+#ifdef Z80_CALLBACK_PER_INSTRUCTION
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+        return 0;
+#else
+        if (ctx->CB.consumeClockEnabled) return 0;
+#endif
+#endif
+#ifndef Z80_DISABLE_DEBUG
+        if (ctx->isDebug()) return 0;
+#endif
+        DecodedOperand* last = op + count - 1;
+        ctx->reg.PC = (unsigned short)(last->addr + last->size);
+        ctx->reg.R = ((ctx->reg.R + count) & 0x7F) | (ctx->reg.R & 0x80);
+        ctx->reg.execEI = 0;
+        ctx->totalClocks += (unsigned int)clocks;
+        ctx->reg.consumeClockCounter = 0;
+        ctx->jitClock -= clocks + pending;
+        ctx->jitExecuted += clocks + pending;
+        ctx->jitOp = op + count;
+        return 1;
+    }
+
+    // true if the interpreter handles the operand (the break points and the break operands)
+    inline bool isBreakOperand(const DecodedOperand* op)
+    {
+#ifndef Z80_DISABLE_BREAKPOINT
+        return op->breakPoint || op->breakOperand;
+#else
+        return false;
+#endif
+    }
+
+    inline int jitOffset(const void* ptr) { return (int)((const unsigned char*)ptr - (const unsigned char*)this); }
+
+    static inline void jitEmit32(std::vector<unsigned char>& code, unsigned int value)
+    {
+        for (int i = 0; i < 4; i++) code.push_back((unsigned char)(value >> (i * 8)));
+    }
+
+    static inline void jitEmit64(std::vector<unsigned char>& code, unsigned long long value)
+    {
+        for (int i = 0; i < 8; i++) code.push_back((unsigned char)(value >> (i * 8)));
+    }
+
+    // op [rbx + offset of the register]
+    inline void jitEmitRegister(std::vector<unsigned char>& code, std::initializer_list<unsigned char> op, const void* r)
+    {
+        code.insert(code.end(), op);
+        jitEmit32(code, (unsigned int)jitOffset(r));
+    }
+
+    inline void jitEmitSwap(std::vector<unsigned char>& code, const unsigned short* r1, const unsigned short* r2)
+    {
+        jitEmitRegister(code, {0x0F, 0xB7, 0x83}, r1); // movzx eax, word [rbx + r1]
+        jitEmitRegister(code, {0x0F, 0xB7, 0x8B}, r2); // movzx ecx, word [rbx + r2]
+        jitEmitRegister(code, {0x66, 0x89, 0x8B}, r1); // mov [rbx + r1], cx
+        jitEmitRegister(code, {0x66, 0x89, 0x83}, r2); // mov [rbx + r2], ax
+    }
+
+    // emit the native code of the operand only touching the registers (returns false if not supported)
+    inline bool jitEmitOperand(std::vector<unsigned char>& code, const DecodedOperand* op, int* fixedClocks, int* reads)
+    {
+        if (1 != op->length) return false;
+        unsigned char n = op->opcode[0];
+        const unsigned char* immediate = pageMap[op->addr >> 8].read + (op->addr & 0xFF) + 1;
+        unsigned short* rp[4] = {&reg.pair.BC, &reg.pair.DE, &reg.pair.HL, &reg.SP};
+        unsigned char r1 = (n >> 3) & 0b111;
+        unsigned char r2 = n & 0b111;
+        if (0x40 == (n & 0b11000000) && 0b110 != r1 && 0b110 != r2) {
+            // LD r1, r2
+            if (r1 != r2) {
+                jitEmitRegister(code, {0x0F, 0xB6, 0x83}, getRegisterPointer(r2)); // movzx eax, byte [rbx + r2]
+                jitEmitRegister(code, {0x88, 0x83}, getRegisterPointer(r1));       // mov [rbx + r1], al
+            }
+        } else if (0x06 == (n & 0b11000111) && 0b110 != r1) {
+            // LD r, n (the immediate value is read from the memory in each execution)
+            if (0xFF < (op->addr & 0xFF) + 1) return false;
+            code.insert(code.end(), {0x48, 0xB8}); // mov rax, immediate
+            jitEmit64(code, (unsigned long long)immediate);
+            code.insert(code.end(), {0x0F, 0xB6, 0x00});                 // movzx eax, byte [rax]
+            jitEmitRegister(code, {0x88, 0x83}, getRegisterPointer(r1)); // mov [rbx + r], al
+            *fixedClocks += 3;
+            *reads += 1;
+        } else if (0x01 == (n & 0b11001111)) {
+            // LD rp, nn
+            if (0xFF < (op->addr & 0xFF) + 2) return false;
+            code.insert(code.end(), {0x48, 0xB8}); // mov rax, immediate
+            jitEmit64(code, (unsigned long long)immediate);
+            code.insert(code.end(), {0x0F, 0xB7, 0x00});            // movzx eax, word [rax]
+            jitEmitRegister(code, {0x66, 0x89, 0x83}, rp[n >> 4 & 3]); // mov [rbx + rp], ax
+            *fixedClocks += 6;
+            *reads += 2;
+        } else if (0x03 == (n & 0b11001111)) {
+            jitEmitRegister(code, {0x66, 0xFF, 0x83}, rp[n >> 4 & 3]); // INC rp: inc word [rbx + rp]
+            *fixedClocks += 2;
+        } else if (0x0B == (n & 0b11001111)) {
+            jitEmitRegister(code, {0x66, 0xFF, 0x8B}, rp[n >> 4 & 3]); // DEC rp: dec word [rbx + rp]
+            *fixedClocks += 2;
+        } else if (0xEB == n) {
+            jitEmitSwap(code, &reg.pair.DE, &reg.pair.HL); // EX DE, HL
+        } else if (0xD9 == n) {
+            jitEmitSwap(code, &reg.pair.BC, &reg.back.BC); // EXX
+            jitEmitSwap(code, &reg.pair.DE, &reg.back.DE);
+            jitEmitSwap(code, &reg.pair.HL, &reg.back.HL);
+        } else if (0xF9 == n) {
+            jitEmitRegister(code, {0x0F, 0xB7, 0x83}, &reg.pair.HL); // LD SP, HL: movzx eax, word [rbx + HL]
+            jitEmitRegister(code, {0x66, 0x89, 0x83}, &reg.SP);      // mov [rbx + SP], ax
+            *fixedClocks += 2;
+        } else if (0x00 != n) {
+            return false;
+        }
+        return true;
+    }
+
+    // call the function(ctx, op, args...), and leave the native code if it returns 0
+    inline void jitEmitCall(std::vector<unsigned char>& code, std::vector<size_t>& exits, unsigned long long function, const DecodedOperand* op, std::initializer_list<int> args)
+    {
+        code.insert(code.end(), {0x48, 0x89, 0xDF}); // mov rdi, rbx
+        code.insert(code.end(), {0x48, 0xBE});       // mov rsi, op
+        jitEmit64(code, (unsigned long long)op);
+        const unsigned char movs[3][2] = {{0xBA}, {0xB9}, {0x41, 0xB8}}; // mov edx / ecx / r8d, imm32
+        int i = 0;
+        for (int arg : args) {
+            code.insert(code.end(), movs[i], movs[i] + (2 == i ? 2 : 1));
+            jitEmit32(code, (unsigned int)arg);
+            i++;
+        }
+        code.insert(code.end(), {0x48, 0xB8}); // mov rax, function
+        jitEmit64(code, function);
+        code.insert(code.end(), {0xFF, 0xD0, 0x85, 0xC0, 0x0F, 0x84}); // call rax; test eax, eax; jz (epilogue)
+        exits.push_back(code.size());
+        jitEmit32(code, 0);
+    }
+
+    /**
+     * Compile the hot block to the native code (x86-64 System V).
+     * The runs of the operands only touching the registers (LD r, r' / LD r, n / LD rp, nn / INC rp / DEC rp / EX DE, HL / EXX / LD SP, HL / NOP)
+     * (Z80_JIT_MIN_RUN or more in a row) become the native instructions, and the other operands are executed one by one
+     * as the hot block (a call per consecutive operands).
+     * The native code stops before an operand having the break points or the break operands (the interpreter handles it).
+     */
+    inline void compileBlock(DecodedBlock* block)
+    {
+        block->jitTried = true;
+        std::vector<unsigned char> code = {0x53, 0x48, 0x89, 0xFB}; // push rbx; mov rbx, rdi (ctx)
+        std::vector<size_t> exits;
+        bool native = false;
+        DecodedOperand* op = block->operands.data();
+        DecodedOperand* end = op + block->operands.size();
+        DecodedOperand* steps = op; // start of the operands executed one by one
+        while (op != end && !isBreakOperand(op)) {
+            DecodedOperand* run = op;
+            std::vector<unsigned char> runCode;
+            int fixedClocks = 0;
+            int reads = 0;
+            while (op != end && !isBreakOperand(op) && jitEmitOperand(runCode, op, &fixedClocks, &reads)) op++;
+            if (op - run < Z80_JIT_MIN_RUN) {
+                if (run == op) op++;
+                continue; // the short run is executed one by one
+            }
+            if (steps != run) jitEmitCall(code, exits, reinterpret_cast<unsigned long long>(&jitSteps), steps, {(int)(run - steps)});
+            jitEmitCall(code, exits, reinterpret_cast<unsigned long long>(&jitRun), run, {(int)(op - run), fixedClocks, reads});
+            code.insert(code.end(), runCode.begin(), runCode.end());
+            native = true;
+            steps = op;
+        }
+        if (steps != op) jitEmitCall(code, exits, reinterpret_cast<unsigned long long>(&jitSteps), steps, {(int)(op - steps)});
+        if (!native) return; // the hot block loop is same as calling each step
+        for (size_t exit : exits) {
+            unsigned int rel = (unsigned int)(code.size() - (exit + 4));
+            for (int i = 0; i < 4; i++) code[exit + (size_t)i] = (unsigned char)(rel >> (i * 8));
+        }
+        code.insert(code.end(), {0x5B, 0xC3}); // epilogue: pop rbx; ret
+        size_t size = (code.size() + 0xFFF) & ~(size_t)0xFFF;
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == memory) return;
+        ::memcpy(memory, code.data(), code.size());
+        if (mprotect(memory, size, PROT_READ | PROT_EXEC)) {
+            munmap(memory, size);
+            return;
+        }
+        block->jitCode = memory;
+        block->jitSize = size;
+    }
+
+    // unmap the native code of the released blocks
+    inline void releaseJitCode()
+    {
+        for (auto& code : jitReleased) munmap(code.first, code.second);
+        jitReleased.clear();
+    }
+#endif
+
+    /**
+     * Execute the hot block (entered Z80_HOT_BLOCK_THRESHOLD times) from the start address in one go.
+     * Leaves the block (returns to the interpreter) before an operand having the break points or the
+     * break operands, and after a branch, an interrupt, HALT, requestBreak, the end of the clocks or a
+     * write to the opcode bytes of the decoded blocks.
+     * returns the executed clocks (0: not executed)
+     */
+    inline int executeHotBlock(int clock)
+    {
+#ifdef Z80_JIT_X86_64
+        if (!jitReleased.empty()) releaseJitCode();
+#endif
+        if (isConsumeClockPerAccess() || (reg.IFF & IFF_HALT())) return 0;
+#ifndef Z80_DISABLE_TRACE
+        if (trace.buffer) return 0;
+#endif
+#ifndef Z80_DISABLE_PROFILE
+        if (profile.data) return 0;
+#endif
+        DecodedBlock** blocks = decodedPages[reg.PC >> 8];
+        DecodedBlock* block = blocks ? blocks[reg.PC & 0xFF] : nullptr;
+        if (!block) return 0;
+        if (block->executed < Z80_HOT_BLOCK_THRESHOLD) {
+            block->executed++;
+            return 0;
+        }
+        unsigned int generation = decodedGeneration;
+        int executed = 0;
+        DecodedOperand* op = block->operands.data();
+        DecodedOperand* end = op + block->operands.size();
+#ifdef Z80_JIT_X86_64
+        if (!block->jitTried) compileBlock(block);
+        if (block->jitCode) {
+            // the native code executes the operands as far as it can, and the loop below continues the rest
+            jitOp = op;
+            jitClock = clock;
+            jitExecuted = 0;
+            reinterpret_cast<void (*)(Z80Core*)>(block->jitCode)(this);
+            op = jitOp;
+            clock = jitClock;
+            executed = jitExecuted;
+            if (generation != decodedGeneration) return executed; // the block was released
+            if (reg.IFF & IFF_HALT()) op = end;
+        }
+#endif
+        while (op != end && 0 < clock && !requestBreakFlag && op->addr == reg.PC) {
+#ifndef Z80_DISABLE_BREAKPOINT
+            if (op->breakPoint || op->breakOperand) break;
+#endif
+            executeHotOperand(op++, clock, executed);
+            if (generation != decodedGeneration) return executed; // the block was released
+            if (reg.IFF & IFF_HALT()) break;
+        }
+        decodedNext = op;
+        decodedEnd = end;
+        return executed;
+    }
+#endif
+#endif
+
+  public: // API functions
+    // without setup callbacks
+    Z80Core(void* arg)
+    {
+        this->CB.arg = arg;
+        initialize();
+    }
+
+    Z80Core(const Bus& bus_, void* arg)
+    {
+        this->bus = bus_;
+        this->CB.arg = arg;
+        initialize();
+    }
+
+    Z80Core()
+    {
+        initialize();
+    }
+
+    void initialize()
+    {
+        resetConsumeClockCallback();
+        resetPortStableCallback();
+#ifndef Z80_DISABLE_DEBUG
+        resetDebugMessage();
+#endif
+#ifndef Z80_DISABLE_TRACE
+        removeTraceBuffer();
+#endif
+#ifndef Z80_DISABLE_PROFILE
+        removeProfile();
+#endif
+        ::memset(&reg, 0, sizeof(reg));
+        ::memset(&pageMap, 0, sizeof(pageMap));
+        ::memset(&dirtyPages, 0, sizeof(dirtyPages));
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache();
+#endif
+        reg.pair.A = 0xff;
+        reg.pair.F = 0xff;
+#ifdef Z80_LAZY_FLAGS
+        lazy.kind = 0;
+#endif
+        reg.SP = 0xffff;
+        memset(&wtc, 0, sizeof(wtc));
+        clockLeft = INT_MAX;
+        skippedClocks = 0;
+        aggregateHaltClocks = false;
+        totalClocks = 0;
+        executing = false;
+        replaying = false;
+        stopRecording();
+        stopReplay();
+        removeAllEvents();
+#ifndef Z80_DISABLE_BREAKPOINT
+        CB.checkingBreakPoints = false;
+        CB.checkingBreakOperands = false;
+        memset(CB.breakPointBits, 0, sizeof(CB.breakPointBits));
+        for (auto bp : CB.breakPoints) CB.breakPointBits[bp->addr >> 3] |= bits[bp->addr & 7];
+        memset(CB.breakOperandBits, 0, sizeof(CB.breakOperandBits));
+        for (auto bo : CB.breakOperands) setBreakOperandBit(bo->number, true);
+#endif
+        updateInstrumented();
+    }
+
+    ~Z80Core()
+    {
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache();
+#endif
+#ifdef Z80_JIT_X86_64
+        releaseJitCode();
+#endif
+#ifndef Z80_DISABLE_BREAKPOINT
+        removeAllBreakOperands();
+        removeAllBreakPoints();
+#endif
+#ifndef Z80_DISABLE_NESTCHECK
+        removeAllCallHandlers();
+        removeAllReturnHandlers();
+#endif
+    }
+
+    // convert the register pairs between the current layout and the layout of the older versions (A, F, B, C, D, E, H, L)
+    // call it after loading `reg` saved by the older versions, or before saving `reg` for them (the conversion is symmetric)
+    static void convertLegacyRegister(Register* r)
+    {
+#ifndef Z80_BIG_ENDIAN_HOST
+        RegisterPair* pairs[2] = {&r->pair, &r->back};
+        for (auto p : pairs) {
+            p->AF = (unsigned short)((p->AF << 8) | (p->AF >> 8));
+            p->BC = (unsigned short)((p->BC << 8) | (p->BC >> 8));
+            p->DE = (unsigned short)((p->DE << 8) | (p->DE >> 8));
+            p->HL = (unsigned short)((p->HL << 8) | (p->HL >> 8));
+        }
+#else
+        (void)r; // same layout
+#endif
+    }
+
+    // add the host memory (ex: RAM) to be saved and loaded with the CPU state (in the added order)
+    void addStateMemory(void* ptr, size_t size)
+    {
+        StateMemory memory;
+        memory.ptr = (unsigned char*)ptr;
+        memory.size = size;
+        memory.dirty.assign((getStateChunks(memory) + 7) / 8, 0xFF); // not in the snapshots yet
+        stateMemories.push_back(memory);
+    }
+
+    void removeAllStateMemory() { stateMemories.clear(); }
+
+    // bytes of the buffer needed by saveState
+    size_t getStateSize()
+    {
+        size_t size = STATE_MEMORY;
+        for (auto& memory : stateMemories) size += 16 + alignState(memory.size);
+        return size;
+    }
+
+    /**
+     * Save the CPU state and the added memory as the versioned little-endian binary (returns the saved bytes, or 0 if the buffer is too small)
+     * The scheduled events and the callbacks are not saved (they belong to the host).
+     */
+    size_t saveState(void* buffer, size_t size)
+    {
+        size_t stateSize = getStateSize();
+        if (size < stateSize) return 0;
+        flushFlags();
+        unsigned char* p = (unsigned char*)buffer;
+        ::memcpy(p, "Z80S", 4);
+        putState16(p + 4, STATE_VERSION);
+        putState16(p + 6, 0);
+        putState32(p + 8, (unsigned int)stateMemories.size());
+        putState32(p + 12, (unsigned int)stateSize);
+        putStateCPU(p + STATE_CPU);
+        p += STATE_MEMORY;
+        for (auto& memory : stateMemories) {
+            putState64(p, memory.size);
+            ::memset(p + 8, 0, 8);
+            ::memcpy(p + 16, memory.ptr, memory.size);
+            ::memset(p + 16 + memory.size, 0, alignState(memory.size) - memory.size);
+            p += 16 + alignState(memory.size);
+        }
+        return stateSize;
+    }
+
+    // load the state saved by saveState (returns false without any change if the version or the memory regions are not matched)
+    bool loadState(const void* data, size_t size)
+    {
+        const unsigned char* p = (const unsigned char*)data;
+        if (size < STATE_MEMORY || 0 != ::memcmp(p, "Z80S", 4) || STATE_VERSION != getState16(p + 4)) return false;
+        if (getState32(p + 8) != stateMemories.size() || getState32(p + 12) != getStateSize() || size < getStateSize()) return false;
+        const unsigned char* m = p + STATE_MEMORY;
+        for (auto& memory : stateMemories) {
+            if (getState64(m) != memory.size) return false;
+            m += 16 + alignState(memory.size);
+        }
+        getStateCPU(p + STATE_CPU);
+        m = p + STATE_MEMORY;
+        for (auto& memory : stateMemories) {
+            ::memcpy(memory.ptr, m + 16, memory.size);
+            std::fill(memory.dirty.begin(), memory.dirty.end(), 0xFF);
+            m += 16 + alignState(memory.size);
+        }
+        if (!stateMemories.empty()) ::memset(&dirtyPages, 0xFF, sizeof(dirtyPages)); // the regions may be mapped anywhere
+#ifdef Z80_DECODE_CACHE
+        if (!stateMemories.empty()) clearDecodeCache();
+#endif
+        return true;
+    }
+
+    // pointer to the index-th memory region in the saved state (ex: map it directly from the memory mapped file), or nullptr
+    static unsigned char* getStateMemory(void* data, size_t size, size_t index, size_t* memorySize = nullptr)
+    {
+        unsigned char* p = (unsigned char*)data;
+        if (size < STATE_MEMORY || 0 != ::memcmp(p, "Z80S", 4) || STATE_VERSION != getState16(p + 4)) return nullptr;
+        if (getState32(p + 8) <= index || size < getState32(p + 12)) return nullptr;
+        size_t offset = STATE_MEMORY;
+        for (size_t i = 0; i < index && offset + 16 <= size; i++) offset += 16 + alignState((size_t)getState64(p + offset));
+        if (size < offset + 16 || size - offset - 16 < getState64(p + offset)) return nullptr;
+        if (memorySize) *memorySize = (size_t)getState64(p + offset);
+        return p + offset + 16;
+    }
+
+    // read the memory mapped by mapMemory without consuming the clocks (returns -1 if the address is accessed via the bus)
+    int peekMemory(unsigned short addr)
+    {
+        unsigned char* page = pageMap[addr >> 8].read;
+        return page ? page[addr & 0xFF] : -1;
+    }
+
+    // decode the instruction at addr without executing it (the read callback is called if the address is not mapped)
+    Instruction decode(unsigned short addr)
+    {
+        Instruction ins;
+        decodeInstruction(&ins, addr, [this](unsigned short a) {
+            unsigned char* page = pageMap[a >> 8].read;
+            return page ? page[a & 0xFF] : bus.read(CB.arg, a); // NOTE: not an input of the record/replay
+        });
+        return ins;
+    }
+
+    // decode the instruction in the buffer (ex: ROM image) placed at addr (unknown if the instruction exceeds the size)
+    static Instruction decode(const unsigned char* bytes, size_t size, unsigned short addr)
+    {
+        Instruction ins;
+        decodeInstruction(&ins, addr, [bytes, size, addr](unsigned short a) {
+            unsigned short offset = (unsigned short)(a - addr);
+            return offset < size ? bytes[offset] : (unsigned char)0;
+        });
+        if (size < ins.length) {
+            unsigned char first = ins.opcode[0];
+            memset(&ins, 0, sizeof(ins));
+            ins.addr = addr;
+            ins.opcode[0] = first;
+            ins.length = size ? 1 : 0;
+        }
+        return ins;
+    }
+
+    // text of the decoded instruction (ex: "LD A, (IX+$05)", or "DB $ED" if unknown), returns the length of the text
+    static size_t disassemble(const Instruction& ins, char* buf, size_t size)
+    {
+        char text[32];
+        char* t = text;
+        if (!ins.mnemonic) {
+            memcpy(t, "DB ", 3);
+            t = putDisassembledHex(t + 3, ins.opcode[0], 2);
+        }
+        for (const char* p = ins.mnemonic; p && *p; p++) {
+            switch (*p) {
+                case 'n':
+                    if ('n' == p[1]) {
+                        t = putDisassembledHex(t, ins.value, 4);
+                        p++;
+                    } else {
+                        t = putDisassembledHex(t, ins.value, 2);
+                    }
+                    break;
+                case 'e': t = putDisassembledHex(t, ins.value, 4); break;
+                case 'd':
+                    if (ins.displacement < 0) t[-1] = '-'; // (i+d) -> (IX-$xx)
+                    t = putDisassembledHex(t, (unsigned int)(ins.displacement < 0 ? -ins.displacement : ins.displacement), 2);
+                    break;
+                case 'i':
+                    *t++ = 'I';
+                    *t++ = 0xFD == ins.opcode[0] ? 'Y' : 'X';
+                    break;
+                default: *t++ = *p;
+            }
+        }
+        size_t n = (size_t)(t - text);
+        if (size) {
+            size_t copy = n < size - 1 ? n : size - 1;
+            memcpy(buf, text, copy);
+            buf[copy] = '\0';
+        }
+        return n;
+    }
+
+    // disassemble the instruction at addr without executing it, returns the size of the instruction
+    int disassemble(unsigned short addr, char* buf, size_t size)
+    {
+        Instruction ins = decode(addr);
+        disassemble(ins, buf, size);
+        return ins.length;
+    }
+
+    // true if the page (addr >> 8) was written since the last snapshot
+    bool isDirtyPage(int page) { return dirtyPages[page >> 3] & bits[page & 7]; }
+
+    // mark the pages of the range as written (call after the host wrote the mapped memory directly, ex: a program loader or DMA)
+    void markDirty(unsigned short addr, size_t size)
+    {
+        if (!size) return;
+        size_t last = size - 1 < (size_t)(0xFFFF - addr) ? addr + size - 1 : 0xFFFF;
+        for (size_t page = addr >> 8; page <= last >> 8; page++) dirtyPages[page >> 3] |= bits[page & 7];
+    }
+
+    // bytes of the buffer needed by saveSnapshot
+    size_t getSnapshotSize(bool keyframe)
+    {
+        size_t size = STATE_MEMORY;
+        if (!stateMemories.empty()) {
+            moveDirtyPages(0, 256);
+            for (auto& memory : stateMemories) {
+                for (size_t chunk = 0; chunk < getStateChunks(memory); chunk++) {
+                    if (keyframe || isDirtyChunk(memory, chunk)) size += SNAPSHOT_CHUNK;
+                }
+            }
+            return size;
+        }
+        for (int page = 0; page < 256; page++) {
+            if (pageMap[page].write && (keyframe || isDirtyPage(page))) size += SNAPSHOT_CHUNK;
+        }
+        return size;
+    }
+
+    /**
+     * Save the CPU state and the memory written since the last snapshot (returns the saved bytes, or 0 if the buffer is too small)
+     * - keyframe = true: all of the memory, false: the chunks of 256 bytes written since the last snapshot (delta)
+     * - clearDirty = false: keep the written chunks for the deltas of the other snapshots (ex: a keyframe for the debugger while rewinding)
+     * - the memory regions added by addStateMemory are saved by the offset in the region, so the banks switched by mapMemory are kept apart
+     * - without addStateMemory, the pages mapped for the write by mapMemory are saved by the address (the mapping must not be changed)
+     * - the pages accessed via the bus are not saved, and the mapping (ex: the bank registers of the host) is not saved
+     */
+    size_t saveSnapshot(void* buffer, size_t size, bool keyframe, bool clearDirty = true)
+    {
+        size_t snapshotSize = getSnapshotSize(keyframe);
+        if (size < snapshotSize) return 0;
+        flushFlags();
+        unsigned char* p = (unsigned char*)buffer;
+        ::memcpy(p, "Z80D", 4);
+        putState16(p + 4, SNAPSHOT_VERSION);
+        putState16(p + 6, keyframe ? 1 : 0);
+        putState32(p + 8, (unsigned int)((snapshotSize - STATE_MEMORY) / SNAPSHOT_CHUNK));
+        putState32(p + 12, (unsigned int)snapshotSize);
+        putStateCPU(p + STATE_CPU);
+        p += STATE_MEMORY;
+        for (size_t index = 0; index < stateMemories.size(); index++) {
+            StateMemory& memory = stateMemories[index];
+            for (size_t chunk = 0; chunk < getStateChunks(memory); chunk++) {
+                if (!keyframe && !isDirtyChunk(memory, chunk)) continue;
+                size_t length = memory.size - chunk * 256 < 256 ? memory.size - chunk * 256 : 256;
+                putState32(p, (unsigned int)index);
+                putState32(p + 4, (unsigned int)chunk);
+                ::memcpy(p + 8, memory.ptr + chunk * 256, length);
+                ::memset(p + 8 + length, 0, 256 - length);
+                p += SNAPSHOT_CHUNK;
+            }
+        }
+        for (int page = 0; stateMemories.empty() && page < 256; page++) {
+            if (pageMap[page].write && (keyframe || isDirtyPage(page))) {
+                putState32(p, SNAPSHOT_CPU_PAGE);
+                putState32(p + 4, (unsigned int)page);
+                ::memcpy(p + 8, pageMap[page].write, 256);
+                p += SNAPSHOT_CHUNK;
+            }
+        }
+        if (clearDirty) clearDirtyChunks();
+        return snapshotSize;
+    }
+
+    /**
+     * Load the snapshot (load the keyframe and then the following deltas in order to restore a delta)
+     * - clearDirty = false: mark the changed chunks as written for the deltas of the other snapshots instead of clearing all of them
+     */
+    bool loadSnapshot(const void* data, size_t size, bool clearDirty = true)
+    {
+        const unsigned char* p = (const unsigned char*)data;
+        if (size < STATE_MEMORY || 0 != ::memcmp(p, "Z80D", 4) || SNAPSHOT_VERSION != getState16(p + 4)) return false;
+        size_t chunks = getState32(p + 8);
+        if ((size - STATE_MEMORY) / SNAPSHOT_CHUNK < chunks) return false;
+        for (size_t i = 0; i < chunks; i++) {
+            const unsigned char* c = p + STATE_MEMORY + i * SNAPSHOT_CHUNK;
+            unsigned int index = getState32(c);
+            unsigned int chunk = getState32(c + 4);
+            if (SNAPSHOT_CPU_PAGE == index) {
+                if (256 <= chunk || !pageMap[chunk].write) return false;
+            } else if (stateMemories.size() <= index || getStateChunks(stateMemories[index]) <= chunk) {
+                return false;
+            }
+        }
+        getStateCPU(p + STATE_CPU);
+        p += STATE_MEMORY;
+        for (size_t i = 0; i < chunks; i++, p += SNAPSHOT_CHUNK) {
+            unsigned int index = getState32(p);
+            unsigned int chunk = getState32(p + 4);
+            if (SNAPSHOT_CPU_PAGE == index) {
+                if (!clearDirty && 0 != ::memcmp(pageMap[chunk].write, p + 8, 256)) markDirtyPage((unsigned short)(chunk << 8));
+                ::memcpy(pageMap[chunk].write, p + 8, 256);
+#ifdef Z80_DECODE_CACHE
+                invalidateDecodedPage((int)chunk);
+#endif
+            } else {
+                StateMemory& memory = stateMemories[index];
+                size_t length = memory.size - chunk * 256 < 256 ? memory.size - chunk * 256 : 256;
+                if (!clearDirty && 0 != ::memcmp(memory.ptr + chunk * 256, p + 8, length)) memory.dirty[chunk >> 3] |= bits[chunk & 7];
+                ::memcpy(memory.ptr + chunk * 256, p + 8, length);
+            }
+        }
+#ifdef Z80_DECODE_CACHE
+        if (!stateMemories.empty() && chunks) clearDecodeCache();
+#endif
+        if (clearDirty) clearDirtyChunks();
+        return true;
+    }
+
+#ifndef Z80_DISABLE_DEBUG
 #ifdef Z80_NO_FUNCTIONAL
     void setDebugMessage(void (*debugMessage)(void* arg, const char* msg))
 #else
@@ -6176,6 +8733,7 @@ class Z80
     {
         CB.debugMessageEnabled = true;
         CB.debugMessage = debugMessage;
+        updateInstrumented();
     }
 
     void resetDebugMessage()
@@ -6184,6 +8742,7 @@ class Z80
 #ifdef Z80_NO_FUNCTIONAL
         CB.debugMessage = nullptr;
 #endif
+        updateInstrumented();
     }
 
     inline bool isDebug()
@@ -6192,6 +8751,84 @@ class Z80
     }
 #endif
 
+#ifndef Z80_DISABLE_TRACE
+    /**
+     * Write the binary trace record of each instruction to the ring buffer (the oldest records are overwritten)
+     * - capacity: number of the records (rounded down to the power of 2)
+     * - consumed: the index of the records read by the reader (lossless: the CPU spins while the ring is full instead of overwriting them)
+     * - the records can be read by readTrace from the other threads while executing (lock-free, single writer)
+     * - the opcode bytes are recorded as the instruction fetches them (the memory is never read by the trace itself)
+     * - HALT and the interrupts are not recorded (see the PC of the next record)
+     */
+    void setTraceBuffer(TraceRecord* buffer, size_t capacity, const std::atomic<unsigned long long>* consumed = nullptr)
+    {
+        size_t size = 1;
+        while (size <= capacity / 2) size <<= 1;
+        trace.buffer = buffer && capacity ? buffer : nullptr;
+        trace.mask = size - 1;
+        trace.written = 0;
+        trace.count.store(0, std::memory_order_release);
+        trace.current = nullptr;
+        trace.consumed = trace.buffer && 1 < size ? consumed : nullptr;
+        trace.writable = 0;
+        updateInstrumented();
+    }
+
+    void removeTraceBuffer() { setTraceBuffer(nullptr, 0); }
+
+    // number of the records written since setTraceBuffer (the index of the next record)
+    unsigned long long getTraceCount() { return trace.count.load(std::memory_order_acquire); }
+
+    /**
+     * Copy the records from the index to the records (up to count), returns the number of the copied records
+     * - the latest capacity - 1 records can be read (the writer can be writing the next one)
+     * - index is moved to the first copied record if the older records are overwritten
+     * - do not call setTraceBuffer while reading
+     */
+    size_t readTrace(unsigned long long& index, TraceRecord* records, size_t count)
+    {
+        unsigned long long end = trace.count.load(std::memory_order_acquire);
+        size_t capacity = trace.mask + 1;
+        if (!trace.buffer) return 0;
+        unsigned long long oldest = capacity <= end ? end + 1 - capacity : 0;
+        if (index < oldest) index = oldest;
+        if (end <= index) return 0;
+        size_t n = end - index < count ? (size_t)(end - index) : count;
+        for (size_t i = 0; i < n; i++) records[i] = trace.buffer[(index + i) & trace.mask];
+        // NOTE: the writer can overwrite the oldest record while copying (it writes the record after the published ones)
+        std::atomic_thread_fence(std::memory_order_acquire);
+        unsigned long long now = trace.count.load(std::memory_order_relaxed);
+        unsigned long long valid = capacity <= now ? now + 1 - capacity : 0;
+        if (index < valid) {
+            size_t lost = valid - index < n ? (size_t)(valid - index) : n;
+            ::memmove(records, records + lost, (n - lost) * sizeof(TraceRecord));
+            n -= lost;
+            index += lost;
+        }
+        return n;
+    }
+#endif
+
+#ifndef Z80_DISABLE_PROFILE
+    /**
+     * Accumulate the instruction count and the clocks of each address to the profile (the counters are not cleared)
+     * - the conditional branches are told from the opcode bytes fetched by the instruction (the memory is never read by the profile itself)
+     * - HALT waiting and the interrupts are not counted, and the fast paths of the repeat instructions and the idle loops are disabled while profiling
+     * - the conditional branch is taken if PC is not the next instruction after it
+     */
+    void setProfile(Profile* data)
+    {
+        profile.data = data;
+        profile.clocks = totalClocks;
+        profile.pc = reg.PC;
+        profile.opcode[0] = 0;
+        profile.opcode[1] = 0;
+        updateInstrumented();
+    }
+
+    void removeProfile() { setProfile(nullptr); }
+#endif
+
     inline unsigned short make16BitsFromLE(unsigned char low, unsigned char high)
     {
         unsigned short n = high;
@@ -6213,31 +8850,34 @@ class Z80
     void addBreakPoint(unsigned short addr, std::function<void(void*)> callback)
 #endif
     {
-        auto it = CB.breakPoints.find(addr);
-        if (it == CB.breakPoints.end()) {
-            CB.breakPoints[addr] = new std::vector<BreakPoint*>();
-        }
-        CB.breakPoints[addr]->push_back(new BreakPoint(addr, callback));
+        auto it = std::upper_bound(CB.breakPoints.begin(), CB.breakPoints.end(), addr, [](unsigned short a, const BreakPoint* bp) {
+            return a < bp->addr;
+        });
+        CB.breakPoints.insert(it, new BreakPoint(addr, callback));
+        CB.breakPointBits[addr >> 3] |= bits[addr & 7];
+        updateInstrumented();
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache(); // NOTE: the decoded operands have the breakPoint flag
+#endif
     }
 
     void removeBreakPoint(unsigned short addr)
     {
-        auto it = CB.breakPoints.find(addr);
-        if (it == CB.breakPoints.end()) return;
-        for (auto bp : *CB.breakPoints[addr]) delete bp;
-        delete CB.breakPoints[addr];
-        CB.breakPoints.erase(it);
+        if (!hasBreakPoint(addr)) return;
+        size_t start = findBreakPoint(addr);
+        size_t end = start;
+        while (end < CB.breakPoints.size() && CB.breakPoints[end]->addr == addr) deleteBreakPoint(CB.breakPoints[end++]);
+        CB.breakPoints.erase(CB.breakPoints.begin() + (long)start, CB.breakPoints.begin() + (long)end);
+        CB.breakPointBits[addr >> 3] &= ~bits[addr & 7];
+        updateInstrumented();
     }
 
     void removeAllBreakPoints()
     {
-        std::vector<int> keys;
-        for (auto it = CB.breakPoints.begin(); it != CB.breakPoints.end(); it++) {
-            keys.push_back(it->first);
-        }
-        for (auto key : keys) {
-            removeBreakPoint(key);
-        }
+        for (auto bp : CB.breakPoints) deleteBreakPoint(bp);
+        CB.breakPoints.clear();
+        memset(CB.breakPointBits, 0, sizeof(CB.breakPointBits));
+        updateInstrumented();
     }
 
 #ifdef Z80_NO_FUNCTIONAL
@@ -6255,12 +8895,16 @@ class Z80
     void addBreakOperand(int prefixNumber, int operandNumber, std::function<void(void*, unsigned char*, int)> callback)
 #endif
     {
-        auto op = (prefixNumber << 8) | operandNumber;
-        auto it = CB.breakOperands.find(op);
-        if (it == CB.breakOperands.end()) {
-            CB.breakOperands[op] = new std::vector<BreakOperand*>();
-        }
-        CB.breakOperands[op]->push_back(new BreakOperand(prefixNumber, operandNumber, callback));
+        int op = (prefixNumber << 8) | operandNumber;
+        auto it = std::upper_bound(CB.breakOperands.begin(), CB.breakOperands.end(), op, [](int n, const BreakOperand* bo) {
+            return n < bo->number;
+        });
+        CB.breakOperands.insert(it, new BreakOperand(op, prefixNumber, (unsigned char)operandNumber, callback));
+        setBreakOperandBit(op, true);
+        updateInstrumented();
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache(); // NOTE: the decoded operands have the breakOperand flag
+#endif
     }
 
 #ifdef Z80_NO_FUNCTIONAL
@@ -6278,11 +8922,12 @@ class Z80
 
     void removeBreakOperand(int operandNumber)
     {
-        auto it = CB.breakOperands.find(operandNumber);
-        if (it == CB.breakOperands.end()) return;
-        for (auto bo : *CB.breakOperands[operandNumber]) delete bo;
-        delete CB.breakOperands[operandNumber];
-        CB.breakOperands.erase(it);
+        size_t start = findBreakOperand(operandNumber);
+        size_t end = start;
+        while (end < CB.breakOperands.size() && CB.breakOperands[end]->number == operandNumber) deleteBreakOperand(CB.breakOperands[end++]);
+        CB.breakOperands.erase(CB.breakOperands.begin() + (long)start, CB.breakOperands.begin() + (long)end);
+        setBreakOperandBit(operandNumber, false);
+        updateInstrumented();
     }
 
     void removeBreakOperand(unsigned char prefixNumber, unsigned char operandNumber)
@@ -6300,13 +8945,10 @@ class Z80
 
     void removeAllBreakOperands()
     {
-        std::vector<int> keys;
-        for (auto it = CB.breakOperands.begin(); it != CB.breakOperands.end(); it++) {
-            keys.push_back(it->first);
-        }
-        for (auto key : keys) {
-            removeBreakOperand(key);
-        }
+        for (auto bo : CB.breakOperands) deleteBreakOperand(bo);
+        CB.breakOperands.clear();
+        memset(CB.breakOperandBits, 0, sizeof(CB.breakOperandBits));
+        updateInstrumented();
     }
 #endif
 
@@ -6360,108 +9002,394 @@ class Z80
 #endif
     }
 
+    /**
+     * Set the callback that returns the clocks while the port keeps returning the last input value without any side effect.
+     * The polling loop (IN A, ($n) / AND $m / JR Z, $-4) skips the iterations within the returned clocks.
+     */
+#ifdef Z80_NO_FUNCTIONAL
+    void setPortStableCallback(int (*portStable_)(void* arg, unsigned short port))
+#else
+    void setPortStableCallback(std::function<int(void* arg, unsigned short port)> portStable_)
+#endif
+    {
+        CB.portStableEnabled = true;
+        CB.portStable = portStable_;
+    }
+
+    void resetPortStableCallback()
+    {
+        CB.portStableEnabled = false;
+#ifdef Z80_NO_FUNCTIONAL
+        CB.portStable = nullptr;
+#endif
+    }
+
+    // skip the NOPs in HALT at once also while the consumeClock callback is set
+    // (the callback is called once with the skipped clocks, and the interrupts requested in it are accepted after the skip)
+    void setAggregateHaltClocks(bool aggregate) { aggregateHaltClocks = aggregate; }
+
+    // total clocks consumed since the initialize (64-bit monotonic counter)
+    unsigned long long getTotalClocks() { return totalClocks; }
+
+    /**
+     * Schedule the callback at the total clocks (see getTotalClocks).
+     * The callback is called at the boundary of the instruction that reaches the clocks (and the interrupts requested in it are accepted there),
+     * and execute runs the instructions until the next event without any per-access callback.
+     * returns the id of the event for cancelEvent
+     */
+#ifdef Z80_NO_FUNCTIONAL
+    unsigned long long scheduleEvent(unsigned long long clocks, void (*callback)(void* arg, unsigned long long clocks))
+#else
+    unsigned long long scheduleEvent(unsigned long long clocks, std::function<void(void* arg, unsigned long long clocks)> callback)
+#endif
+    {
+        Event event;
+        event.clocks = clocks;
+        event.id = ++lastEventId;
+        event.callback = callback;
+        events.push_back(event);
+        std::push_heap(events.begin(), events.end(), isLaterEvent);
+        updateNextEvent();
+        return event.id;
+    }
+
+    // returns false if the event is not scheduled (already called or canceled)
+    bool cancelEvent(unsigned long long id)
+    {
+        for (auto it = events.begin(); it != events.end(); it++) {
+            if (it->id == id) {
+                events.erase(it);
+                std::make_heap(events.begin(), events.end(), isLaterEvent);
+                updateNextEvent();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void removeAllEvents()
+    {
+        events.clear();
+        lastEventId = 0;
+        updateNextEvent();
+    }
+
+    /**
+     * Map the host memory to the Z80 address space so that accesses to it do not call the bus.
+     * - addr & size: the range in the Z80 address space (in units of 256 bytes pages)
+     * - ptr: the host memory of the range (nullptr: access via the bus again)
+     * - read / write: map for the read and/or write (ex: set write = false for ROM)
+     */
+    void mapMemory(unsigned short addr, int size, unsigned char* ptr, bool read = true, bool write = true)
+    {
+        int page = addr >> 8;
+        if (write) {
+            // NOTE: the written chunks of the unmapped bank are kept, and the pages of the mapped bank are changed for the snapshots
+            moveDirtyPages(page, (size + 0xFF) >> 8);
+            markDirty(addr, 0 < size ? (size_t)size : 0);
+        }
+        for (int offset = 0; offset < size && page < 256; offset += 0x100, page++) {
+            if (read) pageMap[page].read = ptr ? ptr + offset : nullptr;
+            if (write) pageMap[page].write = ptr ? ptr + offset : nullptr;
+        }
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache();
+#endif
+    }
+
+    void unmapMemory(unsigned short addr, int size)
+    {
+        mapMemory(addr, size, nullptr);
+    }
+
+    void unmapAllMemory()
+    {
+        moveDirtyPages(0, 256);
+        ::memset(&dirtyPages, 0xFF, sizeof(dirtyPages));
+        ::memset(&pageMap, 0, sizeof(pageMap));
+#ifdef Z80_DECODE_CACHE
+        clearDecodeCache();
+#endif
+    }
+
+#ifdef Z80_DECODE_CACHE
+    /**
+     * Discard all of the decoded blocks.
+     * Writes from the CPU and mapMemory invalidate them automatically, but call this after the host
+     * changed the mapped program memory directly (ex: load a program into the mapped RAM).
+     */
+    void clearDecodeCache()
+    {
+        for (int page = 0; page < 256; page++) {
+            if (decodedPages[page]) {
+                invalidateDecodedPage(page);
+                delete[] decodedPages[page];
+                decodedPages[page] = nullptr;
+            }
+        }
+        ::memset(&decodedBytes, 0, sizeof(decodedBytes));
+        decodedNext = decodedEnd = nullptr;
+        decodedGeneration++;
+    }
+#endif
+
     void requestBreak()
     {
         requestBreakFlag = true;
     }
 
+    // NOTE: ignored while replaying (see startReplay)
     void generateIRQ(unsigned char vector)
     {
-        reg.interrupt |= 0b01000000;
-        reg.interruptVector = vector;
+        if (!replaying) applyInterrupt(INPUT_IRQ, vector);
     }
 
     void cancelIRQ()
     {
-        reg.interrupt &= 0b10111111;
+        if (!replaying) applyInterrupt(INPUT_CANCEL_IRQ, 0);
     }
 
     void generateNMI(unsigned short addr)
     {
-        reg.interrupt |= 0b10000000;
-        reg.interruptAddrN = addr;
+        if (!replaying) applyInterrupt(INPUT_NMI, addr);
+    }
+
+    /**
+     * Record the results of the in callback, the read callback (the memory not mapped by mapMemory), generateIRQ, cancelIRQ, generateNMI
+     * and recordHostEvent with the total clocks (appended to the log).
+     * Start it just after saveState (or initialize), and replay the log from the same state.
+     * NOTE: each read of the memory via the read callback is a record (map the program by mapMemory to keep the log small)
+     */
+    void startRecording(std::vector<unsigned char>* log)
+    {
+        recordLog = log;
+        recordClocks = totalClocks;
+    }
+
+    void stopRecording() { recordLog = nullptr; }
+
+    // record the change of the state made by the host (ex: a DMA to the RAM) to replay it by the callback of startReplay
+    void recordHostEvent(unsigned short id, unsigned int value)
+    {
+        if (recordLog) recordInput(INPUT_HOST, value, id);
+    }
+
+    /**
+     * Replay the log recorded by startRecording without the devices (the log must be kept until stopReplay).
+     * - the in and read callbacks are not called, and the recorded values are returned at the same clocks
+     * - the out and write callbacks are not called (the writes to the memory mapped by mapMemory are done)
+     * - the interrupts and the host events (by the callback) are replayed at the boundary of the same instructions
+     * - generateIRQ, generateNMI and cancelIRQ of the host are ignored (the devices can check isReplaying to do nothing)
+     */
+#ifdef Z80_NO_FUNCTIONAL
+    void startReplay(const unsigned char* log, size_t size, void (*hostEvent)(void* arg, unsigned short id, unsigned int value) = nullptr)
+#else
+    void startReplay(const unsigned char* log, size_t size, std::function<void(void* arg, unsigned short id, unsigned int value)> hostEvent = nullptr)
+#endif
+    {
+        CB.replayHostEventEnabled = hostEvent != nullptr;
+        CB.replayHostEvent = hostEvent;
+        replaying = true;
+        replayDiverged = false;
+        replayEnd = log + size;
+        startInput(replayIn, log, 1 << INPUT_IN | 1 << INPUT_READ);
+        startInput(replayHost, log, 1 << INPUT_HOST);
+        startInput(replayInterrupt, log, 1 << INPUT_IRQ | 1 << INPUT_NMI | 1 << INPUT_CANCEL_IRQ);
+        replayEvents(); // the host events recorded before the first instruction
+    }
+
+    // the interrupts and the host events recorded until the current clocks are applied (ex: generateIRQ between the execute calls)
+    void stopReplay()
+    {
+        if (replaying) replayEvents(true);
+        replaying = false;
+        CB.replayHostEventEnabled = false;
+        replayNextClocks = ULLONG_MAX;
+        updateNextEvent();
     }
 
+    bool isReplaying() { return replaying; }
+
+    // true if the replay reads an input at the different clocks from the record or beyond the end of the log
+    bool isReplayDiverged() { return replayDiverged; }
+
     inline unsigned char fetch(int clocks)
     {
-        unsigned char result = readByte(reg.PC, clocks);
+        unsigned char result = readByte<true>(reg.PC, clocks);
         reg.PC++;
         return result;
     }
 
-    inline int execute(int clock)
+    // execute the instructions while the instrumented flag is same as the loop (returns the executed clocks)
+    template <bool instrumentedLoop>
+    inline int executeLoop(int clock)
     {
         int executed = 0;
-        requestBreakFlag = false;
-        reg.consumeClockCounter = 0;
-        while (0 < clock && !requestBreakFlag) {
+        while (0 < clock && !requestBreakFlag && instrumentedLoop == instrumented) {
+#ifdef Z80_HOT_BLOCK
+            if (decodedNext == decodedEnd || decodedNext->addr != reg.PC) {
+                int hot = executeHotBlock(clock);
+                if (hot) {
+                    executed += hot;
+                    clock -= hot;
+                    continue;
+                }
+            }
+#endif
             // execute NOP while halt
             if (reg.IFF & IFF_HALT()) {
                 reg.execEI = 0;
-                readByte(reg.PC); // NOTE: read and discard (to be consumed 4Hz)
+                if (isHaltSkipAvailable()) {
+                    skipHalt(eventHorizon(clock));
+                } else {
+                    executeHaltOperand(4); // NOTE: read and discard (to be consumed 4Hz)
+                }
             } else {
+#ifndef Z80_DISABLE_PROFILE
+                if (profile.data) beginProfile();
+#endif
                 if (wtc.fetch) consumeClock(wtc.fetch);
 #ifndef Z80_DISABLE_BREAKPOINT
-                checkBreakPoint();
+                if (instrumentedLoop) checkBreakPoint();
+#endif
+#ifndef Z80_DISABLE_TRACE
+                if (instrumentedLoop && trace.buffer) beginTrace();
 #endif
                 reg.execEI = 0;
-                int operandNumber = fetch(2);
-                updateRefreshRegister();
-#ifndef Z80_DISABLE_BREAKPOINT
-                checkBreakOperand(operandNumber);
+                clockLeft = eventHorizon(clock);
+#ifdef Z80_DECODE_CACHE
+                if (!executeDecodedOperand(2)) executeOperand<instrumentedLoop>(2);
+#else
+                executeOperand<instrumentedLoop>(2);
+#endif
+#ifndef Z80_DISABLE_TRACE
+                if (instrumentedLoop && trace.current) endTrace();
+#endif
+#ifndef Z80_DISABLE_PROFILE
+                if (profile.data) endProfile();
 #endif
-                opSet1[operandNumber](this);
             }
-            executed += reg.consumeClockCounter;
-            clock -= reg.consumeClockCounter;
+            executed += reg.consumeClockCounter + skippedClocks;
+            clock -= reg.consumeClockCounter + skippedClocks;
+            if (nextEventClocks <= totalClocks) dispatchEvents();
 #ifdef Z80_CALLBACK_PER_INSTRUCTION
             checkInterrupt();
 #ifdef Z80_CALLBACK_WITHOUT_CHECK
-            CB.consumeClock(CB.arg, reg.consumeClockCounter);
+            flushFlags();
+            CB.consumeClock(CB.arg, reg.consumeClockCounter + skippedClocks);
 #else
-            if (CB.consumeClockEnabled) CB.consumeClock(CB.arg, reg.consumeClockCounter);
+            if (CB.consumeClockEnabled) {
+                flushFlags();
+                CB.consumeClock(CB.arg, reg.consumeClockCounter + skippedClocks);
+            }
 #endif
             reg.consumeClockCounter = 0;
 #else
             reg.consumeClockCounter = 0;
             checkInterrupt();
 #endif
+            skippedClocks = 0;
         }
         return executed;
     }
 
-    inline void execute()
+    // execute the instructions while the instrumented flag is same as the loop (returns false if nothing can release HALT)
+    template <bool instrumentedLoop>
+    inline bool executeLoop()
     {
-        requestBreakFlag = false;
         while (!requestBreakFlag) {
+            if (instrumentedLoop != instrumented) return true;
 #ifdef Z80_CALLBACK_PER_INSTRUCTION
             reg.consumeClockCounter = 0;
 #endif
             // execute NOP while halt
             if (reg.IFF & IFF_HALT()) {
+#ifndef Z80_CALLBACK_WITHOUT_CHECK
+                // nothing can release HALT (no pending interrupt, no event and no consumeClock callback to request it)
+                if (!(reg.interrupt & 0b11000000) && !CB.consumeClockEnabled && events.empty()) return false;
+#endif
                 reg.execEI = 0;
-                readByte(reg.PC); // NOTE: read and discard (to be consumed 4Hz)
+                if (!events.empty() && isHaltSkipAvailable()) {
+                    skipHalt(eventHorizon(INT_MAX));
+                } else {
+                    executeHaltOperand(4); // NOTE: read and discard (to be consumed 4Hz)
+                }
             } else {
+#ifndef Z80_DISABLE_PROFILE
+                if (profile.data) beginProfile();
+#endif
 #ifndef Z80_DISABLE_BREAKPOINT
-                checkBreakPoint();
+                if (instrumentedLoop) checkBreakPoint();
+#endif
+#ifndef Z80_DISABLE_TRACE
+                if (instrumentedLoop && trace.buffer) beginTrace();
 #endif
                 reg.execEI = 0;
-                int operandNumber = fetch(2 + wtc.fetch);
-                updateRefreshRegister();
-#ifndef Z80_DISABLE_BREAKPOINT
-                checkBreakOperand(operandNumber);
+                clockLeft = eventHorizon(INT_MAX);
+#ifdef Z80_DECODE_CACHE
+                if (!executeDecodedOperand(2 + wtc.fetch)) executeOperand<instrumentedLoop>(2 + wtc.fetch);
+#else
+                executeOperand<instrumentedLoop>(2 + wtc.fetch);
+#endif
+#ifndef Z80_DISABLE_TRACE
+                if (instrumentedLoop && trace.current) endTrace();
+#endif
+#ifndef Z80_DISABLE_PROFILE
+                if (profile.data) endProfile();
 #endif
-                opSet1[operandNumber](this);
             }
+            if (nextEventClocks <= totalClocks) dispatchEvents();
             checkInterrupt();
 #ifdef Z80_CALLBACK_PER_INSTRUCTION
 #ifdef Z80_CALLBACK_WITHOUT_CHECK
-            CB.consumeClock(CB.arg, reg.consumeClockCounter);
+            flushFlags();
+            CB.consumeClock(CB.arg, reg.consumeClockCounter + skippedClocks);
 #else
-            if (CB.consumeClockEnabled) CB.consumeClock(CB.arg, reg.consumeClockCounter);
+            if (CB.consumeClockEnabled) {
+                flushFlags();
+                CB.consumeClock(CB.arg, reg.consumeClockCounter + skippedClocks);
+            }
 #endif
 #endif
+            skippedClocks = 0;
         }
+        return false;
+    }
+
+    /**
+     * Execute the instructions until the clocks run out or requestBreak is called. (returns the executed clocks)
+     * The instrumented loop (break points, break operands, the debug message and the trace) runs only while they are used,
+     * and execute switches the loop at the boundary of the instructions when they are attached or detached.
+     */
+    inline int execute(int clock)
+    {
+        int executed = 0;
+        requestBreakFlag = false;
+        reg.consumeClockCounter = 0;
+        if (nextEventClocks <= totalClocks) dispatchEvents();
+        executing = true; // NOTE: the events above are same as outside of execute (the interrupts are accepted after the next instruction)
+        while (0 < clock && !requestBreakFlag) {
+            int loop = instrumented ? executeLoop<true>(clock) : executeLoop<false>(clock);
+            executed += loop;
+            clock -= loop;
+        }
+        executing = false;
+        flushFlags();
+        return executed;
+    }
+
+    // execute the instructions until requestBreak is called or nothing can release HALT
+    inline void execute()
+    {
+        requestBreakFlag = false;
+        if (nextEventClocks <= totalClocks) dispatchEvents();
+        executing = true; // NOTE: the events above are same as outside of execute (the interrupts are accepted after the next instruction)
+        bool running = true;
+        while (running && !requestBreakFlag) {
+            running = instrumented ? executeLoop<true>() : executeLoop<false>();
+        }
+        executing = false;
+        flushFlags();
     }
 
     int executeTick4MHz()
@@ -6480,7 +9408,7 @@ class Z80
         if (isDebug()) log("===== REGISTER DUMP : START =====");
         if (isDebug()) log("PAIR: %s %s %s %s %s %s %s", registerDump(0b111), registerDump(0b000), registerDump(0b001), registerDump(0b010), registerDump(0b011), registerDump(0b100), registerDump(0b101));
         if (isDebug()) log("PAIR: F<$%02X> ... S:%s, Z:%s, H:%s, P/V:%s, N:%s, C:%s",
-                           reg.pair.F,
+                           regF(),
                            isFlagS() ? "ON" : "OFF",
                            isFlagZ() ? "ON" : "OFF",
                            isFlagH() ? "ON" : "OFF",
@@ -6496,4 +9424,169 @@ class Z80
 #endif
 };
 
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSet1[256])(Z80Core<Bus>*);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetCB[256])(Z80Core<Bus>*);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetED[256])(Z80Core<Bus>*);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetIX[256])(Z80Core<Bus>*);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetIY[256])(Z80Core<Bus>*);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetIX4[256])(Z80Core<Bus>*, signed char);
+template <class Bus>
+constexpr void (*const Z80Core<Bus>::opSetIY4[256])(Z80Core<Bus>*, signed char);
+template <class Bus>
+constexpr unsigned char Z80Core<Bus>::flagTableSZ53P[256];
+template <class Bus>
+constexpr unsigned char Z80Core<Bus>::flagTableInc[256];
+template <class Bus>
+constexpr unsigned char Z80Core<Bus>::flagTableDec[256];
+template <class Bus>
+constexpr unsigned short Z80Core<Bus>::daaTable[2048];
+template <class Bus>
+constexpr typename Z80Core<Bus>::InstructionInfo Z80Core<Bus>::instructionTable1[256];
+template <class Bus>
+constexpr typename Z80Core<Bus>::InstructionInfo Z80Core<Bus>::instructionTableCB[256];
+template <class Bus>
+constexpr typename Z80Core<Bus>::InstructionInfo Z80Core<Bus>::instructionTableED[256];
+template <class Bus>
+constexpr typename Z80Core<Bus>::InstructionInfo Z80Core<Bus>::instructionTableIXY[256];
+template <class Bus>
+constexpr typename Z80Core<Bus>::InstructionInfo Z80Core<Bus>::instructionTableIXYCB[256];
+
+// The default bus: dispatch each access to the callbacks registered with setupCallback
+class Z80CallbackBus
+{
+  public:
+#ifdef Z80_NO_FUNCTIONAL
+    unsigned char (*readCallback)(void*, unsigned short);
+    void (*writeCallback)(void*, unsigned short, unsigned char);
+    unsigned char (*inCallback)(void*, unsigned short);
+    void (*outCallback)(void*, unsigned short, unsigned char);
+#else
+    std::function<unsigned char(void*, unsigned short)> readCallback;
+    std::function<void(void*, unsigned short, unsigned char)> writeCallback;
+    std::function<unsigned char(void*, unsigned short)> inCallback;
+    std::function<void(void*, unsigned short, unsigned char)> outCallback;
+#endif
+
+    inline unsigned char read(void* arg, unsigned short addr) { return readCallback(arg, addr); }
+    inline void write(void* arg, unsigned short addr, unsigned char value) { writeCallback(arg, addr, value); }
+    inline unsigned char in(void* arg, unsigned short port) { return inCallback(arg, port); }
+    inline void out(void* arg, unsigned short port, unsigned char value) { outCallback(arg, port, value); }
+};
+
+class Z80 : public Z80Core<Z80CallbackBus>
+{
+  public:
+#ifdef Z80_NO_FUNCTIONAL
+    Z80(unsigned char (*read)(void* arg, unsigned short addr),
+        void (*write)(void* arg, unsigned short addr, unsigned char value),
+        unsigned char (*in)(void* arg, unsigned short port),
+        void (*out)(void* arg, unsigned short port, unsigned char value),
+        void* arg,
+        bool returnPortAs16Bits = false)
+#else
+    Z80(std::function<unsigned char(void*, unsigned short)> read,
+        std::function<void(void*, unsigned short, unsigned char)> write,
+        std::function<unsigned char(void*, unsigned short)> in,
+        std::function<void(void*, unsigned short, unsigned char)> out,
+        void* arg,
+        bool returnPortAs16Bits = false)
+#endif
+        : Z80Core<Z80CallbackBus>(arg)
+    {
+        setupCallback(read, write, in, out, returnPortAs16Bits);
+    }
+
+    // without setup callbacks
+    Z80(void* arg) : Z80Core<Z80CallbackBus>(arg) {}
+
+    Z80() : Z80Core<Z80CallbackBus>() {}
+
+#ifndef Z80_NO_FUNCTIONAL
+    void setupCallback(std::function<unsigned char(void*, unsigned short)> read,
+                       std::function<void(void*, unsigned short, unsigned char)> write,
+                       std::function<unsigned char(void*, unsigned short)> in,
+                       std::function<void(void*, unsigned short, unsigned char)> out,
+                       void* arg,
+                       bool returnPortAs16Bits = false)
+    {
+        CB.arg = arg;
+        setupCallback(read, write, in, out, returnPortAs16Bits);
+    }
+
+    void setupCallback(std::function<unsigned char(void*, unsigned short)> read,
+                       std::function<void(void*, unsigned short, unsigned char)> write,
+                       std::function<unsigned char(void*, unsigned short)> in,
+                       std::function<void(void*, unsigned short, unsigned char)> out,
+                       bool returnPortAs16Bits = false)
+    {
+        setupMemoryCallback(read, write);
+        setupDeviceCallback(in, out, returnPortAs16Bits);
+    }
+
+    void setupMemoryCallback(std::function<unsigned char(void*, unsigned short)> read,
+                             std::function<void(void*, unsigned short, unsigned char)> write)
+    {
+        bus.readCallback = read;
+        bus.writeCallback = write;
+    }
+
+    void setupDeviceCallback(std::function<unsigned char(void*, unsigned short)> in,
+                             std::function<void(void*, unsigned short, unsigned char)> out,
+                             bool returnPortAs16Bits)
+    {
+        bus.inCallback = in;
+        bus.outCallback = out;
+#ifndef Z80_UNSUPPORT_16BIT_PORT
+        CB.returnPortAs16Bits = returnPortAs16Bits;
+#endif
+    }
+
+#else
+    void setupCallback(unsigned char (*read)(void* arg, unsigned short addr),
+                       void (*write)(void* arg, unsigned short addr, unsigned char value),
+                       unsigned char (*in)(void* arg, unsigned short port),
+                       void (*out)(void* arg, unsigned short port, unsigned char value),
+                       void* arg,
+                       bool returnPortAs16Bits = false)
+    {
+        CB.arg = arg;
+        setupCallback(read, write, in, out, returnPortAs16Bits);
+    }
+
+    void setupCallback(unsigned char (*read)(void* arg, unsigned short addr),
+                       void (*write)(void* arg, unsigned short addr, unsigned char value),
+                       unsigned char (*in)(void* arg, unsigned short port),
+                       void (*out)(void* arg, unsigned short port, unsigned char value),
+                       bool returnPortAs16Bits = false)
+    {
+        setupMemoryCallback(read, write);
+        setupDeviceCallback(in, out, returnPortAs16Bits);
+    }
+
+    void setupMemoryCallback(unsigned char (*read)(void* arg, unsigned short addr),
+                             void (*write)(void* arg, unsigned short addr, unsigned char value))
+    {
+        bus.readCallback = read;
+        bus.writeCallback = write;
+    }
+
+    void setupDeviceCallback(unsigned char (*in)(void* arg, unsigned short addr),
+                             void (*out)(void* arg, unsigned short addr, unsigned char value),
+                             bool returnPortAs16Bits)
+    {
+        bus.inCallback = in;
+        bus.outCallback = out;
+#ifndef Z80_UNSUPPORT_16BIT_PORT
+        CB.returnPortAs16Bits = returnPortAs16Bits;
+#endif
+    }
+#endif
+};
+
 #endif // INCLUDE_Z80_HPP
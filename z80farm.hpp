@@ -0,0 +1,231 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Farm of the independent instances)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80FARM_HPP
+#define INCLUDE_Z80FARM_HPP
+#include "z80.hpp"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#ifdef Z80_NO_FUNCTIONAL
+#error "z80farm.hpp can not be used with Z80_NO_FUNCTIONAL"
+#endif
+
+/**
+ * N independent Z80 instances (64KB RAM each) executed on a work-stealing thread pool.
+ * - submit the jobs (clocks and the completion callback) to the instances and run them at once
+ * - the jobs of an instance are executed in the submitted order on a thread (instances run in parallel)
+ */
+class Z80Farm
+{
+  public:
+    class Instance
+    {
+      public:
+        size_t index;
+        unsigned char ram[0x10000];
+        Z80 z80;
+        unsigned long long executed; // clocks executed by the jobs since the reset
+        void* user;                  // free to use (ex: the result of the job)
+
+        // I/O of the instance (in: 0xFF, out: ignored by default)
+        std::function<unsigned char(Instance& instance, unsigned short port)> in;
+        std::function<void(Instance& instance, unsigned short port, unsigned char value)> out;
+
+        Instance(size_t index_) : z80([](void* arg, unsigned short addr) { return ((Instance*)arg)->ram[addr]; },
+                                      [](void* arg, unsigned short addr, unsigned char value) { ((Instance*)arg)->ram[addr] = value; },
+                                      [](void* arg, unsigned short port) { return ((Instance*)arg)->input(port); },
+                                      [](void* arg, unsigned short port, unsigned char value) { ((Instance*)arg)->output(port, value); },
+                                      this)
+        {
+            index = index_;
+            user = nullptr;
+            reset();
+        }
+
+        // initialize the CPU and the RAM, and load the image to addr (the callbacks of in/out are kept)
+        void reset(const void* image = nullptr, size_t size = 0, unsigned short addr = 0)
+        {
+            z80.initialize();
+            memset(ram, 0, sizeof(ram));
+            if (image) memcpy(&ram[addr], image, size < (size_t)(0x10000 - addr) ? size : (size_t)(0x10000 - addr));
+            z80.mapMemory(0x0000, 0x10000, ram);
+            executed = 0;
+        }
+
+      private:
+        friend class Z80Farm;
+        struct Job {
+            long long clocks;
+            std::function<void(Instance& instance)> completion;
+        };
+        std::vector<Job> jobs;
+
+        unsigned char input(unsigned short port) { return in ? in(*this, port) : 0xFF; }
+        void output(unsigned short port, unsigned char value)
+        {
+            if (out) out(*this, port, value);
+        }
+
+        // execute the clocks (ends at requestBreak)
+        void execute(long long clocks)
+        {
+            while (0 < clocks) {
+                int slice = clocks < 0x40000000 ? (int)clocks : 0x40000000;
+                int result = z80.execute(slice);
+                executed += (unsigned long long)result;
+                clocks -= result;
+                if (result < slice) break; // requestBreak
+            }
+        }
+
+        void runJobs()
+        {
+            for (auto& job : jobs) {
+                execute(job.clocks);
+                if (job.completion) job.completion(*this);
+            }
+            jobs.clear();
+        }
+    };
+
+    // threadCount = 0: the number of the host cores
+    Z80Farm(size_t count, size_t threadCount = 0)
+    {
+        for (size_t i = 0; i < count; i++) instances.push_back(std::unique_ptr<Instance>(new Instance(i)));
+        if (!threadCount) threadCount = std::thread::hardware_concurrency();
+        if (!threadCount) threadCount = 1;
+        quit = false;
+        generation = 0;
+        pending = 0;
+        for (size_t i = 0; i < threadCount; i++) workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        for (size_t i = 0; i < threadCount; i++) threadPool.push_back(std::thread([this, i]() { work(i); }));
+    }
+
+    ~Z80Farm()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threadPool) thread.join();
+    }
+
+    size_t size() { return instances.size(); }
+    size_t threads() { return threadPool.size(); }
+    Instance& operator[](size_t index) { return *instances[index]; }
+
+    // add the job that executes the clocks (and calls completion) to the instance (executed by run: do not call while running)
+    void submit(size_t index, long long clocks, std::function<void(Instance& instance)> completion = nullptr)
+    {
+        Instance::Job job;
+        job.clocks = clocks;
+        job.completion = completion;
+        instances[index]->jobs.push_back(job);
+    }
+
+    // execute all of the submitted jobs and wait for them (the completion callbacks are called from the worker threads)
+    void run()
+    {
+        size_t count = 0;
+        for (auto& instance : instances) {
+            if (!instance->jobs.empty()) count++;
+        }
+        if (!count) return;
+        // NOTE: set pending before queueing because a thread of the previous run can take the task immediately
+        std::unique_lock<std::mutex> lock(mutex);
+        pending = count;
+        count = 0;
+        for (auto& instance : instances) {
+            if (instance->jobs.empty()) continue;
+            Worker* worker = workers[count++ % workers.size()].get();
+            std::lock_guard<std::mutex> workerLock(worker->mutex);
+            worker->tasks.push_back(instance.get());
+        }
+        generation++;
+        wake.notify_all();
+        done.wait(lock, [this]() { return 0 == pending; });
+    }
+
+  private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Instance*> tasks;
+    };
+    std::vector<std::unique_ptr<Instance>> instances;
+    std::vector<std::unique_ptr<Worker>> workers; // task queue of each thread
+    std::vector<std::thread> threadPool;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    unsigned long long generation; // incremented by run to wake up the threads
+    size_t pending;                // instances not finished in the current run
+    bool quit;
+
+    // pop from the own queue (back), or steal from the other queues (front)
+    Instance* take(size_t self)
+    {
+        for (size_t i = 0; i < workers.size(); i++) {
+            Worker* worker = workers[(self + i) % workers.size()].get();
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            if (worker->tasks.empty()) continue;
+            Instance* instance;
+            if (0 == i) {
+                instance = worker->tasks.back();
+                worker->tasks.pop_back();
+            } else {
+                instance = worker->tasks.front();
+                worker->tasks.pop_front();
+            }
+            return instance;
+        }
+        return nullptr;
+    }
+
+    void work(size_t self)
+    {
+        unsigned long long seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this, seen]() { return quit || generation != seen; });
+                if (quit) return;
+                seen = generation;
+            }
+            while (Instance* instance = take(self)) {
+                instance->runJobs();
+                std::lock_guard<std::mutex> lock(mutex);
+                if (0 == --pending) done.notify_all();
+            }
+        }
+    }
+};
+
+#endif // INCLUDE_Z80FARM_HPP
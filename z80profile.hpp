@@ -0,0 +1,140 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Hot-spot report of the execution profile)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80PROFILE_HPP
+#define INCLUDE_Z80PROFILE_HPP
+#include "z80.hpp"
+#include <algorithm>
+#include <memory>
+
+#ifdef Z80_DISABLE_PROFILE
+#error "z80profile.hpp can not be used with Z80_DISABLE_PROFILE"
+#endif
+
+/**
+ * Execution profiler of a Z80 instance (see Z80::setProfile)
+ * - accumulates the instruction count and the clocks of each address while this instance exists
+ * - report prints the hot spots sorted by the clocks with the disassembly, and dump writes all of the counters as CSV
+ * - the disassembly is read from the current memory mapped by Z80::mapMemory ("??" if the address is accessed via the bus)
+ */
+class Z80Profiler
+{
+  public:
+    struct HotSpot {
+        unsigned short addr;
+        unsigned long long count;
+        unsigned long long clocks;
+        unsigned long long taken;    // conditional instructions: the condition is met (or the block instruction repeats)
+        unsigned long long notTaken; // conditional instructions: the condition is not met (or the block instruction ends)
+    };
+
+    Z80Profiler(Z80& z80_) : z80(z80_), profile(new Z80::Profile())
+    {
+        clear();
+        z80.setProfile(profile.get());
+    }
+
+    ~Z80Profiler() { z80.removeProfile(); }
+
+    void clear() { memset(profile.get(), 0, sizeof(Z80::Profile)); }
+
+    // the counters of each address
+    const Z80::Profile& get() { return *profile; }
+
+    // total clocks of the profiled instructions
+    unsigned long long getTotalClocks()
+    {
+        unsigned long long total = 0;
+        for (auto clocks : profile->clocks) total += clocks;
+        return total;
+    }
+
+    // the executed addresses sorted by the clocks (limit = 0: all)
+    std::vector<HotSpot> getHotSpots(size_t limit = 0)
+    {
+        std::vector<HotSpot> spots;
+        for (int addr = 0; addr < 0x10000; addr++) {
+            if (!profile->count[addr]) continue;
+            spots.push_back(HotSpot{(unsigned short)addr, profile->count[addr], profile->clocks[addr], profile->taken[addr], profile->notTaken[addr]});
+        }
+        std::stable_sort(spots.begin(), spots.end(), [](const HotSpot& a, const HotSpot& b) { return a.clocks > b.clocks; });
+        if (limit && limit < spots.size()) spots.resize(limit);
+        return spots;
+    }
+
+    // print the top hot spots (the share and the cumulative share of the total clocks, and taken/not taken of the conditional instructions)
+    void report(FILE* fp, size_t limit = 20)
+    {
+        unsigned long long total = getTotalClocks();
+        double cumulative = 0;
+        char text[32];
+        fprintf(fp, "%14s %7s %7s %12s %19s  %-5s %s\n", "clocks", "share", "cumul.", "count", "taken/not-taken", "addr", "instruction");
+        for (auto& spot : getHotSpots(limit)) {
+            double share = total ? 100.0 * (double)spot.clocks / (double)total : 0;
+            cumulative += share;
+            disassemble(spot.addr, text, sizeof(text));
+            char branch[40] = "";
+            if (spot.taken || spot.notTaken) snprintf(branch, sizeof(branch), "%llu/%llu", spot.taken, spot.notTaken);
+            fprintf(fp, "%14llu %6.2f%% %6.2f%% %12llu %19s  $%04X %s\n", spot.clocks, share, cumulative, spot.count, branch, spot.addr, text);
+        }
+    }
+
+    // write the counters of the executed addresses as CSV (addr,count,clocks,taken,not_taken,instruction)
+    void dump(FILE* fp)
+    {
+        char text[32];
+        fprintf(fp, "addr,count,clocks,taken,not_taken,instruction\n");
+        for (int addr = 0; addr < 0x10000; addr++) {
+            if (!profile->count[addr]) continue;
+            disassemble((unsigned short)addr, text, sizeof(text));
+            fprintf(fp, "%04X,%llu,%llu,%llu,%llu,\"%s\"\n", addr, profile->count[addr], profile->clocks[addr], profile->taken[addr], profile->notTaken[addr], text);
+        }
+    }
+
+  private:
+    Z80& z80;
+    std::unique_ptr<Z80::Profile> profile;
+
+    // the reports never call the read callback (reading the I/O mapped to the memory can have the side effects)
+    void disassemble(unsigned short addr, char* text, size_t size)
+    {
+        unsigned char bytes[4] = {0, 0, 0, 0};
+        size_t mapped = 0;
+        for (; mapped < sizeof(bytes); mapped++) {
+            int value = z80.peekMemory((unsigned short)(addr + mapped));
+            if (value < 0) break;
+            bytes[mapped] = (unsigned char)value;
+        }
+        Z80::Instruction ins = Z80::decode(bytes, sizeof(bytes), addr);
+        if (mapped < (size_t)ins.length) {
+            snprintf(text, size, "??");
+        } else {
+            Z80::disassemble(ins, text, size);
+        }
+    }
+};
+
+#endif // INCLUDE_Z80PROFILE_HPP
@@ -0,0 +1,295 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Reverse execution by the checkpoints and the replay)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80REVERSE_HPP
+#define INCLUDE_Z80REVERSE_HPP
+#include "z80.hpp"
+#include <deque>
+
+#ifdef Z80_NO_FUNCTIONAL
+#error "z80reverse.hpp can not be used with Z80_NO_FUNCTIONAL"
+#endif
+
+/**
+ * Time-travel debugger of a Z80 instance.
+ * - execute forward by this class: it takes a snapshot (keyframe) every interval clocks and records the inputs (startRecording)
+ * - going back loads the nearest snapshot and replays the inputs (startReplay) to the target instruction
+ * - the forward execution before the latest position (frontier) also replays the inputs, and returns to the devices at the frontier
+ * - the memory must be mapped by mapMemory to be rewound (see saveSnapshot), and the devices are not rewound
+ * - the devices are never called while replaying: in, read (not mapped), out and write (not mapped) are skipped (see startReplay)
+ * - the snapshots keep the written pages of the CPU, so Z80Rewind can take the deltas of the same instance
+ */
+class Z80Reverse
+{
+  public:
+    Z80Reverse(Z80& z80_, unsigned long long interval_ = 1000000, size_t maxCheckpoints_ = 256,
+               std::function<void(void* arg, unsigned short id, unsigned int value)> hostEvent_ = nullptr) : z80(z80_)
+    {
+        interval = interval_ ? interval_ : 1;
+        maxCheckpoints = maxCheckpoints_ ? maxCheckpoints_ : 1;
+        hostEvent = hostEvent_;
+        memset(breakPointBits, 0, sizeof(breakPointBits));
+        live = true;
+        frontier = z80.getTotalClocks();
+        takeCheckpoint();
+    }
+
+    ~Z80Reverse()
+    {
+        z80.stopRecording();
+        z80.stopReplay();
+    }
+
+    // the break points of the debugger (execute stops before them, and reverseContinue goes back to them)
+    void addBreakPoint(unsigned short addr) { breakPointBits[addr >> 3] |= (unsigned char)(1 << (addr & 7)); }
+    void removeBreakPoint(unsigned short addr) { breakPointBits[addr >> 3] &= (unsigned char)~(1 << (addr & 7)); }
+    void removeAllBreakPoints() { memset(breakPointBits, 0, sizeof(breakPointBits)); }
+    bool hasBreakPoint(unsigned short addr) { return breakPointBits[addr >> 3] & (1 << (addr & 7)); }
+
+    // the latest total clocks executed with the devices
+    unsigned long long getFrontier() { return live ? z80.getTotalClocks() : frontier; }
+
+    // true if the current position is before the frontier (the inputs are replayed)
+    bool isReplaying() { return !live; }
+
+    // execute forward like Z80::execute (stops before the instruction at a break point), returns the executed clocks
+    int execute(int clocks)
+    {
+        unsigned long long start = z80.getTotalClocks();
+        unsigned long long target = start + (unsigned long long)(0 < clocks ? clocks : 0);
+        if (!hasAnyBreakPoint()) {
+            runTo(target);
+        } else {
+            while (z80.getTotalClocks() < target) {
+                runTo(z80.getTotalClocks() + 1);
+                if (hasBreakPoint(z80.reg.PC)) break;
+            }
+        }
+        if (!live && frontier == z80.getTotalClocks()) goLive();
+        return (int)(z80.getTotalClocks() - start);
+    }
+
+    // execute an instruction (and an interrupt after it)
+    void step()
+    {
+        runTo(z80.getTotalClocks() + 1);
+        if (!live && frontier == z80.getTotalClocks()) goLive();
+    }
+
+    // go back to the count instructions before (returns false without any change if the checkpoints do not cover it)
+    bool stepBack(size_t count = 1)
+    {
+        if (!count) return true;
+        unsigned long long current = z80.getTotalClocks();
+        std::vector<unsigned long long> ring(count);
+        size_t remaining = count;
+        for (size_t k = checkpointBefore(current); k != (size_t)-1; k--) {
+            size_t found = 0;
+            scan(k, segmentEnd(k, current), [&](unsigned long long clocks, bool end) {
+                if (!end) ring[found++ % remaining] = clocks;
+            });
+            if (remaining <= found) return moveTo(ring[found % remaining]);
+            remaining -= found;
+        }
+        moveTo(current);
+        return false;
+    }
+
+    // go back to the previous instruction at a break point (returns false without any change if not found)
+    bool reverseContinue()
+    {
+        unsigned long long current = z80.getTotalClocks();
+        for (size_t k = checkpointBefore(current); k != (size_t)-1; k--) {
+            unsigned long long hit = ULLONG_MAX;
+            scan(k, segmentEnd(k, current), [&](unsigned long long clocks, bool end) {
+                if (!end && hasBreakPoint(z80.reg.PC)) hit = clocks;
+            });
+            if (ULLONG_MAX != hit) return moveTo(hit);
+        }
+        moveTo(current);
+        return false;
+    }
+
+    /**
+     * Find the last instruction before the current position that changed the byte at addr (the current position is kept)
+     * - clocks: total clocks at the start of the instruction (moveTo it to see the state before the write)
+     * - pc: address of the instruction (or the instruction interrupted just after it)
+     * NOTE: a write of the same value is not detected, and addr must be mapped by mapMemory (the bus is not read)
+     */
+    bool findLastWrite(unsigned short addr, unsigned long long* clocks = nullptr, unsigned short* pc = nullptr)
+    {
+        unsigned long long current = z80.getTotalClocks();
+        bool found = false;
+        for (size_t k = checkpointBefore(current); !found && k != (size_t)-1; k--) {
+            unsigned long long lastClocks = 0;
+            unsigned short lastPC = 0;
+            int lastValue = -1;
+            scan(k, segmentEnd(k, current), [&](unsigned long long at, bool) {
+                int value = z80.peekMemory(addr);
+                if (0 <= lastValue && 0 <= value && value != lastValue) {
+                    found = true;
+                    if (clocks) *clocks = lastClocks;
+                    if (pc) *pc = lastPC;
+                }
+                lastClocks = at;
+                lastPC = z80.reg.PC;
+                lastValue = value;
+            });
+        }
+        moveTo(current);
+        return found;
+    }
+
+    // go to the start of the instruction at the clocks (from findLastWrite, or a position visited before)
+    bool moveTo(unsigned long long clocks)
+    {
+        if (getFrontier() < clocks || clocks < checkpoints.front().clocks) return false;
+        if (live && clocks == z80.getTotalClocks()) return true;
+        replayFrom(checkpointBefore(clocks + 1));
+        runTo(clocks);
+        if (clocks == frontier) goLive();
+        return clocks == z80.getTotalClocks();
+    }
+
+  private:
+    struct Checkpoint {
+        unsigned long long clocks;
+        std::vector<unsigned char> snapshot;
+        std::vector<unsigned char> log;
+    };
+    Z80& z80;
+    unsigned long long interval;
+    size_t maxCheckpoints;
+    std::function<void(void* arg, unsigned short id, unsigned int value)> hostEvent;
+    std::deque<Checkpoint> checkpoints;
+    size_t segment;              // checkpoint of the log being recorded or replayed
+    bool live;                   // true: recording at the frontier, false: replaying
+    unsigned long long frontier; // valid while replaying
+    unsigned char breakPointBits[0x10000 / 8];
+
+    bool hasAnyBreakPoint()
+    {
+        for (auto bits : breakPointBits) {
+            if (bits) return true;
+        }
+        return false;
+    }
+
+    // the latest checkpoint before the clocks ((size_t)-1: none)
+    size_t checkpointBefore(unsigned long long clocks)
+    {
+        size_t k = checkpoints.size();
+        while (k && clocks <= checkpoints[k - 1].clocks) k--;
+        return k - 1;
+    }
+
+    unsigned long long segmentEnd(size_t k, unsigned long long limit)
+    {
+        return k + 1 < checkpoints.size() && checkpoints[k + 1].clocks < limit ? checkpoints[k + 1].clocks : limit;
+    }
+
+    void takeCheckpoint()
+    {
+        z80.stopRecording();
+        if (!checkpoints.empty() && checkpoints.back().clocks == z80.getTotalClocks()) checkpoints.pop_back();
+        if (maxCheckpoints <= checkpoints.size()) checkpoints.pop_front();
+        checkpoints.push_back(Checkpoint());
+        Checkpoint& checkpoint = checkpoints.back();
+        checkpoint.clocks = z80.getTotalClocks();
+        checkpoint.snapshot.resize(z80.getSnapshotSize(true));
+        z80.saveSnapshot(checkpoint.snapshot.data(), checkpoint.snapshot.size(), true, false);
+        z80.startRecording(&checkpoint.log);
+        segment = checkpoints.size() - 1;
+    }
+
+    void replayFrom(size_t k)
+    {
+        if (live) frontier = z80.getTotalClocks();
+        live = false;
+        z80.stopRecording();
+        z80.stopReplay();
+        Checkpoint& checkpoint = checkpoints[k];
+        z80.loadSnapshot(checkpoint.snapshot.data(), checkpoint.snapshot.size(), false);
+        segment = k;
+        z80.startReplay(checkpoint.log.data(), checkpoint.log.size(), hostEvent);
+    }
+
+    void goLive()
+    {
+        z80.stopReplay();
+        live = true;
+        takeCheckpoint();
+    }
+
+    // execute forward until the total clocks reach the target
+    void runTo(unsigned long long target)
+    {
+        while (z80.getTotalClocks() < target) {
+            unsigned long long limit;
+            if (live) {
+                limit = checkpoints.back().clocks + interval;
+            } else {
+                limit = segment + 1 < checkpoints.size() ? checkpoints[segment + 1].clocks : frontier;
+                if (limit <= z80.getTotalClocks()) {
+                    // the end of the log: the next log or the devices
+                    if (segment + 1 < checkpoints.size()) {
+                        z80.stopReplay();
+                        segment++;
+                        z80.startReplay(checkpoints[segment].log.data(), checkpoints[segment].log.size(), hostEvent);
+                    } else {
+                        goLive();
+                    }
+                    continue;
+                }
+            }
+            if (target < limit) limit = target;
+            unsigned long long left = limit - z80.getTotalClocks();
+            // NOTE: execute can pass the limit by an instruction and an interrupt, so approach the limit instruction by instruction
+            if (left <= 1024) {
+                z80.execute(1);
+            } else {
+                left -= 1024;
+                z80.execute(left < INT_MAX ? (int)left : INT_MAX);
+            }
+            if (live && checkpoints.back().clocks + interval <= z80.getTotalClocks()) takeCheckpoint();
+        }
+    }
+
+    // replay the instructions of the checkpoint one by one until the limit (the visitor is called at each boundary and at the end)
+    template <class Visitor>
+    void scan(size_t k, unsigned long long limit, Visitor visitor)
+    {
+        replayFrom(k);
+        while (true) {
+            bool end = limit <= z80.getTotalClocks();
+            visitor(z80.getTotalClocks(), end);
+            if (end) break;
+            runTo(z80.getTotalClocks() + 1);
+        }
+    }
+};
+
+#endif // INCLUDE_Z80REVERSE_HPP
@@ -0,0 +1,131 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Ring buffer of the snapshots for rewind)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80REWIND_HPP
+#define INCLUDE_Z80REWIND_HPP
+#include "z80.hpp"
+
+/**
+ * Fixed-size ring buffer of the snapshots (saveSnapshot) of a Z80 instance.
+ * - checkpoint saves a keyframe every keyframeInterval checkpoints, and the deltas (the written pages only) between them
+ * - the oldest snapshots are dropped when the ring is full (the deltas are dropped with their keyframe)
+ * - no allocation after the construction
+ * - bank-switched hosts: add all of the banks by addStateMemory, and restore the bank registers after rewind (see saveSnapshot)
+ */
+class Z80Rewind
+{
+  public:
+    Z80Rewind(Z80& z80_, size_t capacity, int keyframeInterval_ = 60) : z80(z80_), buffer(capacity), entries(capacity / 80 + 1)
+    {
+        keyframeInterval = 0 < keyframeInterval_ ? keyframeInterval_ : 1;
+        clear();
+    }
+
+    void clear()
+    {
+        first = 0;
+        count = 0;
+        sinceKeyframe = 0;
+    }
+
+    // number of the checkpoints that can be restored
+    size_t size() { return count; }
+
+    // save the snapshot of the current state (returns false if a keyframe is larger than the ring)
+    bool checkpoint()
+    {
+        bool keyframe = 0 == count || keyframeInterval <= sinceKeyframe;
+        size_t offset;
+        if (!reserve(z80.getSnapshotSize(keyframe), keyframe, offset)) {
+            if (keyframe || !reserve(z80.getSnapshotSize(true), true, offset)) return false;
+            keyframe = true;
+        }
+        Entry& entry = entries[(first + count) % entries.size()];
+        entry.offset = offset;
+        entry.size = z80.saveSnapshot(&buffer[offset], buffer.size() - offset, keyframe);
+        entry.keyframe = keyframe;
+        count++;
+        sinceKeyframe = keyframe ? 1 : sinceKeyframe + 1;
+        return true;
+    }
+
+    // restore the state of the checkpoint (0: the latest, 1: the previous one...) and drop the newer checkpoints
+    bool rewind(size_t back = 0)
+    {
+        if (count <= back) return false;
+        size_t target = count - 1 - back;
+        size_t key = target;
+        while (!at(key).keyframe) key--;
+        for (size_t i = key; i <= target; i++) {
+            if (!z80.loadSnapshot(&buffer[at(i).offset], at(i).size)) return false;
+        }
+        count = target + 1;
+        sinceKeyframe = (int)(target - key + 1);
+        return true;
+    }
+
+  private:
+    struct Entry {
+        size_t offset;
+        size_t size;
+        bool keyframe;
+    };
+    Z80& z80;
+    std::vector<unsigned char> buffer;
+    std::vector<Entry> entries; // circular (the oldest is first)
+    size_t first;
+    size_t count;
+    int keyframeInterval;
+    int sinceKeyframe; // checkpoints since the last keyframe (including it)
+
+    Entry& at(size_t index) { return entries[(first + index) % entries.size()]; }
+
+    void dropOldest()
+    {
+        first = (first + 1) % entries.size();
+        count--;
+    }
+
+    // make the room for the snapshot after the newest one (or at the top of the buffer), returns false if the delta lost its keyframe
+    bool reserve(size_t size, bool keyframe, size_t& offset)
+    {
+        if (buffer.size() < size) return false;
+        size_t end = count ? at(count - 1).offset + at(count - 1).size : 0;
+        bool wrap = buffer.size() < end + size;
+        offset = wrap ? 0 : end;
+        while (count) {
+            Entry& oldest = at(0);
+            bool overlap = oldest.offset < offset + size && offset < oldest.offset + oldest.size;
+            if (!overlap && !(wrap && end <= oldest.offset)) break;
+            dropOldest();
+        }
+        if (count == entries.size()) dropOldest();
+        while (count && !at(0).keyframe) dropOldest(); // the deltas can not be restored without their keyframe
+        return keyframe || count;
+    }
+};
+
+#endif // INCLUDE_Z80REWIND_HPP
@@ -0,0 +1,115 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Decoder of the binary trace)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80TRACE_HPP
+#define INCLUDE_Z80TRACE_HPP
+#include "z80.hpp"
+
+#if defined(Z80_DISABLE_DEBUG) || defined(Z80_DISABLE_TRACE)
+#error "z80trace.hpp can not be used with Z80_DISABLE_DEBUG or Z80_DISABLE_TRACE"
+#endif
+
+/**
+ * Offline decoder of the binary trace records (see Z80::setTraceBuffer) to the text of the debug message.
+ * - decode executes the instruction of the record on the scratch CPU with the registers and the opcode bytes of the record
+ * - the memory is the opcode bytes and the read effect of the record ($FF elsewhere), and the input is the input effect ($FF without it)
+ * - the registers not in the record (BC', DE' and HL') are shown as zero
+ * - disassemble decodes the opcode bytes of the record without executing them
+ */
+class Z80TraceDecoder
+{
+  public:
+    Z80TraceDecoder() : z80([](void* arg, unsigned short addr) { return ((Z80TraceDecoder*)arg)->read(addr); },
+                            [](void* arg, unsigned short addr, unsigned char value) {},
+                            [](void* arg, unsigned short port) { return ((Z80TraceDecoder*)arg)->input(port); },
+                            [](void* arg, unsigned short port, unsigned char value) {},
+                            this)
+    {
+        z80.setDebugMessage([](void* arg, const char* message) { ((Z80TraceDecoder*)arg)->receive(message); });
+        record = nullptr;
+    }
+
+    // the text of the record (valid until the next call)
+    const char* decode(const Z80::TraceRecord& record_)
+    {
+        record = &record_;
+        text[0] = '\0';
+        received = false;
+        memset(&z80.reg, 0, sizeof(z80.reg));
+        z80.reg.pair.AF = record->AF;
+        z80.reg.pair.BC = record->BC;
+        z80.reg.pair.DE = record->DE;
+        z80.reg.pair.HL = record->HL;
+        z80.reg.IX = record->IX;
+        z80.reg.IY = record->IY;
+        z80.reg.SP = record->SP;
+        z80.reg.PC = record->PC;
+        z80.reg.back.AF = record->AF2;
+        z80.reg.I = record->I;
+        z80.reg.R = record->R;
+        z80.execute(1);
+        record = nullptr;
+        return text;
+    }
+
+    // the instruction of the record without the register values (valid until the next call, see Z80::disassemble)
+    const char* disassemble(const Z80::TraceRecord& record_)
+    {
+        Z80::disassemble(Z80::decode(record_.opcode, sizeof(record_.opcode), record_.PC), text, sizeof(text));
+        return text;
+    }
+
+  private:
+    Z80 z80;
+    const Z80::TraceRecord* record;
+    char text[1024];
+    bool received;
+
+    unsigned char read(unsigned short addr)
+    {
+        unsigned short offset = (unsigned short)(addr - record->PC);
+        if (offset < 4) return record->opcode[offset];
+        if ((record->effect & Z80::TRACE_READ) && addr == record->readAddr) return record->readValue[0];
+        if ((record->effect & Z80::TRACE_READ16) && addr == (unsigned short)(record->readAddr + 1)) return record->readValue[1];
+        return 0xFF;
+    }
+
+    unsigned char input(unsigned short port)
+    {
+        return (record->effect & Z80::TRACE_IN) ? record->readValue[0] : 0xFF;
+    }
+
+    // the first message is the instruction
+    void receive(const char* message)
+    {
+        if (received) return;
+        strncpy(text, message, sizeof(text) - 1);
+        text[sizeof(text) - 1] = '\0';
+        received = true;
+    }
+};
+
+#endif // INCLUDE_Z80TRACE_HPP
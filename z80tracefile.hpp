@@ -0,0 +1,613 @@
+/**
+ * SUZUKI PLAN - Z80 Emulator (Streaming writer and reader of the binary trace)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_Z80TRACEFILE_HPP
+#define INCLUDE_Z80TRACEFILE_HPP
+#include "z80.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#ifdef Z80_DISABLE_TRACE
+#error "z80tracefile.hpp can not be used with Z80_DISABLE_TRACE"
+#endif
+
+/**
+ * Format of the trace file (little endian)
+ * - header: "Z80T", version (2 bytes), reserved (2 bytes)
+ * - blocks: "Z80B", records (4), raw size (4), packed size (4), first index (8), first clocks (8), last clocks (8) and the packed data
+ * - index: first index (8), first clocks (8) and the file offset (8) of each block
+ * - footer: file offset of the index (8), number of the blocks (4), "Z80X"
+ * Each record is encoded as the delta from the previous record of the block (the first one from zero):
+ * varint of the clocks delta, the mask of the changed 16-bit words (2 bytes) and the changed words.
+ * The encoded records of a block are compressed by LZ77 (literal/match length nibbles and a 16-bit offset like LZ4).
+ */
+class Z80TraceCodec
+{
+  public:
+    enum Layout {
+        VERSION = 1,
+        HEADER = 8,
+        BLOCK_HEADER = 40,
+        INDEX_ENTRY = 24,
+        FOOTER = 16,
+        BLOCK_RECORDS = 4096,
+        WORDS = 16,            // 16-bit words of a record except the clocks
+        MAX_ENCODED = 10 + 34, // varint of the clocks, the mask and the words
+    };
+
+    static void put16(unsigned char* p, unsigned int v)
+    {
+        p[0] = (unsigned char)v;
+        p[1] = (unsigned char)(v >> 8);
+    }
+    static void put32(unsigned char* p, unsigned int v)
+    {
+        put16(p, v & 0xFFFF);
+        put16(p + 2, v >> 16);
+    }
+    static void put64(unsigned char* p, unsigned long long v)
+    {
+        put32(p, (unsigned int)(v & 0xFFFFFFFF));
+        put32(p + 4, (unsigned int)(v >> 32));
+    }
+    static unsigned short get16(const unsigned char* p) { return (unsigned short)(p[0] | p[1] << 8); }
+    static unsigned int get32(const unsigned char* p) { return get16(p) | (unsigned int)get16(p + 2) << 16; }
+    static unsigned long long get64(const unsigned char* p) { return get32(p) | (unsigned long long)get32(p + 4) << 32; }
+
+    static void toWords(const Z80::TraceRecord& r, unsigned short* w)
+    {
+        w[0] = r.PC;
+        w[1] = r.SP;
+        w[2] = r.AF;
+        w[3] = r.BC;
+        w[4] = r.DE;
+        w[5] = r.HL;
+        w[6] = r.IX;
+        w[7] = r.IY;
+        w[8] = r.AF2;
+        w[9] = (unsigned short)(r.I | r.R << 8);
+        w[10] = (unsigned short)(r.opcode[0] | r.opcode[1] << 8);
+        w[11] = (unsigned short)(r.opcode[2] | r.opcode[3] << 8);
+        w[12] = r.readAddr;
+        w[13] = (unsigned short)(r.readValue[0] | r.readValue[1] << 8);
+        w[14] = r.writeAddr;
+        w[15] = (unsigned short)(r.writeValue | r.effect << 8);
+    }
+
+    static void fromWords(const unsigned short* w, Z80::TraceRecord& r)
+    {
+        r.PC = w[0];
+        r.SP = w[1];
+        r.AF = w[2];
+        r.BC = w[3];
+        r.DE = w[4];
+        r.HL = w[5];
+        r.IX = w[6];
+        r.IY = w[7];
+        r.AF2 = w[8];
+        r.I = (unsigned char)w[9];
+        r.R = (unsigned char)(w[9] >> 8);
+        r.opcode[0] = (unsigned char)w[10];
+        r.opcode[1] = (unsigned char)(w[10] >> 8);
+        r.opcode[2] = (unsigned char)w[11];
+        r.opcode[3] = (unsigned char)(w[11] >> 8);
+        r.readAddr = w[12];
+        r.readValue[0] = (unsigned char)w[13];
+        r.readValue[1] = (unsigned char)(w[13] >> 8);
+        r.writeAddr = w[14];
+        r.writeValue = (unsigned char)w[15];
+        r.effect = (unsigned char)(w[15] >> 8);
+    }
+
+    // the previous record of the block (zero at the top of the block)
+    struct State {
+        unsigned long long clocks;
+        unsigned short words[WORDS];
+    };
+
+    static void reset(State& state) { ::memset(&state, 0, sizeof(state)); }
+
+    // encode the record as the delta from the previous one and update the state (returns the bytes: up to MAX_ENCODED)
+    static size_t encode(const Z80::TraceRecord& record, State& state, unsigned char* out)
+    {
+        size_t n = 0;
+        unsigned long long delta = record.clocks - state.clocks;
+        for (; 0x80 <= delta; delta >>= 7) out[n++] = (unsigned char)(delta | 0x80);
+        out[n++] = (unsigned char)delta;
+        state.clocks = record.clocks;
+        unsigned short words[WORDS];
+        toWords(record, words);
+        unsigned char* mask = &out[n];
+        unsigned int bits = 0;
+        n += 2;
+        for (int i = 0; i < WORDS; i++) {
+            if (words[i] == state.words[i]) continue;
+            state.words[i] = words[i];
+            bits |= 1u << i;
+            put16(&out[n], words[i]);
+            n += 2;
+        }
+        put16(mask, bits);
+        return n;
+    }
+
+    // decode the record encoded from the previous one and update the state (returns the bytes, or 0 if broken)
+    static size_t decode(const unsigned char* in, size_t size, State& state, Z80::TraceRecord& record)
+    {
+        size_t n = 0;
+        unsigned long long delta = 0;
+        for (int shift = 0;; shift += 7) {
+            if (size <= n || 63 < shift) return 0;
+            delta |= (unsigned long long)(in[n] & 0x7F) << shift;
+            if (!(in[n++] & 0x80)) break;
+        }
+        if (size < n + 2) return 0;
+        unsigned int bits = get16(&in[n]);
+        n += 2;
+        for (int i = 0; i < WORDS; i++) {
+            if (!(bits & (1u << i))) continue;
+            if (size < n + 2) return 0;
+            state.words[i] = get16(&in[n]);
+            n += 2;
+        }
+        state.clocks += delta;
+        fromWords(state.words, record);
+        record.clocks = state.clocks;
+        return n;
+    }
+
+    // bytes of the buffer needed by compress
+    static size_t getPackedSize(size_t size) { return size + size / 255 + 16; }
+
+    // compress the data by LZ77 (returns the packed bytes)
+    static size_t compress(const unsigned char* in, size_t size, unsigned char* out)
+    {
+        unsigned int table[1 << 12]; // position + 1 of the last 4 bytes of each hash (0: none)
+        ::memset(table, 0, sizeof(table));
+        unsigned char* op = out;
+        size_t anchor = 0;
+        size_t pos = 0;
+        while (pos + 4 <= size) {
+            unsigned int sequence = read32(&in[pos]);
+            unsigned int hash = (sequence * 2654435761u) >> 20;
+            size_t candidate = table[hash];
+            table[hash] = (unsigned int)(pos + 1);
+            if (!candidate || 0xFFFF < pos - (candidate - 1) || read32(&in[candidate - 1]) != sequence) {
+                pos += 1 + ((pos - anchor) >> 6); // skip faster in the data not compressible
+                continue;
+            }
+            size_t match = candidate - 1;
+            size_t length = 4;
+            while (pos + length + 4 <= size && read32(&in[match + length]) == read32(&in[pos + length])) length += 4;
+            while (pos + length < size && in[match + length] == in[pos + length]) length++;
+            op = putSequence(op, &in[anchor], pos - anchor, pos - match, length);
+            pos += length;
+            anchor = pos;
+        }
+        op = putSequence(op, &in[anchor], size - anchor, 0, 0);
+        return (size_t)(op - out);
+    }
+
+    // decompress the data packed by compress (returns false if broken)
+    static bool decompress(const unsigned char* in, size_t size, unsigned char* out, size_t rawSize)
+    {
+        const unsigned char* end = in + size;
+        size_t op = 0;
+        while (in < end) {
+            unsigned char token = *in++;
+            size_t literals = token >> 4;
+            if (15 == literals && !getLength(in, end, literals)) return false;
+            if ((size_t)(end - in) < literals || rawSize - op < literals) return false;
+            ::memcpy(&out[op], in, literals);
+            in += literals;
+            op += literals;
+            if (in == end) break; // the last sequence has no match
+            if (end - in < 2) return false;
+            size_t offset = get16(in);
+            in += 2;
+            size_t length = (token & 15) + 4;
+            if (19 == length && !getLength(in, end, length)) return false;
+            if (!offset || op < offset || rawSize - op < length) return false;
+            for (size_t i = 0; i < length; i++, op++) out[op] = out[op - offset]; // NOTE: the match can overlap
+        }
+        return op == rawSize;
+    }
+
+  private:
+    static unsigned int read32(const unsigned char* p)
+    {
+        unsigned int v;
+        ::memcpy(&v, p, 4);
+        return v;
+    }
+
+    static unsigned char* putLength(unsigned char* op, size_t length)
+    {
+        for (; 255 <= length; length -= 255) *op++ = 255;
+        *op++ = (unsigned char)length;
+        return op;
+    }
+
+    static bool getLength(const unsigned char*& in, const unsigned char* end, size_t& length)
+    {
+        unsigned char byte;
+        do {
+            if (in == end) return false;
+            byte = *in++;
+            length += byte;
+        } while (255 == byte);
+        return true;
+    }
+
+    // token, literals, and the offset of the match (length = 0: the last sequence without the match)
+    static unsigned char* putSequence(unsigned char* op, const unsigned char* literals, size_t literalLength, size_t offset, size_t length)
+    {
+        size_t matchLength = length ? length - 4 : 0;
+        *op++ = (unsigned char)((literalLength < 15 ? literalLength : 15) << 4 | (matchLength < 15 ? matchLength : 15));
+        if (15 <= literalLength) op = putLength(op, literalLength - 15);
+        ::memcpy(op, literals, literalLength);
+        op += literalLength;
+        if (!length) return op;
+        put16(op, (unsigned int)offset);
+        op += 2;
+        if (15 <= matchLength) op = putLength(op, matchLength - 15);
+        return op;
+    }
+};
+
+/**
+ * Write the binary trace of a Z80 instance to the file on the background thread.
+ * - the constructor sets the ring buffer (setTraceBuffer), and the thread drains it to the file in the blocks
+ * - the thread executing the CPU never waits for the file: the records overwritten before written are dropped (see getDropped)
+ * - close (or the destructor) writes the rest and the index: call it after the execution is stopped
+ */
+class Z80TraceWriter
+{
+  public:
+    // lossless = true: the CPU waits (spins) while the ring is full instead of dropping the records
+    Z80TraceWriter(Z80& z80_, const char* path, size_t capacity = 0x100000, bool lossless = false) : z80(z80_), ring(capacity ? capacity : 1)
+    {
+        dropped = 0;
+        consumed = 0;
+        written = 0;
+        stopping = false;
+        failed = false;
+        fp = fopen(path, "wb");
+        if (!fp) return;
+        unsigned char header[Z80TraceCodec::HEADER];
+        ::memcpy(header, "Z80T", 4);
+        Z80TraceCodec::put16(header + 4, Z80TraceCodec::VERSION);
+        Z80TraceCodec::put16(header + 6, 0);
+        failed = 1 != fwrite(header, sizeof(header), 1, fp);
+        fileSize = sizeof(header);
+        raw.resize(Z80TraceCodec::BLOCK_RECORDS * Z80TraceCodec::MAX_ENCODED);
+        packed.resize(Z80TraceCodec::BLOCK_HEADER + Z80TraceCodec::getPackedSize(raw.size()));
+        z80.setTraceBuffer(ring.data(), ring.size(), lossless ? &consumed : nullptr);
+        thread = std::thread([this]() { drain(); });
+    }
+
+    ~Z80TraceWriter() { close(); }
+
+    bool isOpen() { return nullptr != fp; }
+
+    // records dropped because the ring was overwritten before the thread read them
+    unsigned long long getDropped() { return dropped.load(std::memory_order_relaxed); }
+
+    // records written to the file
+    unsigned long long getWritten() { return written.load(std::memory_order_relaxed); }
+
+    // stop the trace and close the file (returns false if any write failed)
+    bool close()
+    {
+        if (!fp) return false;
+        stopping.store(true, std::memory_order_release);
+        thread.join();
+        z80.removeTraceBuffer();
+        size_t indexSize = index.size() * Z80TraceCodec::INDEX_ENTRY;
+        std::vector<unsigned char> footer(indexSize + Z80TraceCodec::FOOTER);
+        for (size_t i = 0; i < index.size(); i++) {
+            Z80TraceCodec::put64(&footer[i * Z80TraceCodec::INDEX_ENTRY], index[i].firstIndex);
+            Z80TraceCodec::put64(&footer[i * Z80TraceCodec::INDEX_ENTRY + 8], index[i].firstClocks);
+            Z80TraceCodec::put64(&footer[i * Z80TraceCodec::INDEX_ENTRY + 16], index[i].offset);
+        }
+        Z80TraceCodec::put64(&footer[indexSize], fileSize);
+        Z80TraceCodec::put32(&footer[indexSize + 8], (unsigned int)index.size());
+        ::memcpy(&footer[indexSize + 12], "Z80X", 4);
+        failed = failed || 1 != fwrite(footer.data(), footer.size(), 1, fp);
+        failed = 0 != fclose(fp) || failed;
+        fp = nullptr;
+        return !failed;
+    }
+
+  private:
+    struct IndexEntry {
+        unsigned long long firstIndex;
+        unsigned long long firstClocks;
+        unsigned long long offset;
+    };
+    Z80& z80;
+    std::vector<Z80::TraceRecord> ring;
+    FILE* fp;
+    std::thread thread;
+    std::atomic<bool> stopping;
+    std::atomic<unsigned long long> dropped;
+    std::atomic<unsigned long long> written;
+    std::atomic<unsigned long long> consumed; // records copied from the ring by the thread
+    bool failed;
+    unsigned long long fileSize;
+    std::vector<IndexEntry> index;
+    std::vector<unsigned char> raw;    // encoded records of the current block
+    std::vector<unsigned char> packed; // header and the packed data of the block
+    size_t rawSize;
+    unsigned int blockRecords;
+    unsigned long long blockIndex;  // index of the first record of the current block
+    unsigned long long blockClocks; // clocks of the first record of the current block
+    Z80TraceCodec::State state;
+
+    void drain()
+    {
+        Z80::TraceRecord records[256];
+        unsigned long long next = 0;
+        rawSize = 0;
+        blockRecords = 0;
+        while (true) {
+            bool last = stopping.load(std::memory_order_acquire);
+            unsigned long long at = next;
+            size_t count = z80.readTrace(at, records, sizeof(records) / sizeof(records[0]));
+            if (next != at) {
+                // the records from next to at were overwritten (a block has the contiguous records)
+                flush();
+                dropped.fetch_add(at - next, std::memory_order_relaxed);
+            }
+            next = at + count;
+            consumed.store(next, std::memory_order_release);
+            for (size_t i = 0; i < count; i++) add(at + i, records[i]);
+            if (count) continue;
+            if (last) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        flush();
+    }
+
+    void add(unsigned long long recordIndex, const Z80::TraceRecord& record)
+    {
+        if (!blockRecords) {
+            Z80TraceCodec::reset(state);
+            blockIndex = recordIndex;
+            blockClocks = record.clocks;
+        }
+        rawSize += Z80TraceCodec::encode(record, state, &raw[rawSize]);
+        if (Z80TraceCodec::BLOCK_RECORDS <= ++blockRecords) flush();
+    }
+
+    void flush()
+    {
+        if (!blockRecords) return;
+        unsigned char* h = packed.data();
+        size_t packedSize = Z80TraceCodec::compress(raw.data(), rawSize, h + Z80TraceCodec::BLOCK_HEADER);
+        ::memcpy(h, "Z80B", 4);
+        Z80TraceCodec::put32(h + 4, blockRecords);
+        Z80TraceCodec::put32(h + 8, (unsigned int)rawSize);
+        Z80TraceCodec::put32(h + 12, (unsigned int)packedSize);
+        Z80TraceCodec::put64(h + 16, blockIndex);
+        Z80TraceCodec::put64(h + 24, blockClocks);
+        Z80TraceCodec::put64(h + 32, state.clocks);
+        IndexEntry entry;
+        entry.firstIndex = blockIndex;
+        entry.firstClocks = blockClocks;
+        entry.offset = fileSize;
+        index.push_back(entry);
+        failed = failed || 1 != fwrite(h, Z80TraceCodec::BLOCK_HEADER + packedSize, 1, fp);
+        fileSize += Z80TraceCodec::BLOCK_HEADER + packedSize;
+        written.fetch_add(blockRecords, std::memory_order_relaxed);
+        rawSize = 0;
+        blockRecords = 0;
+    }
+};
+
+/**
+ * Read the trace file written by Z80TraceWriter.
+ * - seek moves to the first record at or after the clocks by the index of the blocks
+ * - the index is rebuilt from the block headers if the file was not closed (ex: the writer crashed)
+ */
+class Z80TraceReader
+{
+  public:
+    Z80TraceReader() : fp(nullptr), block((size_t)-1), pending(false) {}
+    ~Z80TraceReader() { close(); }
+
+    bool open(const char* path)
+    {
+        close();
+        fp = fopen(path, "rb");
+        if (!fp) return false;
+        unsigned char header[Z80TraceCodec::HEADER];
+        if (1 != fread(header, sizeof(header), 1, fp) || 0 != ::memcmp(header, "Z80T", 4) || Z80TraceCodec::VERSION != Z80TraceCodec::get16(header + 4)) {
+            close();
+            return false;
+        }
+        if (!readIndex()) scanIndex();
+        block = (size_t)-1;
+        return seek(0) || index.empty();
+    }
+
+    void close()
+    {
+        if (fp) fclose(fp);
+        fp = nullptr;
+        index.clear();
+    }
+
+    size_t getBlockCount() { return index.size(); }
+
+    // move to the first record at or after the clocks (returns false if no record)
+    bool seek(unsigned long long clocks)
+    {
+        auto it = std::upper_bound(index.begin(), index.end(), clocks, [](unsigned long long c, const IndexEntry& e) { return c < e.firstClocks; });
+        size_t k = it == index.begin() ? 0 : (size_t)(it - index.begin()) - 1;
+        for (; k < index.size(); k++) {
+            if (!load(k)) return false;
+            while (cursor < records) {
+                if (!decodeNext()) return false;
+                if (clocks <= current.clocks) {
+                    pending = true;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // read the next record (returns false at the end)
+    bool next(Z80::TraceRecord& record)
+    {
+        if (pending) {
+            pending = false;
+            record = current;
+            return true;
+        }
+        while (block == (size_t)-1 || records <= cursor) {
+            size_t k = block == (size_t)-1 ? 0 : block + 1;
+            if (index.size() <= k || !load(k)) return false;
+        }
+        if (!decodeNext()) return false;
+        record = current;
+        return true;
+    }
+
+    // index of the record returned by the last next (counted from the start including the dropped records)
+    unsigned long long getIndex() { return firstIndex + cursor - 1; }
+
+  private:
+    struct IndexEntry {
+        unsigned long long firstIndex;
+        unsigned long long firstClocks;
+        unsigned long long offset;
+    };
+    FILE* fp;
+    std::vector<IndexEntry> index;
+    std::vector<unsigned char> raw;
+    std::vector<unsigned char> packed;
+    size_t block;  // index of the loaded block ((size_t)-1: none)
+    size_t records; // records in the loaded block
+    size_t cursor;  // records decoded from the loaded block
+    size_t offset;  // offset of the next record in raw
+    unsigned long long firstIndex;
+    Z80TraceCodec::State state;
+    Z80::TraceRecord current;
+    bool pending; // current is not returned by next yet (see seek)
+
+    bool seekFile(unsigned long long position)
+    {
+#ifdef _WIN32
+        return 0 == _fseeki64(fp, (long long)position, SEEK_SET);
+#else
+        return 0 == fseeko(fp, (off_t)position, SEEK_SET);
+#endif
+    }
+
+    unsigned long long tellFile()
+    {
+#ifdef _WIN32
+        return (unsigned long long)_ftelli64(fp);
+#else
+        return (unsigned long long)ftello(fp);
+#endif
+    }
+
+    bool readIndex()
+    {
+        unsigned char footer[Z80TraceCodec::FOOTER];
+        if (0 != fseek(fp, -(long)sizeof(footer), SEEK_END)) return false;
+        unsigned long long footerOffset = tellFile();
+        if (1 != fread(footer, sizeof(footer), 1, fp) || 0 != ::memcmp(footer + 12, "Z80X", 4)) return false;
+        unsigned long long indexOffset = Z80TraceCodec::get64(footer);
+        size_t count = Z80TraceCodec::get32(footer + 8);
+        if (footerOffset < indexOffset || footerOffset - indexOffset != (unsigned long long)count * Z80TraceCodec::INDEX_ENTRY) return false;
+        std::vector<unsigned char> data(count * Z80TraceCodec::INDEX_ENTRY);
+        if (!seekFile(indexOffset) || (count && 1 != fread(data.data(), data.size(), 1, fp))) return false;
+        for (size_t i = 0; i < count; i++) {
+            IndexEntry entry;
+            entry.firstIndex = Z80TraceCodec::get64(&data[i * Z80TraceCodec::INDEX_ENTRY]);
+            entry.firstClocks = Z80TraceCodec::get64(&data[i * Z80TraceCodec::INDEX_ENTRY + 8]);
+            entry.offset = Z80TraceCodec::get64(&data[i * Z80TraceCodec::INDEX_ENTRY + 16]);
+            index.push_back(entry);
+        }
+        return true;
+    }
+
+    // walk the block headers from the top (the last block can be incomplete)
+    void scanIndex()
+    {
+        index.clear();
+        unsigned long long position = Z80TraceCodec::HEADER;
+        unsigned char h[Z80TraceCodec::BLOCK_HEADER];
+        while (seekFile(position) && 1 == fread(h, sizeof(h), 1, fp) && 0 == ::memcmp(h, "Z80B", 4)) {
+            unsigned long long next = position + Z80TraceCodec::BLOCK_HEADER + Z80TraceCodec::get32(h + 12);
+            if (!seekFile(next - 1) || EOF == fgetc(fp)) break;
+            IndexEntry entry;
+            entry.firstIndex = Z80TraceCodec::get64(h + 16);
+            entry.firstClocks = Z80TraceCodec::get64(h + 24);
+            entry.offset = position;
+            index.push_back(entry);
+            position = next;
+        }
+    }
+
+    bool load(size_t k)
+    {
+        block = (size_t)-1;
+        unsigned char h[Z80TraceCodec::BLOCK_HEADER];
+        if (!seekFile(index[k].offset) || 1 != fread(h, sizeof(h), 1, fp) || 0 != ::memcmp(h, "Z80B", 4)) return false;
+        size_t rawSize = Z80TraceCodec::get32(h + 8);
+        size_t packedSize = Z80TraceCodec::get32(h + 12);
+        if (Z80TraceCodec::BLOCK_RECORDS * Z80TraceCodec::MAX_ENCODED < rawSize) return false;
+        raw.resize(rawSize);
+        packed.resize(packedSize);
+        if (packedSize && 1 != fread(packed.data(), packedSize, 1, fp)) return false;
+        if (!Z80TraceCodec::decompress(packed.data(), packedSize, raw.data(), rawSize)) return false;
+        block = k;
+        records = Z80TraceCodec::get32(h + 4);
+        firstIndex = Z80TraceCodec::get64(h + 16);
+        cursor = 0;
+        offset = 0;
+        pending = false;
+        Z80TraceCodec::reset(state);
+        return true;
+    }
+
+    bool decodeNext()
+    {
+        size_t n = Z80TraceCodec::decode(&raw[offset], raw.size() - offset, state, current);
+        if (!n) return false;
+        offset += n;
+        cursor++;
+        return true;
+    }
+};
+
+#endif // INCLUDE_Z80TRACEFILE_HPP